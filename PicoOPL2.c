@@ -5,22 +5,51 @@
 #include "opl2_hardware.h"
 #include "opl2.h"
 #include "instruments.h"
+#include "bank.h"
+#include "mus_player.h"
+#include "tracker_player.h"
 #include "voice_manager.h"
 #include "midi_state.h"
 #include "audio_engine.h"
 #include "song_player.h"
 #include "midi_input.h"
+#include "usb_midi.h"
+#include "console.h"
 #include "lcd.h"
 #include "encoder.h"
 #include "menu.h"
 #include "queue.h"
+#include "scheduler.h"
+#include "perf.h"
+
+static const uint LED_PIN = PICO_DEFAULT_LED_PIN;
+
+// --- CORE 0 TASKS (highest priority first) ---
+
+// Release due song events to Core 1
+static void song_task(void) {
+    if (menu_get_mode() == MODE_SONG) song_player_update(LED_PIN);
+}
+
+// USB device stack: console and USB-MIDI packets
+static void usb_task(void) {
+    usb_midi_task();
+}
+
+// Menu: encoder, and redraws when it or the engine snapshot changed
+// (the LCD goes out in the background)
+static void ui_task(void) {
+    menu_update();
+}
 
 // --- MAIN ---
 int main() {
+    usb_midi_init();
     stdio_init_all();
+    console_init();  // printf() to the USB console (console.h)
+    perf_init_core();
     hardware_setup();
     
-    const uint LED_PIN = PICO_DEFAULT_LED_PIN;
     gpio_init(LED_PIN);
     gpio_set_dir(LED_PIN, GPIO_OUT);
 
@@ -31,6 +60,7 @@ int main() {
         lcd_clear();
         lcd_print_at(0, 0, "   PicoOPL2 Synth");
         lcd_print_at(0, 1, "    Initializing...");
+        lcd_flush();
     } else {
         printf("LCD: Failed to initialize\n");
     }
@@ -44,12 +74,22 @@ int main() {
     sleep_ms(2000);
     
     opl2_clear();
-    opl2_write(0x01, 0x20); // Enable Waveform Select
-    opl2_write(0xBD, 0x00); // Ensure Melodic Mode
+    invalidate_channel_programs();  // Every chip's patches are gone
+    for (uint8_t chip = 0; chip < OPL2_CHIPS; chip++) {
+        opl2_write_chip(chip, 0x01, 0x20); // Enable Waveform Select
+        opl2_write_chip(chip, 0xBD, 0x00); // Ensure Melodic Mode
+    }
+
+    // Find instrument banks in flash (built-in bank is current)
+    bank_init();
+
+    // Find Doom MUS songs and tracker modules in flash
+    mus_init();
+    tracker_init();
 
     // Load default instruments
-    for(int i=0; i<9; i++) load_gm_instrument(i, 0);
-    load_drum_patch(8, 36);
+    for(int i=0; i<OPL2_VOICES; i++) load_gm_instrument(i, 0);
+    load_drum_patch(DRUM_VOICE, 36);
 
     // Start Engine
     audio_engine_init(512);
@@ -62,23 +102,13 @@ int main() {
     midi_input_init();
     midi_input_set_enabled(true);  // Start in MIDI-IN mode
     
-    // Main loop - update menu, song player, and MIDI input
+    // Main loop - the scheduler runs the tasks by deadline and sleeps between
+    scheduler_add("song", song_task, SCHED_SONG_PERIOD_US, SCHED_SONG_BUDGET_US);
+    scheduler_add("usb", usb_task, SCHED_USB_PERIOD_US, SCHED_USB_BUDGET_US);
+    scheduler_add("ui", ui_task, SCHED_UI_PERIOD_US, SCHED_UI_BUDGET_US);
+    scheduler_add("con", console_task, SCHED_CON_PERIOD_US, SCHED_CON_BUDGET_US);  // USB serial console
+
     while (true) {
-        // Process MIDI immediately for tight timing
-        if (menu_get_mode() == MODE_MIDI_IN) {
-            midi_input_update();
-        } else {
-            song_player_update(LED_PIN);
-        }
-        
-        // Update voice activity for menu display
-        bool voice_states[9];
-        get_voice_states(voice_states);
-        menu_update_voices(voice_states);
-        
-        menu_update();
-        
-        // Small delay to prevent CPU spinning
-        sleep_us(100);  // 100 microseconds = 10kHz update rate
+        scheduler_run_once();
     }
 }
\ No newline at end of file
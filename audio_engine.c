@@ -9,146 +9,438 @@
 #include "pico/stdlib.h"
 #include "pico/multicore.h"
 #include "pico/util/queue.h"
+#include "hardware/sync.h"
 #include "opl2.h"
+#include "opl2_hardware.h"
+#include "opl2_stream.h"
 #include "instruments.h"
+#include "bank.h"
 #include "voice_manager.h"
 #include "midi_state.h"
+#include "modulation.h"
+#include "perf.h"
+#include <string.h>
 
 // Event queue for communication between cores
 static queue_t event_queue;
+static uint16_t event_queue_size = 0;
+static volatile uint16_t queue_peak = 0;      // Written by the adding side (IRQs off)
+static volatile uint32_t queue_dropped = 0;
 
-// --- CORE 1: THE AUDIO ENGINE ---
-static void core1_entry(void) {
-    SongEvent event;
-    init_voices();
-    
-    while (true) {
-        queue_remove_blocking(&event_queue, &event);
-        
-        // Process this event
-        if (event.delay_ms > 0) sleep_ms(event.delay_ms);
-
-        switch (event.type) {
-            case 0: // Note Off
-            {
-                int voice = find_active_voice(event.channel, event.note);
-                if (voice != -1) {
-                    opl2_note_off(voice);
-                    voices[voice].active = false;
+// Patch data is bigger than a SongEvent, so it travels in its own queue;
+// a type 5 event tells Core 1 to pick it up in order with the notes
+typedef struct {
+    uint8_t program;
+    OPL_Patch patch;
+} PatchUpdate;
+
+#define PATCH_QUEUE_SIZE 256  // A whole bank dump, even if Core 1 takes none before it ends (3 KB)
+static queue_t patch_queue;
+
+// All percussion shares voice 8, so simultaneous hits fight over it: a hit
+// may not cut a higher-priority drum (see drum_map) during its attack
+#define DRUM_ATTACK_US 30000
+static uint8_t drum_priority = 0;
+static uint32_t drum_hit_us = 0;
+
+// Prefetch statistics (written by Core 1, read by Core 0)
+static volatile uint32_t melodic_note_ons = 0;
+static volatile uint32_t preloaded_note_ons = 0;
+
+// Control tick cost (written by Core 1, read by Core 0)
+static volatile uint32_t tick_avg_q4 = 0;   // Moving average in 1/16 us
+static volatile uint32_t tick_max_us = 0;
+
+// State snapshot for Core 0 (seqlock: the sequence is odd while Core 1
+// copies a new one in; generation = sequence / 2)
+static volatile uint32_t snapshot_sequence = 0;
+static EngineSnapshot snapshot;
+static EngineSnapshot staged;           // Core 1's working copy
+static uint32_t events_processed = 0;
+static bool events_unpublished = false;
+static uint8_t ticks_to_publish = VU_PUBLISH_TICKS;
+
+// Core 1 time accounting for the current window (see EngineLoad)
+static EngineLoad load;
+static uint32_t load_start_us = 0;
+static uint32_t load_idle_us = 0;
+static uint32_t load_delay_us = 0;
+static uint32_t load_writes_base = 0;
+
+// --- CORE 1: EVENT HANDLERS ---
+
+static void handle_control_change(uint8_t channel, uint8_t controller, uint8_t value) {
+    bool down = value >= 64;
+
+    switch (controller) {
+        case 7: // Channel Volume (sounding notes fade to it)
+            midi_set_volume(channel, value);
+            break;
+
+        case 1:  // Modulation (vibrato depth)
+        case 5:  // Portamento Time
+        case 11: // Expression
+        case 65: // Portamento On/Off
+        case 92: // Tremolo Depth
+            midi_set_controller(channel, controller, value);
+            break;
+
+        case 121: // Reset All Controllers (pedals come up too)
+            midi_reset_controllers(channel);
+            handle_control_change(channel, 64, 0);
+            handle_control_change(channel, 66, 0);
+            break;
+
+        case 64: // Sustain (Damper) Pedal
+            midi_set_sustain(channel, down);
+            if (!down) release_sustained_voices(channel);
+            break;
+
+        case 66: // Sostenuto Pedal
+            if (down) {
+                if (!midi_get_sostenuto(channel)) latch_sostenuto_voices(channel);
+                midi_set_sostenuto(channel, true);
+            } else {
+                midi_set_sostenuto(channel, false);
+                for (int i = 0; i < OPL2_VOICES; i++) {
+                    if (voices[i].midi_channel == channel) voices[i].sostenuto = false;
                 }
-                break;
+                release_sustained_voices(channel);
             }
+            break;
+
+        default:
+            // Other controllers not implemented yet
+            break;
+    }
+}
+
+// Bring voices holding a program (or every bank program, for PATCH_NONE)
+// up to date with the current bank
+static void refresh_program_voices(uint16_t program) {
+    for (int i = 0; i < OPL2_VOICES; i++) {
+        uint16_t held = get_channel_program(i);
+        if (held == PATCH_NONE) continue;
+        if (program != PATCH_NONE && held != program) continue;
+
+        // Layer voices of double-voice notes refresh from their own voice
+        OPL_Instrument inst;
+        bank_get_instrument((uint8_t)held, &inst);
+        if (refresh_channel_patch(i, &inst.voice[get_channel_layer(i)])) {
+            apply_velocity(i, voices[i].velocity);
+        }
+    }
+}
+
+static void apply_patch_updates(void) {
+    PatchUpdate update;
+    while (queue_try_remove(&patch_queue, &update)) {
+        // If the override pool is full the bank keeps its patch, and so do the voices
+        if (update_gm_patch(update.program, &update.patch)) {
+            refresh_program_voices(update.program);
+        }
+    }
+}
+
+static bool drum_hit_allowed(uint8_t note) {
+    uint8_t priority = get_drum_entry(note)->priority;
+    uint32_t now = time_us_32();
+
+    if (voices[DRUM_VOICE].active && priority < drum_priority && now - drum_hit_us < DRUM_ATTACK_US) {
+        return false;
+    }
+    drum_priority = priority;
+    drum_hit_us = now;
+    return true;
+}
+
+// Load an upcoming program into idle voices so its Note On finds the patch
+// already written and only needs the pitch and level registers
+static void prefetch_program(uint8_t program, uint8_t hint) {
+    // The converter already picked the note's voice: load it there if it is
+    // idle by now (a voice still sounding is loaded at the note instead)
+    if (hint & VOICE_HINT_ASSIGNED) {
+        int voice = VOICE_HINT_VOICE(hint);
+        if (voice < MELODIC_VOICES && !voices[voice].active) {
+            voices[voice].preloaded = true;
+            load_instrument_layer(voice, program, 0);
+        }
+        return;
+    }
+
+    OPL_Instrument inst;
+    bank_get_instrument(program, &inst);
+
+    for (uint8_t layer = 0; layer < (inst.double_voice ? 2 : 1); layer++) {
+        int voice = prefetch_voice(program, layer);
+        if (voice >= 0) load_instrument_layer(voice, program, layer);
+    }
+}
+
+// Note number after a voice's note offset, kept in MIDI range
+static uint8_t offset_note(uint8_t note, int8_t offset) {
+    int n = note + offset;
+    if (n < 0) return 0;
+    if (n > 127) return 127;
+    return (uint8_t)n;
+}
+
+// Silence everything and return the voices and controllers to their defaults
+static void reset_engine(void) {
+    for(int i=0; i<OPL2_VOICES; i++) opl2_note_off(i);
+    init_voices();
+    modulation_init();
+    midi_reset_pedals();
+    midi_reset_volume();
+    for (int ch = 0; ch < 16; ch++) midi_reset_controllers(ch);
+}
 
-            case 1: // Note On
-            {
-                // 1. Allocate Voice
-                int voice = allocate_voice(event.channel, event.note);
-                
-                // 2. Load Instrument
-                if (event.channel == 9) { // MIDI DRUMS
-                    load_drum_patch(voice, event.note);
-                } 
-                else {
-                    // MELODIC
-                    uint8_t prog = midi_get_program(event.channel);
-                    load_gm_instrument(voice, prog);
+static void process_event(const SongEvent *event) {
+    switch (event->type) {
+        case 0: // Note Off
+        {
+            int voice = -1;
+            if (event->voice & VOICE_HINT_ASSIGNED) {
+                // Trust the hint only while the voice still has this note
+                int v = VOICE_HINT_VOICE(event->voice);
+                if (v < OPL2_VOICES && voices[v].active && !voices[v].layer &&
+                    voices[v].midi_channel == event->channel && voices[v].midi_note == event->note) {
+                    voice = v;
                 }
+            }
+            if (voice == -1) voice = find_active_voice(event->channel, event->note);
+            if (voice != -1) release_voice(voice);
+            break;
+        }
+
+        case 1: // Note On
+        {
+            if (event->channel == 9) { // MIDI DRUMS
+                if (!drum_hit_allowed(event->note)) break;
 
-                // 3. Play - Use actual MIDI velocity now that patches have proper headroom
-                apply_velocity(voice, event.velocity);
-                opl2_note_on(voice, event.note);
+                int voice = allocate_voice(9, event->note);
+                uint8_t pitch = load_drum_patch(voice, event->note);
+                modulation_note_on(voice, 9, pitch, 0, event->velocity);
                 break;
             }
 
-            case 3: // Program Change
-                midi_set_program(event.channel, event.note);
-                break;
-                
-            case 2: // Reset
-                for(int i=0; i<9; i++) opl2_note_off(i);
-                init_voices();
-                break;
-        }
-        
-        // Batch process ONLY zero-delay events (MIDI simultaneous notes)
-        // Events with delay_ms > 0 (from Song mode) must wait their turn
-        SongEvent peek_event;
-        while (queue_try_remove(&event_queue, &peek_event)) {
-            // If this event has a delay, put it back and stop batching
-            if (peek_event.delay_ms > 0) {
-                // Can't put it back, so we need to process it on next iteration
-                // This is a limitation - we'll just handle it next time through outer loop
-                // For now, add it back by processing with its delay
-                if (peek_event.delay_ms > 0) sleep_ms(peek_event.delay_ms);
-                
-                switch (peek_event.type) {
-                    case 0: {
-                        int voice = find_active_voice(peek_event.channel, peek_event.note);
-                        if (voice != -1) {
-                            opl2_note_off(voice);
-                            voices[voice].active = false;
-                        }
-                        break;
-                    }
-                    case 1: {
-                        int voice = allocate_voice(peek_event.channel, peek_event.note);
-                        if (peek_event.channel == 9) {
-                            load_drum_patch(voice, peek_event.note);
-                        } else {
-                            uint8_t prog = midi_get_program(peek_event.channel);
-                            load_gm_instrument(voice, prog);
-                        }
-                        apply_velocity(voice, peek_event.velocity);
-                        opl2_note_on(voice, peek_event.note);
-                        break;
-                    }
-                    case 3:
-                        midi_set_program(peek_event.channel, peek_event.note);
-                        break;
-                    case 2:
-                        for(int i=0; i<9; i++) opl2_note_off(i);
-                        init_voices();
-                        break;
-                }
-                break; // Stop batching - next event needs its delay
+            // MELODIC - double-voice programs take a pair of voices
+            uint8_t prog = midi_get_program(event->channel);
+            OPL_Instrument inst;
+            bank_get_instrument(prog, &inst);
+
+            // 1. Allocate Voice(s) - songs converted with --prealloc name the voice
+            // (planned for single-voice patches, so a double-voice bank allocates live)
+            int second = -1;
+            int voice;
+            if ((event->voice & VOICE_HINT_ASSIGNED) && !inst.double_voice) {
+                voice = assign_voice(VOICE_HINT_VOICE(event->voice), event->channel, event->note);
+            } else {
+                voice = allocate_voices(event->channel, event->note, prog, inst.double_voice, &second);
+            }
+
+            melodic_note_ons++;
+            if (voices[voice].preloaded && get_channel_program(voice) == prog &&
+                get_channel_layer(voice) == 0) {
+                preloaded_note_ons++;
             }
+            voices[voice].preloaded = false;
+            if (second >= 0) voices[second].preloaded = false;
+
+            // 2. Load Instrument (skipped if the voice already holds it)
+            load_instrument_layer(voice, prog, 0);
+            if (second >= 0) load_instrument_layer(second, prog, 1);
+
+            // 3. Play - Use actual MIDI velocity now that patches have proper headroom
+            // (the control tick takes the note's pitch and level on from here)
+            modulation_note_on(voice, event->channel, offset_note(event->note, inst.note_offset[0]), 0,
+                               event->velocity);
+            if (second >= 0) {
+                modulation_note_on(second, event->channel, offset_note(event->note, inst.note_offset[1]),
+                                   inst.fine_tune, event->velocity);
+            }
+            break;
+        }
+
+        case 3: // Program Change
+            midi_set_program(event->channel, event->note);
+            break;
+
+        case 4: // Control Change (note = controller, velocity = value)
+            handle_control_change(event->channel, event->note, event->velocity);
+            break;
             
-            // Zero-delay event - process immediately
-            switch (peek_event.type) {
-                case 0: // Note Off
-                {
-                    int voice = find_active_voice(peek_event.channel, peek_event.note);
-                    if (voice != -1) {
-                        opl2_note_off(voice);
-                        voices[voice].active = false;
-                    }
-                    break;
-                }
+        case 5: // Patch Update (data waits in patch_queue)
+            apply_patch_updates();
+            break;
 
-                case 1: // Note On
-                {
-                    int voice = allocate_voice(peek_event.channel, peek_event.note);
-                    if (peek_event.channel == 9) {
-                        load_drum_patch(voice, peek_event.note);
-                    } else {
-                        uint8_t prog = midi_get_program(peek_event.channel);
-                        load_gm_instrument(voice, prog);
-                    }
-                    apply_velocity(voice, peek_event.velocity);
-                    opl2_note_on(voice, peek_event.note);
-                    break;
-                }
+        case 6: // Bank Select (note = bank number)
+            if (bank_select(event->note)) refresh_program_voices(PATCH_NONE);
+            break;
+
+        case 7: // Prefetch (note = program) - hint from the song lookahead
+            prefetch_program(event->note, event->voice);
+            break;
+
+        case 8: // Stream Run (channel:note:velocity = 24-bit stream offset)
+            opl2_stream_run(((uint32_t)event->channel << 16) | (event->note << 8) | event->velocity);
+            break;
+
+        case 9: // Register Write (note = register, velocity = data) - tracker playback
+            opl2_write(event->note, modulation_channel_write(event->note, event->velocity));
+            invalidate_channel_programs();  // The voice manager's patches are gone
+            break;
+
+        case 10: // Pitch Bend (note = LSB, velocity = MSB) - voices follow on the control tick
+            midi_set_pitch_bend(event->channel, (int16_t)(((event->velocity << 7) | event->note) - 8192));
+            break;
+
+        case 11: // Fade (note = FADE_*, channel:velocity = ramp time in ms) - runs on the control tick
+            modulation_fade(event->note, (uint16_t)((event->channel << 8) | event->velocity));
+            break;
+
+        case 12: // Drum Patch (note = GM drum note) - loaded on the drum voice
+            load_drum_patch(DRUM_VOICE, event->note);
+            break;
+
+        case 13: // Layer Policy (note = layer_policy_t) - taken up by the channel's next notes
+            midi_set_layer_policy(event->channel, (layer_policy_t)event->note);
+            break;
+
+        case 14: // Tracker Effect (channel = OPL channel, note = CHANNEL_FX_*, velocity = parameter)
+            modulation_channel_effect(event->channel, event->note, event->velocity);
+            break;
+            
+        case 2: // Reset
+            reset_engine();
+            break;
+    }
+}
+
+// --- CORE 1: THE AUDIO ENGINE ---
+
+// Publish the engine state if anything in it changed since last time
+static void publish_snapshot(void) {
+    for (uint8_t v = 0; v < OPL2_VOICES; v++) {
+        staged.voice_active[v] = voices[v].active;
+        staged.voice_channel[v] = voices[v].midi_channel;
+        staged.voice_note[v] = voices[v].midi_note;
+        staged.voice_level[v] = modulation_vu_level(v);
+    }
+    for (uint8_t ch = 0; ch < 16; ch++) staged.program[ch] = midi_get_program(ch);
+    staged.events = events_processed;
+    staged.note_ons = melodic_note_ons;
+    staged.load = load;
+
+    staged.generation = snapshot.generation;
+    if (memcmp(&staged, &snapshot, sizeof(staged)) == 0) return;
+    staged.generation = (snapshot_sequence >> 1) + 1;
+
+    snapshot_sequence++;
+    __dmb();
+    memcpy(&snapshot, &staged, sizeof(snapshot));
+    __dmb();
+    snapshot_sequence++;
+}
+
+// Close the load window once a second: busy time is what neither waiting
+// nor delays took, and the bus share of it is writes x OPL2_WRITE_US (the
+// chips' writes overlap, so spread over them)
+static void update_load(void) {
+    uint32_t now = time_us_32();
+    uint32_t elapsed = now - load_start_us;
+    if (elapsed < LOAD_WINDOW_US) return;
+
+    uint32_t writes = opl2_get_write_count() - load_writes_base;
+    uint32_t busy = elapsed - load_idle_us - load_delay_us;
+    uint32_t bus = writes * OPL2_WRITE_US / OPL2_CHIPS;
+    if (bus > busy) bus = busy;
 
-                case 3: // Program Change
-                    midi_set_program(peek_event.channel, peek_event.note);
-                    break;
-                    
-                case 2: // Reset
-                    for(int i=0; i<9; i++) opl2_note_off(i);
-                    init_voices();
-                    break;
+    load.work = (uint16_t)((uint64_t)(busy - bus) * 1000 / elapsed);
+    load.bus = (uint16_t)((uint64_t)bus * 1000 / elapsed);
+    load.delay = (uint16_t)((uint64_t)load_delay_us * 1000 / elapsed);
+    load.idle = (uint16_t)((uint64_t)load_idle_us * 1000 / elapsed);
+    load.writes = writes;
+
+    load_start_us = now;
+    load_idle_us = 0;
+    load_delay_us = 0;
+    load_writes_base += writes;
+    publish_snapshot();
+}
+
+// Sleep until an event or the deadline, counted as idle. The batch's
+// register writes go out first (queued so the chips' writes interleave)
+static void wait_idle(absolute_time_t until) {
+    opl2_flush();
+    uint32_t start = time_us_32();
+    best_effort_wfe_or_timeout(until);
+    load_idle_us += time_us_32() - start;
+}
+
+// One control tick, timed
+static void run_tick(void) {
+    uint32_t start = time_us_32();
+    if (modulation_tick()) reset_engine();  // A stop has faded out
+    uint32_t cost = time_us_32() - start;
+
+    if (cost > tick_max_us) tick_max_us = cost;
+    tick_avg_q4 += (int32_t)((cost << 4) - tick_avg_q4) / 16;
+
+    // The VU meters move between events too
+    if (--ticks_to_publish == 0) {
+        ticks_to_publish = VU_PUBLISH_TICKS;
+        publish_snapshot();
+    }
+    update_load();
+}
+
+static void core1_entry(void) {
+    SongEvent event;
+    perf_init_core();
+    init_voices();
+    modulation_init();
+    absolute_time_t next_tick = make_timeout_time_us(MOD_TICK_US);
+    load_start_us = time_us_32();
+    load_writes_base = opl2_get_write_count();
+    
+    while (true) {
+        // Control tick when it falls due; a late tick is run once, not
+        // replayed, so a burst of events never turns into a burst of ticks
+        if (time_reached(next_tick)) {
+            run_tick();
+            next_tick = delayed_by_us(next_tick, MOD_TICK_US);
+            if (time_reached(next_tick)) next_tick = make_timeout_time_us(MOD_TICK_US);
+        }
+
+        // Then events - sleep until one arrives (queue adds wake us) or the next tick.
+        // Events queued behind a stop wait until it has faded out and reset
+        if (modulation_stopping()) {
+            wait_idle(next_tick);
+            continue;
+        }
+        if (!queue_try_remove(&event_queue, &event)) {
+            // End of a batch: let Core 0 see what it did
+            if (events_unpublished) {
+                events_unpublished = false;
+                publish_snapshot();
             }
+            wait_idle(next_tick);
+            continue;
+        }
+        
+        // Events with delay_ms > 0 (legacy song format) wait their turn
+        if (event.delay_ms > 0) {
+            opl2_flush();
+            uint32_t start = time_us_32();
+            sleep_ms(event.delay_ms);
+            load_delay_us += time_us_32() - start;
         }
+        PERF_BEGIN(CORE1_EVENT);
+        process_event(&event);
+        PERF_END(CORE1_EVENT);
+        events_processed++;
+        events_unpublished = true;
     }
 }
 
@@ -156,18 +448,89 @@ static void core1_entry(void) {
 
 void audio_engine_init(uint16_t queue_size) {
     queue_init(&event_queue, sizeof(SongEvent), queue_size);
+    event_queue_size = queue_size;
+    queue_init(&patch_queue, sizeof(PatchUpdate), PATCH_QUEUE_SIZE);
 }
 
 void audio_engine_start(void) {
+    opl2_flush();  // Setup writes go out before Core 1 takes the chip
     multicore_launch_core1(core1_entry);
 }
 
-void audio_engine_add_event(const SongEvent *event) {
+void audio_engine_process_event(const SongEvent *event) {
+    process_event(event);
+    opl2_flush();
+}
+
+bool audio_engine_add_event(const SongEvent *event) {
     // Use non-blocking to avoid MIDI lag - drop events if queue is full
-    if (!queue_try_add(&event_queue, event)) {
-        // Queue full - this shouldn't happen with 512 slots, but prevents blocking
-        // Could add a counter here to track drops if needed
+    bool added = queue_try_add(&event_queue, event);
+
+    // Core 0 adds from its tasks and from interrupts (the tracker's timer),
+    // so the counters are updated with interrupts off
+    uint32_t irq_state = save_and_disable_interrupts();
+    if (added) {
+        uint16_t level = (uint16_t)queue_get_level(&event_queue);
+        if (level > queue_peak) queue_peak = level;
+    } else {
+        queue_dropped++;
     }
+    restore_interrupts(irq_state);
+    return added;
+}
+
+void audio_engine_reset(void) {
+    SongEvent reset = { .type = 2, .delay_ms = 0 };
+    audio_engine_add_event(&reset);
+}
+
+void audio_engine_select_bank(uint8_t bank) {
+    SongEvent select = { .type = 6, .delay_ms = 0, .note = bank };
+    audio_engine_add_event(&select);
+}
+
+void audio_engine_load_drum_patch(uint8_t note) {
+    SongEvent load = { .type = 12, .delay_ms = 0, .channel = 9, .note = note };
+    audio_engine_add_event(&load);
+}
+
+void audio_engine_set_layer_policy(uint8_t channel, layer_policy_t policy) {
+    SongEvent set = { .type = 13, .delay_ms = 0, .channel = channel, .note = (uint8_t)policy };
+    audio_engine_add_event(&set);
+}
+
+bool audio_engine_update_patch(uint8_t program, const OPL_Patch *patch) {
+    PatchUpdate update = { .program = program, .patch = *patch };
+    if (!queue_try_add(&patch_queue, &update)) return false;
+
+    // Core 1 drains every pending update per type 5 event, so a lost
+    // notification only delays a patch until the next one
+    SongEvent notify = { .type = 5, .delay_ms = 0 };
+    audio_engine_add_event(&notify);
+    return true;
+}
+
+
+uint32_t audio_engine_get_snapshot(EngineSnapshot *out) {
+    uint32_t sequence;
+    do {
+        sequence = snapshot_sequence;
+        __dmb();
+        memcpy(out, &snapshot, sizeof(*out));
+        __dmb();
+    } while ((sequence & 1) || sequence != snapshot_sequence);
+    return out->generation;
+}
+
+void audio_engine_get_stats(EngineStats *out) {
+    out->note_ons = melodic_note_ons;
+    out->preloaded = preloaded_note_ons;
+    out->tick_avg_us = tick_avg_q4 >> 4;
+    out->tick_max_us = tick_max_us;
+    out->queue_level = (uint16_t)queue_get_level(&event_queue);
+    out->queue_peak = queue_peak;
+    out->queue_size = event_queue_size;
+    out->queue_dropped = queue_dropped;
 }
 
 void audio_engine_flush(void) {
@@ -3,12 +3,58 @@
  * 
  * Multi-Core Audio Engine
  * Runs on Core 1, processes MIDI events from queue and drives OPL2 synthesis
+ *
+ * Once audio_engine_start() has run, Core 1 is the only core that touches
+ * the chip (or the voice, patch and MIDI state behind it). Core 0 asks for
+ * patch loads, bank changes, resets and everything else through the event
+ * queue, which Core 1 works through in order between register writes, so
+ * no write from Core 0 can split one of Core 1's address/data pairs.
  */
 
 #ifndef AUDIO_ENGINE_H
 #define AUDIO_ENGINE_H
 
+#include <stdbool.h>
 #include "queue.h"
+#include "instruments.h"
+#include "midi_state.h"
+
+// How Core 1 spent the last second, in per mille (LOAD_WINDOW_US)
+typedef struct {
+    uint16_t work;            // Events and control ticks, bus writes aside
+    uint16_t bus;             // Register writes: writes x OPL2_WRITE_US, per chip
+    uint16_t delay;           // Legacy per-event delays (SongEvent.delay_ms)
+    uint16_t idle;            // Waiting for an event or the next tick
+    uint32_t writes;          // Register writes in the window
+} EngineLoad;
+
+#define LOAD_WINDOW_US 1000000
+
+// What Core 0 may know about the engine, published by Core 1 as a whole
+// (see audio_engine_get_snapshot) instead of read from its live state
+typedef struct {
+    uint32_t generation;      // Changes whenever anything below does
+    bool voice_active[OPL2_VOICES];
+    uint8_t voice_channel[OPL2_VOICES]; // MIDI channel and note a voice last played
+    uint8_t voice_note[OPL2_VOICES];
+    uint8_t voice_level[OPL2_VOICES];   // VU bar height, 0 to VU_STEPS (see modulation.h)
+    uint8_t program[16];      // Per MIDI channel
+    uint32_t events;          // Events processed since boot
+    uint32_t note_ons;        // Melodic Note Ons since boot
+    EngineLoad load;          // Core 1 time and chip bus use, updated each second
+} EngineSnapshot;
+
+// Engine counters since boot, for the console
+typedef struct {
+    uint32_t note_ons;        // Melodic Note Ons played
+    uint32_t preloaded;       // Of those, served by a voice a Prefetch (type 7) had loaded
+    uint32_t tick_avg_us;     // Control tick cost (see modulation.h): moving average
+    uint32_t tick_max_us;     // and worst
+    uint16_t queue_level;     // Events waiting now
+    uint16_t queue_peak;      // Most ever waiting
+    uint16_t queue_size;
+    uint32_t queue_dropped;   // Events lost to a full queue
+} EngineStats;
 
 /**
  * Initialize the audio engine
@@ -26,11 +72,82 @@ void audio_engine_start(void);
 
 /**
  * Add an event to the audio engine queue
- * Blocking call - waits if queue is full
+ * Never waits: with the queue full the event is dropped (and counted)
+ * Safe from Core 0 tasks and interrupts
  * 
  * @param event Pointer to SongEvent to add
+ * @return false if the event was dropped
+ */
+bool audio_engine_add_event(const SongEvent *event);
+
+/**
+ * Replace a bank patch while the engine runs
+ * The patch is handed to Core 1 and applied between events; voices already
+ * using the program are refreshed with only the registers that changed.
+ * Non-blocking and safe to call from an interrupt.
+ * 
+ * @param program Bank index (0-255)
+ * @param patch New patch data
+ * @return false if the update could not be queued
+ */
+bool audio_engine_update_patch(uint8_t program, const OPL_Patch *patch);
+
+/**
+ * Switch instrument bank (see bank.h)
+ * Applied on Core 1 in order with the notes; voices already sounding
+ * are refreshed with the new bank's patches
+ * 
+ * @param bank Bank number (0 = built-in, 1-8 = flash slots)
+ */
+void audio_engine_select_bank(uint8_t bank);
+
+/**
+ * Load the patch of a GM percussion note on the drum voice
+ * Applied on Core 1 in order with the notes (Drum Patch event, type 12)
+ * 
+ * @param note GM drum note (35-81)
+ */
+void audio_engine_load_drum_patch(uint8_t note);
+
+/**
+ * Choose how a channel plays double-voice instruments (see midi_state.h)
+ * Applied on Core 1 in order with the notes (Layer Policy event, type 13)
+ * 
+ * @param channel MIDI channel (0-15)
+ * @param policy LAYER_DROP or LAYER_KEEP
+ */
+void audio_engine_set_layer_policy(uint8_t channel, layer_policy_t policy);
+
+/**
+ * Silence everything and return voices and controllers to their defaults
+ * (Reset event, type 2)
+ */
+void audio_engine_reset(void);
+
+/**
+ * Read the engine state Core 1 last published
+ * Core 1 publishes after each batch of events and with the VU meters, and
+ * only when something changed; it never waits for the reader (seqlock)
+ * 
+ * @param out Filled with a consistent copy
+ * @return The snapshot's generation: unchanged means nothing to redraw
+ */
+uint32_t audio_engine_get_snapshot(EngineSnapshot *out);
+
+/**
+ * Read the engine's counters (see EngineStats)
+ * 
+ * @param out Filled with the current values
+ */
+void audio_engine_get_stats(EngineStats *out);
+
+/**
+ * Handle one event at once on the calling core, bypassing the queue
+ * For host tools that drive the engine without Core 1 (see songc/)
+ * 
+ * @param event Event to process
  */
-void audio_engine_add_event(const SongEvent *event);
+void audio_engine_process_event(const SongEvent *event);
 
 /**
  * Flush all pending events from the queue
@@ -0,0 +1,406 @@
+/**
+ * bank.c
+ *
+ * Instrument Bank Implementation
+ * Parses bank file headers once, then decodes patches from XIP on demand
+ */
+
+#include "bank.h"
+#include "hardware/regs/addressmap.h"
+#include <string.h>
+
+// --- FILE LAYOUTS ---
+
+// GENMIDI.OP2: 8-byte magic, 175 x 36-byte instruments, 175 x 32-byte names
+#define OP2_INSTRUMENTS   175
+#define OP2_RECORD_SIZE   36
+#define OP2_NAME_SIZE     32
+#define OP2_VOICE1        4     // Flags (2), fine tune, fixed note, then voice 1
+#define OP2_FLAG_FIXED    0x01  // Always play at the fixed note
+#define OP2_FLAG_DOUBLE   0x04  // Both voices sound together
+#define OP2_FINE_TUNE     2     // Second voice detune, 128 = none
+#define OP2_VOICE_SIZE    16
+#define OP2_NOTE_OFFSET   14    // Per-voice note offset (int16 LE)
+#define OP2_FIXED_NOTE    3
+
+// WOPL: 19-byte header, bank names (v2+), then 128 instruments per bank
+#define WOPL_HEADER_SIZE  19
+#define WOPL_BANK_META    34
+#define WOPL_NAME_SIZE    32
+#define WOPL_FLAGS        39
+#define WOPL_FLAG_PSEUDO4 0x02  // Two 2-op voices layered (true 4-op needs an OPL3)
+#define WOPL_FLAG_BLANK   0x04
+#define WOPL_NOTE_OFFSET1 32    // int16 BE semitones, voice 2 follows
+#define WOPL_DETUNE       37    // Second voice detune in 1/64 semitone
+#define WOPL_DRUM_KEY     38    // Percussion key number (0 = play the note itself)
+#define WOPL_FB_CONN1     40
+#define WOPL_OPERATORS    42    // Carrier 1, Modulator 1, Carrier 2, Modulator 2 (5 bytes each)
+
+// IBK: 4-byte magic, 128 x 16-byte SBI records, 128 x 9-byte names
+#define IBK_INSTRUMENTS   128
+#define SBI_RECORD_SIZE   16
+#define IBK_NAME_SIZE     9
+
+// SBI: 4-byte magic, 32-byte name, one record
+#define SBI_NAME_SIZE     32
+
+// Where a parsed bank's records live (all pointers into XIP flash)
+typedef struct {
+    bank_format_t format;
+    const uint8_t *melodic;      // Record for program 0
+    const uint8_t *percussion;   // Record for percussion program 128, or NULL
+    const uint8_t *names;        // Name table (OP2, IBK) or NULL if names are in the records
+    uint16_t melodic_count;
+    uint16_t percussion_count;
+    uint8_t record_size;
+} BankInfo;
+
+static BankInfo banks[BANK_COUNT];
+static volatile uint8_t current_bank = BANK_BUILTIN;
+
+// Copy-on-write edits of the current bank
+typedef struct {
+    uint8_t program;
+    OPL_Patch patch;
+} BankOverride;
+
+static BankOverride overrides[BANK_OVERRIDE_SLOTS];
+static uint8_t override_count = 0;
+static uint8_t override_map[256 / 8];  // Programs that have an override
+
+static const uint8_t* slot_address(uint8_t slot) {
+    return (const uint8_t*)(uintptr_t)(XIP_BASE + BANK_FLASH_OFFSET + (uint32_t)slot * BANK_SLOT_SIZE);
+}
+
+static uint16_t read_u16_le(const uint8_t *p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+static uint16_t read_u16_be(const uint8_t *p) { return (uint16_t)((p[0] << 8) | p[1]); }
+
+// --- HEADER PARSING ---
+
+static bool parse_bank(const uint8_t *data, BankInfo *info) {
+    memset(info, 0, sizeof(*info));
+
+    if (memcmp(data, "#OPL_II#", 8) == 0) {
+        info->format = BANK_FORMAT_OP2;
+        info->record_size = OP2_RECORD_SIZE;
+        info->melodic = data + 8;
+        info->melodic_count = 128;
+        info->percussion = data + 8 + 128 * OP2_RECORD_SIZE;
+        info->percussion_count = OP2_INSTRUMENTS - 128;
+        info->names = data + 8 + OP2_INSTRUMENTS * OP2_RECORD_SIZE;
+        return true;
+    }
+
+    if (memcmp(data, "WOPL3-BANK", 11) == 0) {  // Includes the terminating NUL
+        uint16_t version = read_u16_le(data + 11);
+        uint16_t melodic_banks = read_u16_be(data + 13);
+        uint16_t percussion_banks = read_u16_be(data + 15);
+        if (version == 0 || melodic_banks == 0) return false;
+
+        uint32_t record_size = version >= 3 ? 66 : 62;  // v3 adds key-on/off delays
+        uint32_t offset = WOPL_HEADER_SIZE;
+        if (version >= 2) offset += (uint32_t)(melodic_banks + percussion_banks) * WOPL_BANK_META;
+
+        // Only the first bank of each kind is used (GM bank 0)
+        uint32_t melodic_end = offset + 128 * record_size;
+        if (melodic_end > BANK_SLOT_SIZE) return false;
+
+        info->format = BANK_FORMAT_WOPL;
+        info->record_size = (uint8_t)record_size;
+        info->melodic = data + offset;
+        info->melodic_count = 128;
+
+        uint32_t percussion_offset = offset + (uint32_t)melodic_banks * 128 * record_size;
+        if (percussion_banks > 0 && percussion_offset + 128 * record_size <= BANK_SLOT_SIZE) {
+            // Percussion records are indexed by note; program 128 is note 35
+            info->percussion = data + percussion_offset + DRUM_NOTE_FIRST * record_size;
+            info->percussion_count = 128 - DRUM_NOTE_FIRST;
+        }
+        return true;
+    }
+
+    if (memcmp(data, "IBK\x1A", 4) == 0) {
+        info->format = BANK_FORMAT_IBK;
+        info->record_size = SBI_RECORD_SIZE;
+        info->melodic = data + 4;
+        info->melodic_count = IBK_INSTRUMENTS;
+        info->names = data + 4 + IBK_INSTRUMENTS * SBI_RECORD_SIZE;
+        return true;
+    }
+
+    if (memcmp(data, "SBI\x1A", 4) == 0) {
+        info->format = BANK_FORMAT_SBI;
+        info->record_size = SBI_RECORD_SIZE;
+        info->melodic = data + 4 + SBI_NAME_SIZE;
+        info->melodic_count = 1;
+        info->names = data + 4;
+        return true;
+    }
+
+    return false;
+}
+
+// --- RECORD DECODING ---
+
+// SBI/IBK: register values paired modulator/carrier
+static void decode_sbi(const uint8_t *r, OPL_Patch *out) {
+    out->m_ave = r[0];    out->c_ave = r[1];
+    out->m_ksl = r[2];    out->c_ksl = r[3];
+    out->m_atdec = r[4];  out->c_atdec = r[5];
+    out->m_susrel = r[6]; out->c_susrel = r[7];
+    out->m_wave = r[8];   out->c_wave = r[9];
+    out->feedback = r[10];
+}
+
+static int8_t clamp_offset(int16_t offset) {
+    if (offset < -48) return -48;
+    if (offset > 48) return 48;
+    return (int8_t)offset;
+}
+
+// OP2 voice: modulator 0x20/0x60/0x80/0xE0, KSL, level, feedback, then the carrier
+static void decode_op2(const uint8_t *v, OPL_Patch *out) {
+    out->m_ave = v[0];  out->m_atdec = v[1];  out->m_susrel = v[2];  out->m_wave = v[3];
+    out->m_ksl = (v[4] & 0xC0) | (v[5] & 0x3F);
+    out->feedback = v[6];
+    out->c_ave = v[7];  out->c_atdec = v[8];  out->c_susrel = v[9];  out->c_wave = v[10];
+    out->c_ksl = (v[11] & 0xC0) | (v[12] & 0x3F);
+}
+
+// WOPL voice (0 or 1) - operator bytes 0x20, 0x40, 0x60, 0x80, 0xE0
+static void decode_wopl(const uint8_t *r, int voice, OPL_Patch *out) {
+    const uint8_t *c = r + WOPL_OPERATORS + voice * 10;
+    const uint8_t *m = c + 5;
+    out->m_ave = m[0];  out->m_ksl = m[1];  out->m_atdec = m[2];  out->m_susrel = m[3];  out->m_wave = m[4];
+    out->c_ave = c[0];  out->c_ksl = c[1];  out->c_atdec = c[2];  out->c_susrel = c[3];  out->c_wave = c[4];
+    out->feedback = r[WOPL_FB_CONN1 + voice];
+}
+
+// Record for a program in a parsed bank, or NULL if the file doesn't define it
+static const uint8_t* find_record(const BankInfo *info, uint8_t program) {
+    const uint8_t *record = NULL;
+
+    if (program < 128) {
+        if (program < info->melodic_count) record = info->melodic + (uint32_t)program * info->record_size;
+    } else if (info->percussion && program - 128 < info->percussion_count) {
+        record = info->percussion + (uint32_t)(program - 128) * info->record_size;
+    }
+
+    if (record && info->format == BANK_FORMAT_WOPL && (record[WOPL_FLAGS] & WOPL_FLAG_BLANK)) {
+        return NULL;
+    }
+    return record;
+}
+
+// The bank's own patch for a program, ignoring overrides
+static void decode_patch(const BankInfo *info, uint8_t program, OPL_Patch *out) {
+    const uint8_t *record = find_record(info, program);
+    if (!record) {
+        *out = builtin_bank[program];
+        return;
+    }
+
+    switch (info->format) {
+        case BANK_FORMAT_OP2:  decode_op2(record + OP2_VOICE1, out); break;
+        case BANK_FORMAT_WOPL: decode_wopl(record, 0, out); break;
+        case BANK_FORMAT_IBK:
+        case BANK_FORMAT_SBI:  decode_sbi(record, out); break;
+        default:               *out = builtin_bank[program]; break;
+    }
+}
+
+// --- OVERRIDES ---
+
+static int find_override(uint8_t program) {
+    if (!(override_map[program >> 3] & (1 << (program & 7)))) return -1;
+    for (int i = 0; i < override_count; i++) {
+        if (overrides[i].program == program) return i;
+    }
+    return -1;
+}
+
+static void clear_overrides(void) {
+    override_count = 0;
+    memset(override_map, 0, sizeof(override_map));
+}
+
+// --- PUBLIC API ---
+
+void bank_init(void) {
+    memset(&banks[BANK_BUILTIN], 0, sizeof(BankInfo));
+    banks[BANK_BUILTIN].format = BANK_FORMAT_BUILTIN;
+
+    for (uint8_t slot = 0; slot < BANK_FLASH_SLOTS; slot++) {
+        if (!parse_bank(slot_address(slot), &banks[1 + slot])) {
+            banks[1 + slot].format = BANK_FORMAT_NONE;
+        }
+    }
+
+    current_bank = BANK_BUILTIN;
+    clear_overrides();
+}
+
+bool bank_select(uint8_t bank) {
+    if (bank >= BANK_COUNT || banks[bank].format == BANK_FORMAT_NONE) return false;
+    clear_overrides();
+    current_bank = bank;
+    return true;
+}
+
+uint8_t bank_get_current(void) {
+    return current_bank;
+}
+
+bank_format_t bank_get_format(uint8_t bank) {
+    if (bank >= BANK_COUNT) return BANK_FORMAT_NONE;
+    return banks[bank].format;
+}
+
+const char* bank_format_name(bank_format_t format) {
+    switch (format) {
+        case BANK_FORMAT_BUILTIN: return "GM";
+        case BANK_FORMAT_OP2:     return "OP2";
+        case BANK_FORMAT_WOPL:    return "WOPL";
+        case BANK_FORMAT_IBK:     return "IBK";
+        case BANK_FORMAT_SBI:     return "SBI";
+        default:                  return "---";
+    }
+}
+
+uint8_t bank_next(uint8_t bank) {
+    for (uint8_t i = 1; i <= BANK_COUNT; i++) {
+        uint8_t candidate = (bank + i) % BANK_COUNT;
+        if (banks[candidate].format != BANK_FORMAT_NONE) return candidate;
+    }
+    return BANK_BUILTIN;
+}
+
+void bank_get_patch(uint8_t program, OPL_Patch *out) {
+    int slot = find_override(program);
+    if (slot >= 0) {
+        *out = overrides[slot].patch;
+        return;
+    }
+    decode_patch(&banks[current_bank], program, out);
+}
+
+void bank_get_instrument(uint8_t program, OPL_Instrument *out) {
+    const BankInfo *info = &banks[current_bank];
+    const uint8_t *record = find_record(info, program);
+
+    bank_get_patch(program, &out->voice[0]);
+    out->voice[1] = out->voice[0];
+    out->note_offset[0] = 0;
+    out->note_offset[1] = 0;
+    out->fine_tune = 0;
+    out->double_voice = false;
+    if (!record) return;
+
+    if (info->format == BANK_FORMAT_OP2) {
+        const uint8_t *v1 = record + OP2_VOICE1;
+        const uint8_t *v2 = v1 + OP2_VOICE_SIZE;
+        out->note_offset[0] = clamp_offset((int16_t)read_u16_le(v1 + OP2_NOTE_OFFSET));
+        if (read_u16_le(record) & OP2_FLAG_DOUBLE) {
+            decode_op2(v2, &out->voice[1]);
+            out->note_offset[1] = clamp_offset((int16_t)read_u16_le(v2 + OP2_NOTE_OFFSET));
+            out->fine_tune = (int8_t)(record[OP2_FINE_TUNE] / 2 - 64);
+            out->double_voice = true;
+        }
+    } else if (info->format == BANK_FORMAT_WOPL) {
+        out->note_offset[0] = clamp_offset((int16_t)read_u16_be(record + WOPL_NOTE_OFFSET1));
+        if (record[WOPL_FLAGS] & WOPL_FLAG_PSEUDO4) {
+            decode_wopl(record, 1, &out->voice[1]);
+            out->note_offset[1] = clamp_offset((int16_t)read_u16_be(record + WOPL_NOTE_OFFSET1 + 2));
+            out->fine_tune = (int8_t)((int8_t)record[WOPL_DETUNE] / 2);
+            out->double_voice = true;
+        }
+    }
+}
+
+void bank_get_name(uint8_t program, char *out, size_t size) {
+    const BankInfo *info = &banks[current_bank];
+    const char *name = NULL;
+    size_t max_len = 0;
+
+    if (find_record(info, program)) {
+        switch (info->format) {
+            case BANK_FORMAT_OP2:
+                name = (const char*)info->names + (uint32_t)program * OP2_NAME_SIZE;
+                max_len = OP2_NAME_SIZE;
+                break;
+            case BANK_FORMAT_WOPL:
+                name = (const char*)find_record(info, program);
+                max_len = WOPL_NAME_SIZE;
+                break;
+            case BANK_FORMAT_IBK:
+                name = (const char*)info->names + (uint32_t)program * IBK_NAME_SIZE;
+                max_len = IBK_NAME_SIZE;
+                break;
+            case BANK_FORMAT_SBI:
+                name = (const char*)info->names;
+                max_len = SBI_NAME_SIZE;
+                break;
+            default:
+                break;
+        }
+    }
+
+    // Unnamed entries show the built-in name
+    if (!name || name[0] == '\0') {
+        name = patch_names[program];
+        max_len = size;
+    }
+
+    size_t len = 0;
+    while (len + 1 < size && len < max_len && name[len] != '\0') {
+        out[len] = name[len];
+        len++;
+    }
+    if (size > 0) out[len] = '\0';
+}
+
+bool bank_set_override(uint8_t program, const OPL_Patch *patch) {
+    int slot = find_override(program);
+
+    // Restoring the bank's own patch needs no RAM copy
+    OPL_Patch original;
+    decode_patch(&banks[current_bank], program, &original);
+    if (memcmp(&original, patch, sizeof(OPL_Patch)) == 0) {
+        if (slot >= 0) {
+            overrides[slot] = overrides[--override_count];
+            override_map[program >> 3] &= (uint8_t)~(1 << (program & 7));
+        }
+        return true;
+    }
+
+    if (slot < 0) {
+        if (override_count >= BANK_OVERRIDE_SLOTS) return false;
+        slot = override_count++;
+        overrides[slot].program = program;
+        override_map[program >> 3] |= (uint8_t)(1 << (program & 7));
+    }
+    overrides[slot].patch = *patch;
+    return true;
+}
+
+bool bank_get_drum(uint8_t note, uint8_t *program, uint8_t *pitch) {
+    const BankInfo *info = &banks[current_bank];
+    if (!info->percussion || note < DRUM_NOTE_FIRST) return false;
+
+    uint8_t drum_program = (uint8_t)(128 + note - DRUM_NOTE_FIRST);
+    const uint8_t *record = find_record(info, drum_program);
+    if (!record) return false;
+
+    *program = drum_program;
+    *pitch = note;
+    if (info->format == BANK_FORMAT_OP2) {
+        if (read_u16_le(record) & OP2_FLAG_FIXED) *pitch = record[OP2_FIXED_NOTE];
+    } else if (info->format == BANK_FORMAT_WOPL) {
+        if (record[WOPL_DRUM_KEY] != 0) *pitch = record[WOPL_DRUM_KEY];
+    }
+    return true;
+}
+
+uint8_t bank_get_override_count(void) {
+    return override_count;
+}
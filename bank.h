@@ -0,0 +1,154 @@
+/**
+ * bank.h
+ *
+ * Instrument Banks
+ * Built-in bank plus AdLib bank files read in place from a flash partition
+ *
+ * FLASH LAYOUT
+ * ------------
+ * BANK_FLASH_SLOTS slots of BANK_SLOT_SIZE bytes starting BANK_FLASH_OFFSET
+ * into flash. Each slot holds one unmodified bank file:
+ *
+ *   GENMIDI.OP2   "#OPL_II#"      175 instruments (128 melodic + 47 drums)
+ *   WOPL          "WOPL3-BANK"    first melodic and first percussion bank
+ *   IBK           "IBK\x1A"       128 SBI instruments with names
+ *   SBI           "SBI\x1A"       single instrument (program 0)
+ *
+ * Write a file to slot n without rebuilding the firmware, e.g.
+ *   picotool load -t bin GENMIDI.OP2 -o 0x10100000    (slot 0)
+ *   picotool load -t bin bank.wopl   -o 0x10108000    (slot 1)
+ *
+ * Files are decoded straight from XIP flash when a patch is loaded, so a
+ * bank costs no RAM and switching is a single index change. Programs a
+ * file doesn't define (blank, or beyond its instrument count) fall back
+ * to the built-in bank.
+ *
+ * PROGRAM NUMBERS
+ * ---------------
+ * 0-127 are the melodic instruments. Loaded banks put percussion at
+ * 128 + (note - 35), so GM drum note 35 is program 128.
+ *
+ * OVERRIDES
+ * ---------
+ * Runtime edits (SysEx, editor) are copy-on-write: only edited programs get
+ * a RAM copy, from a pool of BANK_OVERRIDE_SLOTS. An edit that restores the
+ * bank's own patch frees its slot. Switching banks drops all overrides.
+ */
+
+#ifndef BANK_H
+#define BANK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "instruments.h"
+
+#define BANK_FLASH_OFFSET   (1024 * 1024)  // 1 MB into flash, clear of the firmware
+#define BANK_SLOT_SIZE      (32 * 1024)
+#define BANK_FLASH_SLOTS    8
+
+#define BANK_BUILTIN        0                      // Bank 0 is compiled in
+#define BANK_COUNT          (1 + BANK_FLASH_SLOTS) // Bank n (1-8) is flash slot n-1
+
+#define BANK_OVERRIDE_SLOTS 32
+
+typedef enum {
+    BANK_FORMAT_NONE,      // Empty or unrecognised slot
+    BANK_FORMAT_BUILTIN,
+    BANK_FORMAT_OP2,
+    BANK_FORMAT_WOPL,
+    BANK_FORMAT_IBK,
+    BANK_FORMAT_SBI
+} bank_format_t;
+
+/**
+ * Scan the flash slots for bank files
+ * Call once at boot before the audio engine starts
+ */
+void bank_init(void);
+
+/**
+ * Make a bank current (Core 1 - see audio_engine_select_bank())
+ * Drops all overrides; voices keep their registers until refreshed
+ *
+ * @param bank Bank number (0 = built-in, 1-8 = flash slots)
+ * @return false if the bank holds no valid file
+ */
+bool bank_select(uint8_t bank);
+
+/**
+ * Get the current bank number
+ */
+uint8_t bank_get_current(void);
+
+/**
+ * Format of the file in a bank
+ *
+ * @param bank Bank number
+ * @return BANK_FORMAT_NONE if the slot is empty
+ */
+bank_format_t bank_get_format(uint8_t bank);
+
+/**
+ * Short format name for display ("GM", "OP2", "WOPL", ...)
+ */
+const char* bank_format_name(bank_format_t format);
+
+/**
+ * Next bank after this one that holds a valid file (wraps to built-in)
+ */
+uint8_t bank_next(uint8_t bank);
+
+/**
+ * Decode a program of the current bank, including overrides
+ *
+ * @param program Program number (0-255)
+ * @param out Patch data
+ */
+void bank_get_patch(uint8_t program, OPL_Patch *out);
+
+/**
+ * Decode a program with both voices and its tuning
+ * Voice 0 honours overrides; single-voice programs repeat it as voice 1
+ *
+ * @param program Program number (0-255)
+ * @param out Instrument data
+ */
+void bank_get_instrument(uint8_t program, OPL_Instrument *out);
+
+/**
+ * Copy a program's name from the current bank
+ *
+ * @param program Program number (0-255)
+ * @param out Buffer, always NUL terminated
+ * @param size Buffer size
+ */
+void bank_get_name(uint8_t program, char *out, size_t size);
+
+/**
+ * Percussion patch and pitch from the current bank file
+ * Used ahead of the built-in drum map when the file has percussion
+ * (OP2 drums honour their fixed-pitch flag, WOPL its key number)
+ *
+ * @param note GM percussion note
+ * @param program Program to load (128 + note - 35)
+ * @param pitch Note to play it at
+ * @return false if the bank doesn't define this drum
+ */
+bool bank_get_drum(uint8_t note, uint8_t *program, uint8_t *pitch);
+
+/**
+ * Replace a program in the current bank with a RAM copy (Core 1)
+ *
+ * @param program Program number (0-255)
+ * @param patch New patch data
+ * @return false if the override pool is full (program unchanged)
+ */
+bool bank_set_override(uint8_t program, const OPL_Patch *patch);
+
+/**
+ * Number of override slots in use
+ */
+uint8_t bank_get_override_count(void);
+
+#endif // BANK_H
@@ -0,0 +1,374 @@
+/**
+ * console.c
+ *
+ * USB Serial Console Implementation
+ */
+
+#include "console.h"
+#include "audio_engine.h"
+#include "scheduler.h"
+#include "song_player.h"
+#include "midi_input.h"
+#include "bank.h"
+#include "sysex.h"
+#include "lcd.h"
+#include "opl2.h"
+#include "opl2_hardware.h"
+#include "opl2_stream.h"
+#include "perf.h"
+#include "pico/stdio.h"
+#include "tusb.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Output ring (Core 0 only)
+static char tx_ring[CONSOLE_TX_SIZE];
+static uint16_t tx_head = 0;
+static uint16_t tx_tail = 0;
+
+// Command being typed
+static char line[CONSOLE_LINE_MAX];
+static uint8_t line_length = 0;
+
+// Register trace: Core 1 adds, Core 0 drains (single producer, single consumer)
+static uint32_t trace_ring[CONSOLE_TRACE_SIZE];  // chip << 16 | reg << 8 | data
+static volatile uint16_t trace_head = 0;
+static volatile uint16_t trace_tail = 0;
+static volatile uint32_t trace_dropped = 0;
+
+// --- OUTPUT ---
+
+static void tx_put(const char *text, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        uint16_t next = (tx_head + 1) & (CONSOLE_TX_SIZE - 1);
+        if (next == tx_tail) return;  // Full: drop the rest
+        tx_ring[tx_head] = text[i];
+        tx_head = next;
+    }
+}
+
+void console_printf(const char *format, ...) {
+    if (!tud_cdc_connected()) return;
+
+    char text[96];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+    if (length <= 0) return;
+    if (length >= (int)sizeof(text)) length = sizeof(text) - 1;
+    tx_put(text, (size_t)length);
+}
+
+// printf() from the other modules lands in the same ring (Core 0 only;
+// the SDK has already turned \n into \r\n)
+static void stdio_out_chars(const char *buf, int length) {
+    if (!tud_cdc_connected()) return;
+    tx_put(buf, (size_t)length);
+}
+
+static stdio_driver_t console_stdio = {
+    .out_chars = stdio_out_chars,
+#if PICO_STDIO_ENABLE_CRLF_SUPPORT
+    .crlf_enabled = PICO_STDIO_DEFAULT_CRLF
+#endif
+};
+
+void console_init(void) {
+    stdio_set_driver_enabled(&console_stdio, true);
+}
+
+// Hand what fits to the CDC endpoint; with no host listening, forget it
+static void tx_drain(void) {
+    if (!tud_cdc_connected()) {
+        tx_tail = tx_head;
+        return;
+    }
+
+    while (tx_tail != tx_head) {
+        uint32_t space = tud_cdc_write_available();
+        if (space == 0) break;
+
+        // Contiguous run up to the end of the ring or the head
+        uint16_t end = tx_head > tx_tail ? tx_head : CONSOLE_TX_SIZE;
+        uint32_t count = end - tx_tail;
+        if (count > space) count = space;
+        tud_cdc_write(&tx_ring[tx_tail], count);
+        tx_tail = (tx_tail + count) & (CONSOLE_TX_SIZE - 1);
+    }
+    tud_cdc_write_flush();
+}
+
+// --- REGISTER TRACE (Core 1 side) ---
+
+static void trace_write(uint8_t chip, uint8_t reg, uint8_t data) {
+    uint16_t next = (trace_head + 1) & (CONSOLE_TRACE_SIZE - 1);
+    if (next == trace_tail) {
+        trace_dropped++;
+        return;
+    }
+    trace_ring[trace_head] = ((uint32_t)chip << 16) | (reg << 8) | data;
+    trace_head = next;
+}
+
+// The console shows raw writes only, so it leaves the note hooks out
+static const OPL2Trace tracer = {
+    .write = trace_write
+};
+
+// Print what the trace caught, as much as the output ring takes
+static void trace_drain(void) {
+    while (trace_tail != trace_head) {
+        if (((tx_tail - tx_head - 1) & (CONSOLE_TX_SIZE - 1)) < 12) break;
+        uint32_t entry = trace_ring[trace_tail];
+        trace_tail = (trace_tail + 1) & (CONSOLE_TRACE_SIZE - 1);
+        if (OPL2_CHIPS > 1) console_printf("%lu:", (unsigned long)(entry >> 16));
+        console_printf("%02X=%02X\r\n", (unsigned)(entry >> 8) & 0xFF, (unsigned)entry & 0xFF);
+    }
+
+    uint32_t dropped = trace_dropped;
+    if (dropped) {
+        trace_dropped = 0;
+        console_printf("(trace: %lu writes dropped)\r\n", (unsigned long)dropped);
+    }
+}
+
+// --- COMMANDS ---
+
+// Per mille as "12.3%"
+static void print_share(const char *label, uint16_t permille) {
+    console_printf(" %s %u.%u%%", label, permille / 10, permille % 10);
+}
+
+static void show_load(const EngineLoad *load) {
+    console_printf("Core 1 last second:");
+    print_share("work", load->work);
+    print_share("bus", load->bus);
+    print_share("delay", load->delay);
+    print_share("idle", load->idle);
+    console_printf("\r\nOPL2 bus %lu writes/s of %lu max\r\n", (unsigned long)load->writes,
+                   (unsigned long)(LOAD_WINDOW_US / OPL2_WRITE_US * OPL2_CHIPS));
+}
+
+static void show_stats(void) {
+    EngineSnapshot snap;
+    EngineStats stats;
+    audio_engine_get_snapshot(&snap);
+    audio_engine_get_stats(&stats);
+
+    console_printf("Events %lu, note-ons %lu (%lu prefetched)\r\n", (unsigned long)snap.events,
+                   (unsigned long)stats.note_ons, (unsigned long)stats.preloaded);
+    console_printf("Control tick %lu us average, %lu us worst\r\n",
+                   (unsigned long)stats.tick_avg_us, (unsigned long)stats.tick_max_us);
+    console_printf("Queue %u/%u, peak %u, dropped %lu\r\n", stats.queue_level, stats.queue_size,
+                   stats.queue_peak, (unsigned long)stats.queue_dropped);
+    show_load(&snap.load);
+
+    SchedStats task;
+    for (uint8_t i = 0; scheduler_get_stats(i, &task); i++) {
+        console_printf("Core 0 %-5s %5lu us worst (budget %lu), %lu overruns\r\n", task.name,
+                       (unsigned long)task.max_us, (unsigned long)task.budget_us,
+                       (unsigned long)task.overruns);
+    }
+    console_printf("LCD %lu I2C bytes\r\n", (unsigned long)lcd_get_i2c_bytes());
+}
+
+static void show_voices(void) {
+    EngineSnapshot snap;
+    audio_engine_get_snapshot(&snap);
+    for (uint8_t v = 0; v < OPL2_VOICES; v++) {
+        if (snap.voice_active[v] || snap.voice_level[v]) {
+            console_printf("%u: ch %2u note %3u level %u%s\r\n", v, snap.voice_channel[v] + 1,
+                           snap.voice_note[v], snap.voice_level[v], snap.voice_active[v] ? "" : " (releasing)");
+        } else {
+            console_printf("%u: -\r\n", v);
+        }
+    }
+}
+
+static void show_queue(void) {
+    EngineStats stats;
+    audio_engine_get_stats(&stats);
+    console_printf("Queue %u/%u, peak %u, dropped %lu\r\n", stats.queue_level, stats.queue_size,
+                   stats.queue_peak, (unsigned long)stats.queue_dropped);
+}
+
+// DIN/USB merge policy, in midi_merge_t order
+static const char *const merge_names[] = { "all", "din", "usb", "usbfirst" };
+
+static void set_merge(const char *name) {
+    for (int i = 0; name && i < (int)(sizeof(merge_names) / sizeof(merge_names[0])); i++) {
+        if (strcmp(name, merge_names[i]) == 0) {
+            midi_input_set_merge_policy((midi_merge_t)i);
+            break;
+        }
+    }
+    console_printf("Merge %s\r\n", merge_names[midi_input_get_merge_policy()]);
+}
+
+// Double-voice policy for one channel (1-16) or all of them
+static void set_layer(const char *channel, const char *policy) {
+    bool all = channel && strcmp(channel, "all") == 0;
+    int ch = channel && !all ? atoi(channel) : 0;
+    bool keep = policy && strcmp(policy, "keep") == 0;
+    if (!channel || (!all && (ch < 1 || ch > 16)) || !policy || (!keep && strcmp(policy, "drop") != 0)) {
+        console_printf("layer <1-16|all> drop|keep\r\n");
+        return;
+    }
+
+    for (uint8_t c = 0; c < 16; c++) {
+        if (all || c == ch - 1) audio_engine_set_layer_policy(c, keep ? LAYER_KEEP : LAYER_DROP);
+    }
+    console_printf("Layers %s on %s%s\r\n", keep ? "kept" : "dropped", all ? "all channels" : "channel ",
+                   all ? "" : channel);
+}
+
+// Register stream playback: transpose and attenuation (see opl2_stream.h)
+static void set_stream(const char *what, const char *value) {
+    if (what && value && strcmp(what, "transpose") == 0) {
+        int semitones = atoi(value);
+        if (semitones < -24) semitones = -24;
+        if (semitones > 24) semitones = 24;
+        opl2_stream_set_transpose((int8_t)semitones);
+    } else if (what && value && strcmp(what, "atten") == 0) {
+        int steps = atoi(value);
+        opl2_stream_set_attenuation((uint8_t)(steps < 0 ? 0 : steps > 63 ? 63 : steps));
+    } else if (what) {
+        console_printf("stream transpose <semitones>|atten <steps>\r\n");
+        return;
+    }
+    console_printf("Stream transpose %d, attenuation %u (%u.%02u dB)\r\n", opl2_stream_get_transpose(),
+                   opl2_stream_get_attenuation(), opl2_stream_get_attenuation() * 3 / 4,
+                   opl2_stream_get_attenuation() * 3 % 4 * 25);
+}
+
+// Cycle counters, per core (PERF builds only)
+static void show_perf(void) {
+    bool any = false;
+    for (uint8_t core = 0; core < PERF_CORES; core++) {
+        const PerfCounter *counters = perf_counters(core);
+        if (!counters) continue;
+        any = true;
+        for (int id = 0; id < PERF_COUNT; id++) {
+            PerfCounter c = counters[id];
+            if (c.calls == 0) continue;
+            console_printf("Core %u %-12s %8lu calls, %6lu cyc average, %6lu worst\r\n", core,
+                           perf_name((perf_id_t)id), (unsigned long)c.calls,
+                           (unsigned long)(c.total / c.calls), (unsigned long)c.max);
+        }
+    }
+    if (!any) console_printf("Counters not built in (cmake -DPERF=ON)\r\n");
+}
+
+// Patch uploads, and the programs whose last record was rejected
+static void show_sysex(void) {
+    console_printf("SysEx %lu patches loaded, %lu rejected\r\n", (unsigned long)sysex_get_patch_count(),
+                   (unsigned long)sysex_get_error_count());
+
+    // 16 programs per line to stay inside console_printf's buffer
+    char text[80];
+    size_t length = 0;
+    uint16_t failed = 0;
+    for (uint16_t program = 0; program < 256; program++) {
+        if (!sysex_program_failed((uint8_t)program)) continue;
+        if (failed % 16 == 0) {
+            if (failed) console_printf("%s\r\n", text);
+            length = (size_t)snprintf(text, sizeof(text), "Failed:");
+        }
+        length += (size_t)snprintf(text + length, sizeof(text) - length, " %u", program);
+        failed++;
+    }
+    if (failed) console_printf("%s\r\n", text);
+}
+
+// One console_printf each (its buffer holds 96 characters)
+static const char *const help_lines[] = {
+    "stats, voices, queue, perf, sysex, trace start|stop, reset",
+    "bank load <n>, tempo <percent>, fade <ms>",
+    "merge [all|din|usb|usbfirst], layer <1-16|all> drop|keep",
+    "stream [transpose <semitones>|atten <steps>]"
+};
+
+static void run_command(char *command) {
+    char *verb = strtok(command, " ");
+    char *arg = strtok(NULL, " ");
+    if (!verb) return;
+
+    if (strcmp(verb, "help") == 0) {
+        for (size_t i = 0; i < sizeof(help_lines) / sizeof(help_lines[0]); i++) {
+            console_printf("%s\r\n", help_lines[i]);
+        }
+    } else if (strcmp(verb, "stats") == 0) {
+        show_stats();
+    } else if (strcmp(verb, "voices") == 0) {
+        show_voices();
+    } else if (strcmp(verb, "queue") == 0) {
+        show_queue();
+    } else if (strcmp(verb, "perf") == 0) {
+        show_perf();
+    } else if (strcmp(verb, "sysex") == 0) {
+        show_sysex();
+    } else if (strcmp(verb, "trace") == 0 && arg && strcmp(arg, "start") == 0) {
+        opl2_set_trace(&tracer);
+        console_printf("Trace on\r\n");
+    } else if (strcmp(verb, "trace") == 0 && arg && strcmp(arg, "stop") == 0) {
+        opl2_set_trace(NULL);
+        console_printf("Trace off\r\n");
+    } else if (strcmp(verb, "bank") == 0 && arg && strcmp(arg, "load") == 0) {
+        char *number = strtok(NULL, " ");
+        int bank = number ? atoi(number) : -1;
+        if (bank < 0 || bank >= BANK_COUNT || bank_get_format((uint8_t)bank) == BANK_FORMAT_NONE) {
+            console_printf("No bank %s\r\n", number ? number : "");
+        } else {
+            audio_engine_select_bank((uint8_t)bank);
+            console_printf("Bank %d (%s)\r\n", bank, bank_format_name(bank_get_format((uint8_t)bank)));
+        }
+    } else if (strcmp(verb, "tempo") == 0 && arg) {
+        song_player_set_tempo_scale((uint16_t)atoi(arg));
+        console_printf("Tempo %u%%\r\n", song_player_get_tempo_scale());
+    } else if (strcmp(verb, "fade") == 0 && arg) {
+        song_player_set_fade_time((uint16_t)atoi(arg));
+        console_printf("Fade %u ms\r\n", song_player_get_fade_time());
+    } else if (strcmp(verb, "merge") == 0) {
+        set_merge(arg);
+    } else if (strcmp(verb, "layer") == 0) {
+        set_layer(arg, strtok(NULL, " "));
+    } else if (strcmp(verb, "stream") == 0) {
+        set_stream(arg, strtok(NULL, " "));
+    } else if (strcmp(verb, "reset") == 0) {
+        audio_engine_reset();
+        console_printf("Reset\r\n");
+    } else {
+        console_printf("? %s (try help)\r\n", verb);
+    }
+}
+
+// Gather typed characters into a line (echoed, with backspace)
+static void read_input(void) {
+    while (tud_cdc_available()) {
+        char c;
+        if (tud_cdc_read(&c, 1) != 1) break;
+
+        if (c == '\r' || c == '\n') {
+            if (line_length == 0) continue;
+            console_printf("\r\n");
+            line[line_length] = '\0';
+            line_length = 0;
+            run_command(line);
+        } else if ((c == '\b' || c == 0x7F) && line_length > 0) {
+            line_length--;
+            console_printf("\b \b");
+        } else if (c >= ' ' && line_length < CONSOLE_LINE_MAX - 1) {
+            line[line_length++] = c;
+            tx_put(&c, 1);
+        }
+    }
+}
+
+void console_task(void) {
+    if (tud_cdc_connected()) read_input();
+    trace_drain();
+    tx_drain();
+}
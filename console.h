@@ -0,0 +1,63 @@
+/**
+ * console.h
+ *
+ * USB Serial Console
+ * Line commands and telemetry on the CDC interface (see usb_midi.h)
+ *
+ * Type a command and press Enter:
+ *   help                 List the commands
+ *   stats                Engine, queue, Core 1 load and bus use, Core 0 tasks, LCD
+ *   voices               What each OPL voice is playing, with its VU level
+ *   queue                Event queue fill, peak and drops
+ *   perf                 Cycle counters per core (PERF builds, see perf.h)
+ *   sysex                Patch uploads: loaded, rejected, programs that failed
+ *   trace start|stop     Print every OPL register write as it happens
+ *   bank load <n>        Switch instrument bank (0 = built-in, 1-8 = flash)
+ *   tempo <percent>      Song tempo scale
+ *   fade <ms>            Pause, resume and stop fade time
+ *   merge [policy]       DIN/USB merge: all, din, usb or usbfirst (see midi_input.h)
+ *   layer <ch> drop|keep Double-voice policy of a channel (1-16 or all, see midi_state.h)
+ *   stream [transpose <n>|atten <n>]
+ *                        Register stream playback: semitones, 0.75 dB steps
+ *   reset                Silence everything and reset the engine
+ *
+ * Output never blocks: it goes into a TX ring that the console task hands
+ * to the CDC endpoint as space allows, and is thrown away while no host
+ * has the port open. The firmware's printf() goes the same way: the
+ * console is the stdio driver, in place of pico_stdio_usb (which would
+ * wait on the CDC endpoint). The console runs as a Core 0 task; with tracing off
+ * it costs Core 1 nothing, and the counters it prints are the ones the
+ * modules keep anyway (EngineStats, SchedStats, ...).
+ *
+ * The trace hooks the OPL2 register trace on Core 1 into a ring of its
+ * own (chip, reg, data), which the console drains; writes that don't fit
+ * are counted and reported instead of slowing Core 1 down.
+ */
+
+#ifndef CONSOLE_H
+#define CONSOLE_H
+
+#include <stdint.h>
+
+#define CONSOLE_TX_SIZE     1024   // Output ring (power of two)
+#define CONSOLE_LINE_MAX    48     // Longest command line
+#define CONSOLE_TRACE_SIZE  256    // Register writes in flight (power of two)
+
+/**
+ * Install the console as the stdio driver (printf() into the TX ring)
+ * Call once at boot, after stdio_init_all()
+ */
+void console_init(void);
+
+/**
+ * Read commands and send pending output
+ * Run as a Core 0 task (see scheduler.h)
+ */
+void console_task(void);
+
+/**
+ * Print to the console (dropped if the ring is full or nobody listens)
+ */
+void console_printf(const char *format, ...);
+
+#endif // CONSOLE_H
@@ -1,8 +1,11 @@
 #include "instruments.h"
+#include "bank.h"
 #include "opl2.h"
+#include "perf.h"
 
 // Auto-generated Standard Bank (AdLib Compatible)
-OPL_Patch gm_bank[256] = {
+// Stays in flash - runtime edits go to bank.c's override pool
+const OPL_Patch builtin_bank[256] = {
     [0] = { .m_ave=0x01, .m_ksl=0x4B, .m_atdec=0xF1, .m_susrel=0x50, .m_wave=0x00, .c_ave=0x01, .c_ksl=0x00, .c_atdec=0xD2, .c_susrel=0x76, .c_wave=0x00, .feedback=0x06 },
     [1] = { .m_ave=0x13, .m_ksl=0x50, .m_atdec=0xF1, .m_susrel=0x50, .m_wave=0x00, .c_ave=0x01, .c_ksl=0x00, .c_atdec=0xD2, .c_susrel=0x76, .c_wave=0x00, .feedback=0x06 },
     [2] = { .m_ave=0x13, .m_ksl=0x53, .m_atdec=0xF1, .m_susrel=0x54, .m_wave=0x00, .c_ave=0x01, .c_ksl=0x00, .c_atdec=0xD2, .c_susrel=0x76, .c_wave=0x00, .feedback=0x06 },
@@ -305,65 +308,207 @@ const char* const patch_names[256] = {
     "Bass Drum", "Snare", "Hat"
 };
 
-const OPL_Patch drum_bd    = { .m_ave=0x00, .m_ksl=0x0D, .m_atdec=0xE8, .m_susrel=0xEF, .m_wave=0x00, .c_ave=0x00, .c_ksl=0x00, .c_atdec=0xA5, .c_susrel=0xFF, .c_wave=0x00, .feedback=0x06 };
-const OPL_Patch drum_snare = { .m_ave=0x06, .m_ksl=0x00, .m_atdec=0xF0, .m_susrel=0xF0, .m_wave=0x00, .c_ave=0x00, .c_ksl=0x00, .c_atdec=0xF7, .c_susrel=0xF7, .c_wave=0x00, .feedback=0x0E };
-const OPL_Patch drum_hihat = { .m_ave=0x05, .m_ksl=0x00, .m_atdec=0xF0, .m_susrel=0x77, .m_wave=0x00, .c_ave=0x00, .c_ksl=0x00, .c_atdec=0xFA, .c_susrel=0xEA, .c_wave=0x00, .feedback=0x0E };
+// GM Percussion Map (notes 35-81) into the built-in bank's percussion set
+// (211-252). Notes the set has no patch for borrow the closest sound.
+const DrumMapEntry drum_map[DRUM_MAP_SIZE] = {
+    { .program=211, .note=35, .priority=3 }, // 35 Acoustic Bass Drum
+    { .program=212, .note=36, .priority=3 }, // 36 Bass Drum 1
+    { .program=213, .note=37, .priority=2 }, // 37 Side Stick
+    { .program=214, .note=38, .priority=3 }, // 38 Acoustic Snare
+    { .program=215, .note=39, .priority=2 }, // 39 Hand Clap
+    { .program=216, .note=40, .priority=3 }, // 40 Electric Snare
+    { .program=217, .note=41, .priority=2 }, // 41 Low Floor Tom
+    { .program=218, .note=42, .priority=1 }, // 42 Closed Hi-Hat
+    { .program=219, .note=43, .priority=2 }, // 43 High Floor Tom
+    { .program=220, .note=44, .priority=1 }, // 44 Pedal Hi-Hat
+    { .program=221, .note=45, .priority=2 }, // 45 Low Tom
+    { .program=222, .note=46, .priority=1 }, // 46 Open Hi-Hat
+    { .program=223, .note=47, .priority=2 }, // 47 Low-Mid Tom
+    { .program=224, .note=48, .priority=2 }, // 48 Hi-Mid Tom
+    { .program=225, .note=49, .priority=2 }, // 49 Crash Cymbal 1
+    { .program=226, .note=50, .priority=2 }, // 50 High Tom
+    { .program=227, .note=51, .priority=1 }, // 51 Ride Cymbal 1
+    { .program=228, .note=52, .priority=2 }, // 52 Chinese Cymbal
+    { .program=229, .note=53, .priority=1 }, // 53 Ride Bell
+    { .program=230, .note=54, .priority=0 }, // 54 Tambourine
+    { .program=231, .note=55, .priority=2 }, // 55 Splash Cymbal
+    { .program=232, .note=56, .priority=0 }, // 56 Cowbell
+    { .program=233, .note=57, .priority=2 }, // 57 Crash Cymbal 2
+    { .program=234, .note=58, .priority=0 }, // 58 Vibraslap
+    { .program=235, .note=59, .priority=1 }, // 59 Ride Cymbal 2
+    { .program=236, .note=60, .priority=0 }, // 60 Hi Bongo
+    { .program=237, .note=61, .priority=0 }, // 61 Low Bongo
+    { .program=238, .note=62, .priority=0 }, // 62 Mute Hi Conga
+    { .program=239, .note=63, .priority=0 }, // 63 Open Hi Conga
+    { .program=240, .note=64, .priority=0 }, // 64 Low Conga
+    { .program=241, .note=65, .priority=0 }, // 65 High Timbale
+    { .program=242, .note=66, .priority=0 }, // 66 Low Timbale
+    { .program=243, .note=67, .priority=0 }, // 67 High Agogo
+    { .program=244, .note=68, .priority=0 }, // 68 Low Agogo
+    { .program=245, .note=69, .priority=0 }, // 69 Cabasa
+    { .program=246, .note=70, .priority=0 }, // 70 Maracas
+    { .program=250, .note=71, .priority=0 }, // 71 Short Whistle (no whistle patch - Cuica)
+    { .program=250, .note=72, .priority=0 }, // 72 Long Whistle (no whistle patch - Cuica)
+    { .program=245, .note=73, .priority=0 }, // 73 Short Guiro (no guiro patch - Cabasa)
+    { .program=245, .note=74, .priority=0 }, // 74 Long Guiro (no guiro patch - Cabasa)
+    { .program=247, .note=75, .priority=0 }, // 75 Claves
+    { .program=248, .note=76, .priority=0 }, // 76 Hi Wood Block
+    { .program=249, .note=77, .priority=0 }, // 77 Low Wood Block
+    { .program=250, .note=78, .priority=0 }, // 78 Mute Cuica
+    { .program=250, .note=79, .priority=0 }, // 79 Open Cuica (Mute Cuica patch)
+    { .program=251, .note=80, .priority=0 }, // 80 Mute Triangle
+    { .program=252, .note=81, .priority=0 }, // 81 Open Triangle
+};
 
 // --- INTERNAL HELPER ---
 
 // Global Shadow for Volume Scaling
-uint8_t shadow_carrier_ksl[9] = {0};
+uint8_t shadow_carrier_ksl[OPL2_VOICES] = {0};
+
+// What each channel currently holds, so a bank edit can be pushed to the
+// voices already using it without rewriting the whole patch
+// (channels of every chip; opl2_clear() callers invalidate them all, which
+// at boot sets every entry to PATCH_NONE whatever OPL2_CHIPS is)
+static OPL_Patch channel_patch[OPL2_VOICES];
+static uint16_t channel_program[OPL2_VOICES];
+static uint8_t channel_layer[OPL2_VOICES];  // Voice of a double-voice program
 
 // Global volume attenuation (0-63, where 0=loudest, 63=quietest)
 // NOTE: Setting this to non-zero makes sounds tiny and doesn't fix distortion
 #define GLOBAL_VOLUME_ATTENUATION 0
 
-void write_patch_to_channel(uint8_t ch, const OPL_Patch* p) {
-    if (ch > 8) return;
-    uint8_t offsets[9] = {0, 1, 2, 8, 9, 10, 16, 17, 18};
-    uint8_t off = offsets[ch];
-
-    opl2_write(0x20 + off, p->m_ave);
-    
+static uint8_t modulator_level(const OPL_Patch* p) {
     // Apply global volume attenuation to MODULATOR TL
     uint8_t m_tl = (p->m_ksl & 0x3F) + GLOBAL_VOLUME_ATTENUATION;
     if (m_tl > 63) m_tl = 63;
-    opl2_write(0x40 + off, (p->m_ksl & 0xC0) | m_tl);
-    
-    opl2_write(0x60 + off, p->m_atdec);
-    opl2_write(0x80 + off, p->m_susrel);
-    opl2_write(0xE0 + off, p->m_wave);
+    return (p->m_ksl & 0xC0) | m_tl;
+}
 
-    // Save CARRIER KSL/TL with global attenuation already applied
+static uint8_t carrier_level(const OPL_Patch* p) {
+    // CARRIER KSL/TL with global attenuation already applied
     // This becomes the BASE for velocity scaling
     uint8_t c_tl = (p->c_ksl & 0x3F) + GLOBAL_VOLUME_ATTENUATION;
     if (c_tl > 63) c_tl = 63;
-    shadow_carrier_ksl[ch] = (p->c_ksl & 0xC0) | c_tl;
+    return (p->c_ksl & 0xC0) | c_tl;
+}
+
+void write_patch_to_channel(uint8_t ch, const OPL_Patch* p) {
+    if (ch >= OPL2_VOICES) return;
+    PERF_BEGIN(WRITE_PATCH);
+
+    opl2_write_operator(ch, 0x20, p->m_ave);
+    opl2_write_operator(ch, 0x40, modulator_level(p));
+    opl2_write_operator(ch, 0x60, p->m_atdec);
+    opl2_write_operator(ch, 0x80, p->m_susrel);
+    opl2_write_operator(ch, 0xE0, p->m_wave);
+
+    shadow_carrier_ksl[ch] = carrier_level(p);
+
+    opl2_write_operator(ch, 0x23, p->c_ave);
+    opl2_write_operator(ch, 0x43, shadow_carrier_ksl[ch]);  // Use the shadow value
+    opl2_write_operator(ch, 0x63, p->c_atdec);
+    opl2_write_operator(ch, 0x83, p->c_susrel);
+    opl2_write_operator(ch, 0xE3, p->c_wave);
+
+    opl2_write_channel(ch, 0xC0, p->feedback);
+
+    channel_patch[ch] = *p;
+    channel_program[ch] = PATCH_NONE;
+    PERF_END(WRITE_PATCH);
+}
+
+const OPL_Patch* get_channel_patch(uint8_t ch) {
+    return &channel_patch[ch < OPL2_VOICES ? ch : 0];
+}
+
+bool refresh_channel_patch(uint8_t ch, const OPL_Patch* p) {
+    if (ch >= OPL2_VOICES) return false;
+    OPL_Patch* cur = &channel_patch[ch];
 
-    opl2_write(0x23 + off, p->c_ave);
-    opl2_write(0x43 + off, shadow_carrier_ksl[ch]);  // Use the shadow value
-    opl2_write(0x63 + off, p->c_atdec);
-    opl2_write(0x83 + off, p->c_susrel);
-    opl2_write(0xE3 + off, p->c_wave);
+    if (p->m_ave    != cur->m_ave)    opl2_write_operator(ch, 0x20, p->m_ave);
+    if (p->m_ksl    != cur->m_ksl)    opl2_write_operator(ch, 0x40, modulator_level(p));
+    if (p->m_atdec  != cur->m_atdec)  opl2_write_operator(ch, 0x60, p->m_atdec);
+    if (p->m_susrel != cur->m_susrel) opl2_write_operator(ch, 0x80, p->m_susrel);
+    if (p->m_wave   != cur->m_wave)   opl2_write_operator(ch, 0xE0, p->m_wave);
 
-    opl2_write(0xC0 + ch, p->feedback);
+    if (p->c_ave    != cur->c_ave)    opl2_write_operator(ch, 0x23, p->c_ave);
+    if (p->c_atdec  != cur->c_atdec)  opl2_write_operator(ch, 0x63, p->c_atdec);
+    if (p->c_susrel != cur->c_susrel) opl2_write_operator(ch, 0x83, p->c_susrel);
+    if (p->c_wave   != cur->c_wave)   opl2_write_operator(ch, 0xE3, p->c_wave);
+
+    if (p->feedback != cur->feedback) opl2_write_channel(ch, 0xC0, p->feedback);
+
+    // Carrier TL carries the note velocity, so leave that write to the caller
+    bool level_changed = p->c_ksl != cur->c_ksl;
+    shadow_carrier_ksl[ch] = carrier_level(p);
+
+    *cur = *p;
+    return level_changed;
+}
+
+void invalidate_channel_programs(void) {
+    for (int i = 0; i < OPL2_VOICES; i++) channel_program[i] = PATCH_NONE;
+}
+
+uint16_t get_channel_program(uint8_t channel) {
+    if (channel >= OPL2_VOICES) return PATCH_NONE;
+    return channel_program[channel];
+}
+
+uint8_t get_channel_layer(uint8_t channel) {
+    if (channel >= OPL2_VOICES) return 0;
+    return channel_layer[channel];
 }
 
 void load_gm_instrument(uint8_t channel, uint8_t program_number) {
-    if (program_number > 255) program_number = 0;
-    write_patch_to_channel(channel, &gm_bank[program_number]);
+    load_instrument_layer(channel, program_number, 0);
 }
 
-void load_drum_patch(uint8_t channel, uint8_t drum_note) {
-    if (drum_note == 35 || drum_note == 36) write_patch_to_channel(channel, &drum_bd);
-    else if (drum_note == 38 || drum_note == 40) write_patch_to_channel(channel, &drum_snare);
-    else write_patch_to_channel(channel, &drum_hihat);
+void load_instrument_layer(uint8_t channel, uint8_t program_number, uint8_t layer) {
+    if (channel >= OPL2_VOICES) return;
+    layer = layer ? 1 : 0;
+
+    // Same program still on this channel (bank edits and switches keep it
+    // current via refresh_channel_patch) - nothing to write
+    if (channel_program[channel] == program_number && channel_layer[channel] == layer) return;
+
+    OPL_Patch patch;
+    if (layer == 0) {
+        bank_get_patch(program_number, &patch);
+    } else {
+        OPL_Instrument instrument;
+        bank_get_instrument(program_number, &instrument);
+        patch = instrument.voice[1];
+    }
+    write_patch_to_channel(channel, &patch);
+    channel_program[channel] = program_number;
+    channel_layer[channel] = layer;
+}
+
+const DrumMapEntry* get_drum_entry(uint8_t drum_note) {
+    if (drum_note < DRUM_NOTE_FIRST || drum_note > DRUM_NOTE_LAST) {
+        return &drum_map[42 - DRUM_NOTE_FIRST];  // Outside the GM set: Closed Hi-Hat
+    }
+    return &drum_map[drum_note - DRUM_NOTE_FIRST];
 }
-void update_gm_patch(uint8_t program_number, const OPL_Patch* new_patch) {
-    if (program_number > 127) return;
-    gm_bank[program_number] = *new_patch; // Struct copy
-    
-    // Also update the shadow volume used for velocity scaling
-    shadow_carrier_ksl[program_number] = new_patch->c_ksl;
+
+uint8_t load_drum_patch(uint8_t channel, uint8_t drum_note) {
+    uint8_t program, pitch;
+
+    // A loaded bank with its own percussion supplies patch and pitch
+    if (!bank_get_drum(drum_note, &program, &pitch)) {
+        const DrumMapEntry* entry = get_drum_entry(drum_note);
+        program = entry->program;
+        pitch = (drum_note < DRUM_NOTE_FIRST || drum_note > DRUM_NOTE_LAST) ? drum_note : entry->note;
+    }
+
+    load_gm_instrument(channel, program);
+    return pitch;
 }
 
+bool update_gm_patch(uint8_t program_number, const OPL_Patch* new_patch) {
+    // Copy-on-write into the current bank
+    // Voices already holding this program are refreshed by the caller
+    // (see refresh_channel_patch) - the shadow volume follows from there
+    return bank_set_override(program_number, new_patch);
+}
@@ -12,24 +12,81 @@ typedef struct {
     uint8_t feedback;
 } OPL_Patch;
 
+// A full instrument: one or two layered OPL voices (OP2/WOPL double-voice)
+typedef struct {
+    OPL_Patch voice[2];
+    int8_t note_offset[2];  // Semitones added to the played note, per voice
+    int8_t fine_tune;       // Second voice detune in 1/32 semitone
+    bool double_voice;      // Every note sounds both voices
+} OPL_Instrument;
+
+// Channel holds a patch that isn't a bank program (e.g. the drum kit)
+#define PATCH_NONE 0xFFFF
+
+// One GM percussion note (35-81)
+typedef struct {
+    uint8_t program;   // Built-in bank program with the drum's patch
+    uint8_t note;      // Fixed pitch the drum is played at
+    uint8_t priority;  // 0-3: a hit can't cut a higher-priority drum's attack
+} DrumMapEntry;
+
+#define DRUM_NOTE_FIRST 35
+#define DRUM_NOTE_LAST  81
+#define DRUM_MAP_SIZE   (DRUM_NOTE_LAST - DRUM_NOTE_FIRST + 1)
+
+extern const DrumMapEntry drum_map[DRUM_MAP_SIZE];
+
 // --- Public Functions ---
 
-// Load a specific General MIDI instrument (0-127) into a channel
+// Load a bank program (0-255) into a channel
+// Skipped if the channel already holds that program
 extern void load_gm_instrument(uint8_t channel, uint8_t program_number);
 
-// Load a specific Drum sound (Bass, Snare, HiHat, etc.)
-extern void load_drum_patch(uint8_t channel, uint8_t drum_note);
+// Load one voice (layer 0 or 1) of a bank program into a channel
+// Skipped if the channel already holds that program and layer
+extern void load_instrument_layer(uint8_t channel, uint8_t program_number, uint8_t layer);
+
+// Load the patch for a GM percussion note; returns the pitch to play it at
+extern uint8_t load_drum_patch(uint8_t channel, uint8_t drum_note);
+
+// Drum map entry for a percussion note (notes outside 35-81 get the hi-hat)
+extern const DrumMapEntry* get_drum_entry(uint8_t drum_note);
 
 // Global Shadow Array for Carrier KSL (Volume)
 // We need this to apply velocity scaling relative to the patch's natural volume.
-extern uint8_t shadow_carrier_ksl[9];
+extern uint8_t shadow_carrier_ksl[OPL2_VOICES];
+
+// Update a specific instrument in the current bank at runtime (0-255)
+// Must run on the core that owns the OPL2 (Core 1) - see audio_engine_update_patch()
+// Returns false if the bank's override pool is full
+bool update_gm_patch(uint8_t program_number, const OPL_Patch* new_patch);
+
+// Write a patch to a channel unconditionally (11 register writes)
+extern void write_patch_to_channel(uint8_t ch, const OPL_Patch* p);
+
+// Bring a channel to a new patch, writing only the registers that differ
+// from what it currently holds. Carrier TL is NOT written: returns true if
+// the carrier level changed so the caller can re-apply velocity.
+extern bool refresh_channel_patch(uint8_t ch, const OPL_Patch* p);
+
+// Patch a channel holds now (as last written by write_patch_to_channel/refresh)
+extern const OPL_Patch* get_channel_patch(uint8_t ch);
+
+// Forget which programs the channels hold, after something other than the
+// instrument code wrote the chip (e.g. a register stream, see opl2_stream.h);
+// also call once at boot, before the first patch is loaded
+extern void invalidate_channel_programs(void);
+
+// Bank program currently loaded on a channel, or PATCH_NONE
+extern uint16_t get_channel_program(uint8_t channel);
 
-// Update a specific instrument in the bank at runtime
-void update_gm_patch(uint8_t program_number, const OPL_Patch* new_patch);
+// Which voice of its program (0 or 1) a channel holds
+extern uint8_t get_channel_layer(uint8_t channel);
 
-extern OPL_Patch gm_bank[256];
+// Compiled-in bank (bank 0, and fallback for programs a loaded bank lacks)
+extern const OPL_Patch builtin_bank[256];
 
-// Patch name table (0-255)
+// Patch name table for the built-in bank (0-255) - see bank_get_name()
 extern const char* const patch_names[256];
 
 #endif
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include "lcd.h"
 #include "pico/stdlib.h"
 #include "hardware/i2c.h"
+#include "hardware/regs/i2c.h"
 #include <string.h>
 #include <stdio.h>
 
@@ -52,12 +53,96 @@ static const uint8_t row_offsets[4] = {0x00, 0x40, 0x14, 0x54};
 // Current backlight state
 static uint8_t backlight_state = LCD_BACKLIGHT;
 
-// Write a byte to I2C
+// What the menu drew, and what the display shows
+static char frame[LCD_ROWS][LCD_COLS];
+static char shown[LCD_ROWS][LCD_COLS];
+static uint8_t cursor_col = 0;
+static uint8_t cursor_row = 0;
+
+// DDRAM address the display writes the next character to
+static uint8_t display_address = 0;
+
+static uint32_t i2c_bytes = 0;
+
+// Transfer queue: each entry is one I2C write (at most one HD44780 byte,
+// both nibbles strobed) and the settle time the display needs after it
+#define LCD_QUEUE_SIZE   128      // Entries (power of two)
+#define LCD_SETTLE_US    40       // After a character or most commands
+#define LCD_SLOW_US      1600     // After Clear Display / Return Home
+#define LCD_RETRY_US     50       // TX FIFO busy: look again
+
+typedef struct {
+    uint8_t bytes[4];
+    uint8_t count;
+    uint16_t delay_us;
+} LcdTransfer;
+
+static LcdTransfer transfers[LCD_QUEUE_SIZE];
+static volatile uint8_t queue_head = 0;   // Written by the caller
+static volatile uint8_t queue_tail = 0;   // Written by the alarm
+static volatile bool draining = false;
+
+static uint8_t queue_free(void) {
+    return (uint8_t)(LCD_QUEUE_SIZE - 1 - ((queue_head - queue_tail) & (LCD_QUEUE_SIZE - 1)));
+}
+
+// Alarm callback: hand the next transfer to the I2C TX FIFO (16 deep, so
+// this never waits) and come back once it is on the wire and settled.
+// The target address stays as the power-up writes left it
+static int64_t drain_alarm(alarm_id_t id, void *user_data) {
+    i2c_hw_t *hw = i2c_get_hw(LCD_I2C_PORT);
+    if (hw->raw_intr_stat & I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS) {
+        (void)hw->clr_tx_abrt;  // No ACK (no display?): drop and carry on
+    }
+
+    if (queue_tail == queue_head) {
+        draining = false;
+        return 0;
+    }
+
+    const LcdTransfer *t = &transfers[queue_tail];
+    if (i2c_get_write_available(LCD_I2C_PORT) < t->count) return LCD_RETRY_US;
+
+    for (uint8_t i = 0; i < t->count; i++) {
+        bool last = (i + 1 == t->count);
+        hw->data_cmd = t->bytes[i] | (last ? I2C_IC_DATA_CMD_STOP_BITS : 0);
+    }
+    uint32_t wire_us = (uint32_t)(t->count + 1) * 9 * 1000000 / LCD_I2C_HZ;  // Address + data, 9 clocks each
+    uint16_t delay_us = t->delay_us;
+    queue_tail = (queue_tail + 1) & (LCD_QUEUE_SIZE - 1);
+    return wire_us + delay_us;
+}
+
+// Start the alarm if it isn't running. With every alarm slot taken
+// add_alarm_in_us() fails; the queue then waits for the next call
+// (the next flush from the UI task, or the loops below)
+static void start_drain(void) {
+    // The alarm runs on this core, so it cannot stop between these lines
+    if (draining || queue_tail == queue_head) return;
+    draining = true;
+    if (add_alarm_in_us(1, drain_alarm, NULL, true) < 0) draining = false;
+}
+
+// Queue one transfer (waits only if the queue is full)
+static void queue_transfer(const uint8_t *bytes, uint8_t count, uint16_t delay_us) {
+    while (queue_free() == 0) start_drain();
+
+    LcdTransfer *t = &transfers[queue_head];
+    for (uint8_t i = 0; i < count; i++) t->bytes[i] = bytes[i];
+    t->count = count;
+    t->delay_us = delay_us;
+    i2c_bytes += count;
+    queue_head = (queue_head + 1) & (LCD_QUEUE_SIZE - 1);
+    start_drain();
+}
+
+// Write a byte to I2C (power-up sequence only, before the queue runs)
 static void i2c_write_byte(uint8_t data) {
     i2c_write_blocking(LCD_I2C_PORT, LCD_I2C_ADDR, &data, 1, false);
+    i2c_bytes++;
 }
 
-// Send 4 bits to LCD via I2C
+// Send 4 bits to LCD via I2C (power-up sequence only)
 static void lcd_write_nibble(uint8_t nibble, uint8_t mode) {
     uint8_t data = (nibble & 0xF0) | mode | backlight_state;
     
@@ -70,28 +155,29 @@ static void lcd_write_nibble(uint8_t nibble, uint8_t mode) {
     sleep_us(50);
 }
 
-// Send a byte to LCD (split into two 4-bit nibbles)
-static void lcd_write_byte(uint8_t data, uint8_t mode) {
-    lcd_write_nibble(data & 0xF0, mode);
-    lcd_write_nibble((data << 4) & 0xF0, mode);
+// Queue a byte to LCD: both 4-bit nibbles in one I2C write, each latched
+// on the falling edge of Enable
+static void lcd_write_byte(uint8_t data, uint8_t mode, uint16_t delay_us) {
+    uint8_t high = (data & 0xF0) | mode | backlight_state;
+    uint8_t low = ((data << 4) & 0xF0) | mode | backlight_state;
+    uint8_t bytes[4] = { high | LCD_ENABLE, high, low | LCD_ENABLE, low };
+    queue_transfer(bytes, 4, delay_us);
 }
 
 // Send command to LCD
 static void lcd_command(uint8_t cmd) {
-    lcd_write_byte(cmd, 0);  // mode = 0 for command
-    if (cmd <= 0x02) {
-        sleep_ms(2);  // Clear/home commands need more time
-    }
+    // Clear/home commands need more time
+    lcd_write_byte(cmd, 0, cmd <= 0x02 ? LCD_SLOW_US : LCD_SETTLE_US);  // mode = 0 for command
 }
 
 // Send data (character) to LCD
 static void lcd_data(uint8_t data) {
-    lcd_write_byte(data, LCD_RS);  // mode = RS for data
+    lcd_write_byte(data, LCD_RS, LCD_SETTLE_US);  // mode = RS for data
 }
 
 bool lcd_init(void) {
     // Initialize I2C
-    i2c_init(LCD_I2C_PORT, 100 * 1000);  // 100kHz
+    i2c_init(LCD_I2C_PORT, LCD_I2C_HZ);
     gpio_set_function(LCD_SDA_PIN, GPIO_FUNC_I2C);
     gpio_set_function(LCD_SCL_PIN, GPIO_FUNC_I2C);
     gpio_pull_up(LCD_SDA_PIN);
@@ -121,32 +207,39 @@ bool lcd_init(void) {
     // Display control: display on, cursor off, blink off
     lcd_command(LCD_DISPLAY_CONTROL | LCD_DISPLAY_ON);
     
-    // Clear display
+    // Clear display (and both buffers to match)
+    lcd_command(LCD_CLEAR_DISPLAY);
+    display_address = 0;
+    memset(shown, ' ', sizeof(shown));
     lcd_clear();
     
     // Entry mode: increment cursor, no shift
     lcd_command(LCD_ENTRY_MODE_SET | LCD_ENTRY_LEFT);
+
+    // The commands go out from the queue; let them finish before reporting
+    while (!lcd_is_idle()) start_drain();
     
     printf("LCD: Initialization complete\n");
     return true;
 }
 
 void lcd_clear(void) {
-    lcd_command(LCD_CLEAR_DISPLAY);
-    sleep_ms(2);
+    memset(frame, ' ', sizeof(frame));
+    cursor_col = 0;
+    cursor_row = 0;
 }
 
 void lcd_set_cursor(uint8_t col, uint8_t row) {
     if (row >= LCD_ROWS) row = LCD_ROWS - 1;
     if (col >= LCD_COLS) col = LCD_COLS - 1;
     
-    uint8_t address = col + row_offsets[row];
-    lcd_command(LCD_SET_DDRAM_ADDR | address);
+    cursor_col = col;
+    cursor_row = row;
 }
 
 void lcd_print(const char *str) {
-    while (*str) {
-        lcd_data(*str++);
+    while (*str && cursor_col < LCD_COLS) {
+        frame[cursor_row][cursor_col++] = *str++;
     }
 }
 
@@ -155,7 +248,58 @@ void lcd_print_at(uint8_t col, uint8_t row, const char *str) {
     lcd_print(str);
 }
 
+// Send one cell, following the display's auto-increment
+// (DDRAM runs 0x00-0x27 then 0x40-0x67; rows 2 and 3 continue rows 0 and 1)
+static void send_cell(uint8_t row, uint8_t col) {
+    uint8_t address = col + row_offsets[row];
+    if (address != display_address) lcd_command(LCD_SET_DDRAM_ADDR | address);
+    lcd_data(frame[row][col]);
+    shown[row][col] = frame[row][col];
+
+    display_address = address + 1;
+    if (display_address == 0x28) display_address = 0x40;
+    else if (display_address == 0x68) display_address = 0x00;
+}
+
+void lcd_flush(void) {
+    start_drain();  // Retry an alarm that failed to start
+#if LCD_FULL_REDRAW
+    memset(shown, 0, sizeof(shown));
+#endif
+    for (uint8_t row = 0; row < LCD_ROWS; row++) {
+        for (uint8_t col = 0; col < LCD_COLS; col++) {
+            // Never wait for the queue: cells that don't fit stay dirty
+            // and go out with the next flush
+            if (queue_free() < 2) return;
+
+            if (frame[row][col] != shown[row][col]) {
+                send_cell(row, col);
+            } else if (col + 1 < LCD_COLS && col + row_offsets[row] == display_address &&
+                       frame[row][col + 1] != shown[row][col + 1]) {
+                // A one-cell gap costs the same as a cursor move: write through it
+                send_cell(row, col);
+            }
+        }
+    }
+}
+
+bool lcd_is_idle(void) {
+    return !draining && queue_tail == queue_head;
+}
+
+void lcd_define_char(uint8_t slot, const uint8_t rows[8]) {
+    lcd_command(LCD_SET_CGRAM_ADDR | ((slot & 0x07) << 3));
+    for (uint8_t i = 0; i < 8; i++) lcd_data(rows[i] & 0x1F);
+
+    // The address counter now points into CGRAM: the next cell moves it back
+    display_address = 0xFF;
+}
+
+uint32_t lcd_get_i2c_bytes(void) {
+    return i2c_bytes;
+}
+
 void lcd_backlight(bool on) {
     backlight_state = on ? LCD_BACKLIGHT : 0x00;
-    i2c_write_byte(backlight_state);
+    queue_transfer(&backlight_state, 1, 0);
 }
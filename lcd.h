@@ -3,6 +3,20 @@
  * 
  * HD44780 20x4 LCD with I2C Interface
  * Driver for character LCD display via I2C backpack
+ *
+ * Printing only fills an off-screen framebuffer; lcd_flush() compares it
+ * with what the display already shows and sends just the cells that
+ * changed, moving the display's cursor only where a run of changes does
+ * not follow on from the last one. Every character costs 4 I2C bytes
+ * (two nibbles, each strobed with Enable high then low), so a redraw
+ * that changes nothing costs nothing.
+ *
+ * Nothing here waits on the bus. Writes to the display go into a queue of
+ * I2C transfers - one per character or command, both nibbles packed into
+ * a single 4-byte write - with the settle time the HD44780 needs after
+ * each. An alarm on Core 0 feeds them to the I2C TX FIFO one at a time,
+ * so printing and flushing return at once. A flush that finds the queue
+ * full leaves the rest of its changes for the next one.
  */
 
 #ifndef LCD_H
@@ -17,10 +31,21 @@
 #define LCD_SCL_PIN 13
 #define LCD_I2C_ADDR 0x27  // Common I2C address, may need to be 0x3F
 
+// Bus clock: the PCF8574 is rated for 100 kHz. Most backpacks also run at
+// 400 kHz (cmake -DLCD_I2C_HZ=400000), a quarter of the wire time per cell
+#ifndef LCD_I2C_HZ
+#define LCD_I2C_HZ   100000
+#endif
+
 // Display dimensions
 #define LCD_COLS 20
 #define LCD_ROWS 4
 
+// 1 = every flush rewrites all 80 cells (to measure the old cost against the diff)
+#ifndef LCD_FULL_REDRAW
+#define LCD_FULL_REDRAW 0
+#endif
+
 /**
  * Initialize the LCD display
  * Sets up I2C communication and LCD configuration
@@ -30,12 +55,12 @@
 bool lcd_init(void);
 
 /**
- * Clear the entire LCD display
+ * Clear the entire framebuffer (shown on the next flush)
  */
 void lcd_clear(void);
 
 /**
- * Set cursor position
+ * Set the framebuffer cursor position
  * 
  * @param col Column (0-19 for 20x4 display)
  * @param row Row (0-3 for 20x4 display)
@@ -43,7 +68,8 @@ void lcd_clear(void);
 void lcd_set_cursor(uint8_t col, uint8_t row);
 
 /**
- * Print a string at current cursor position
+ * Print a string into the framebuffer at the cursor position
+ * Text past the end of the row is dropped
  * 
  * @param str Null-terminated string to print
  */
@@ -58,6 +84,31 @@ void lcd_print(const char *str);
  */
 void lcd_print_at(uint8_t col, uint8_t row, const char *str);
 
+/**
+ * Define a custom character (queued like everything else)
+ * The character prints as code 8 + slot; codes 0-7 show the same glyphs
+ * but can't go in a C string
+ *
+ * @param slot CGRAM slot (0-7)
+ * @param rows 8 rows of 5 pixels, top first (bit 4 = left)
+ */
+void lcd_define_char(uint8_t slot, const uint8_t rows[8]);
+
+/**
+ * Send the cells that differ from what the display shows
+ */
+void lcd_flush(void);
+
+/**
+ * Check whether every queued transfer has gone out and settled
+ */
+bool lcd_is_idle(void);
+
+/**
+ * Total bytes written to the I2C backpack since boot
+ */
+uint32_t lcd_get_i2c_bytes(void);
+
 /**
  * Turn backlight on/off
  * 
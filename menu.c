@@ -8,9 +8,14 @@
 #include "lcd.h"
 #include "encoder.h"
 #include "instruments.h"
+#include "bank.h"
+#include "audio_engine.h"
 #include "song_player.h"
+#include "mus_player.h"
+#include "tracker_player.h"
 #include "midi_input.h"
-#include "midi_state.h"
+#include "modulation.h"
+#include "perf.h"
 #include "pico/stdlib.h"
 #include <stdio.h>
 #include <string.h>
@@ -21,15 +26,28 @@ static uint8_t selected_channel = 0;  // 0-15 for MIDI channels
 static uint8_t selected_program = 0;  // 0-255 for patches
 static uint8_t volume = 127;
 static int8_t octave = 0;
-static bool voice_states[9] = {false};
+static EngineSnapshot engine;           // Core 1's state as last published
+static uint32_t engine_generation = 0;
 static char song_name[21] = "Doom E1M1";
 static uint32_t last_update = 0;
 static bool menu_dirty = true;
 static bool patch_edit_mode = false;
 static bool channel_edit_mode = false;
+static bool tempo_edit_mode = false;
+
+#define TEMPO_STEP 5  // Percent per encoder detent
+
+#define REDRAW_MIN_MS  50    // Engine changes redraw at most this often
+#define REDRAW_IDLE_MS 1000  // Redraw anyway (clock tempo and other Core 0 state)
+
+// Print the LCD's I2C traffic this often (0 = off); build with
+// LCD_FULL_REDRAW=1 for the cost without the framebuffer diff
+#define LCD_STATS_MS 0
 
 #define CHANNEL_ALL 255  // Special value for "all channels"
 
+#define VU_GLYPH 8  // Bar of height n prints as VU_GLYPH + n - 1 (CGRAM slots 0-7)
+
 // Cursor position (which line is selected)
 static uint8_t cursor_line = 1;  // Start on line 2 (0-indexed: line 1)
 
@@ -69,35 +87,72 @@ static const char* gm_patch_names[] = {
     "TelephoneRing", "Helicopter", "Applause", "Gunshot"
 };
 
+// " ACT:" and a bar per voice ('.' when silent); 18 voices leave no room
+// for the label
+static void append_meters(char *line, bool selected) {
+    strcpy(line, selected ? ">" : " ");
+    if (OPL2_VOICES <= 9) strcat(line, "ACT:");
+    char *cell = line + strlen(line);
+    for (int i = 0; i < OPL2_VOICES; i++) {
+        uint8_t level = engine.voice_level[i];
+        *cell++ = level ? (char)(VU_GLYPH + level - 1) : '.';
+    }
+    *cell = '\0';
+}
+
+// Bars of 1 to 8 rows, bottom up
+static void define_meter_glyphs(void) {
+    for (uint8_t slot = 0; slot < VU_STEPS; slot++) {
+        uint8_t rows[8];
+        for (uint8_t r = 0; r < 8; r++) rows[r] = (r >= 7 - slot) ? 0x1F : 0x00;
+        lcd_define_char(slot, rows);
+    }
+}
+
+// Share of the last second the OPL2 bus was busy, rounded up so any
+// traffic shows
+static unsigned bus_percent(void) {
+    return (engine.load.bus + 9) / 10;
+}
+
 static void render_display(void) {
+    PERF_BEGIN(RENDER_DISPLAY);
     char line[21];
     
-    // Line 1: MODE
+    // Line 1: MODE and instrument bank
     lcd_set_cursor(0, 0);
-    if (cursor_line == 0) {
-        snprintf(line, sizeof(line), ">MODE: %-13s", current_mode == MODE_SONG ? "SONG" : "MIDI-IN");
-    } else {
-        snprintf(line, sizeof(line), " MODE: %-13s", current_mode == MODE_SONG ? "SONG" : "MIDI-IN");
-    }
+    uint8_t bank = bank_get_current();
+    snprintf(line, sizeof(line), "%cMODE: %-7s %-4s%u", cursor_line == 0 ? '>' : ' ',
+             current_mode == MODE_SONG ? "SONG" : "MIDI-IN",
+             bank_format_name(bank_get_format(bank)), bank);
     lcd_print(line);
     
     // Line 2: Channel info or Song name
     lcd_set_cursor(0, 1);
     if (current_mode == MODE_MIDI_IN) {
-        // Show MIDI channel (1-9 or ALL)
+        // Show MIDI channel (1-9 or ALL) and how busy the chip bus is
         char prefix = (cursor_line == 1) ? '>' : ' ';
-        if (selected_channel == CHANNEL_ALL) {
-            snprintf(line, sizeof(line), "%cCh:ALL          ", prefix);
-        } else {
-            snprintf(line, sizeof(line), "%cCh:%02d           ", prefix, selected_channel + 1);
-        }
+        char channel[4] = "ALL";
+        if (selected_channel != CHANNEL_ALL) snprintf(channel, sizeof(channel), "%02d", selected_channel + 1);
+        snprintf(line, sizeof(line), "%cCh:%-3s      bus%3u%%", prefix, channel, bus_percent());
     } else {
-        // Show song name
-        if (cursor_line == 1) {
-            snprintf(line, sizeof(line), ">%-19s", song_name);
+        // Show song name, source and tempo scale ('*' while adjusting)
+        char prefix = tempo_edit_mode ? '*' : (cursor_line == 1) ? '>' : ' ';
+        song_source_t source = song_player_get_source();
+        char name[11];
+        const char *tag = "EVT";
+        if (source == SONG_SOURCE_MUS) {
+            mus_get_name(song_player_get_mus(), name, sizeof(name));
+            tag = "MUS";
+        } else if (source == SONG_SOURCE_TRACKER) {
+            tracker_get_name(song_player_get_tracker(), name, sizeof(name));
+            tag = "RAD";
         } else {
-            snprintf(line, sizeof(line), " %-19s", song_name);
+            snprintf(name, sizeof(name), "%.10s", song_name);
+            if (source == SONG_SOURCE_STREAM) tag = "REG";
         }
+        snprintf(line, sizeof(line), "%c%-10.10s %-3s %3u%%", prefix, name, tag,
+                 song_player_get_tempo_scale());
     }
     lcd_print(line);
     
@@ -107,20 +162,23 @@ static void render_display(void) {
         // Show patch name for selected channel
         // Get the patch for the current channel (or channel 0 if ALL)
         uint8_t display_channel = (selected_channel == CHANNEL_ALL) ? 0 : selected_channel;
-        uint8_t current_program = midi_get_program(display_channel);
+        uint8_t current_program = engine.program[display_channel];
         
         char patch_name[15];
-        strncpy(patch_name, patch_names[current_program], 14);
-        patch_name[14] = '\0';
+        bank_get_name(current_program, patch_name, sizeof(patch_name));
         char prefix = (cursor_line == 2) ? '>' : ' ';
         snprintf(line, sizeof(line), "%cP%03d:%-14s", prefix, current_program, patch_name);
     } else {
-        // Show playing status
+        // Show playing status (and the master's tempo when slaved to MIDI clock)
         bool is_playing = song_player_is_playing();
-        if (cursor_line == 2) {
-            snprintf(line, sizeof(line), ">%-19s", is_playing ? "Playing..." : "Paused");
+        char prefix = (cursor_line == 2) ? '>' : ' ';
+        uint16_t bpm = song_player_get_clock_bpm();
+        if (song_player_get_clock_sync() && bpm > 0) {
+            snprintf(line, sizeof(line), "%c%-7s %3ubpm%4u%%", prefix, is_playing ? "Playing" : "Paused",
+                     bpm, bus_percent());
         } else {
-            snprintf(line, sizeof(line), " %-19s", is_playing ? "Playing..." : "Paused");
+            snprintf(line, sizeof(line), "%c%-12sbus%3u%%", prefix, is_playing ? "Playing..." : "Paused",
+                     bus_percent());
         }
     }
     lcd_print(line);
@@ -128,36 +186,54 @@ static void render_display(void) {
     // Line 4: Voice activity or playback controls
     lcd_set_cursor(0, 3);
     if (current_mode == MODE_MIDI_IN) {
-        // Show active voices as dots
-        if (cursor_line == 3) {
-            strcpy(line, ">ACT:");
-        } else {
-            strcpy(line, " ACT:");
-        }
-        for (int i = 0; i < 9; i++) {
-            strcat(line, voice_states[i] ? "\xFF" : ".");  // Full block for active voice
-        }
+        // Show a VU meter per voice
+        append_meters(line, cursor_line == 3);
     } else {
-        // Show voice activity in SONG mode too
-        if (cursor_line == 3) {
-            strcpy(line, ">ACT:");
-        } else {
-            strcpy(line, " ACT:");
-        }
-        for (int i = 0; i < 9; i++) {
-            strcat(line, voice_states[i] ? "\xFF" : ".");  // Full block for active voice
-        }
+        // Show the meters in SONG mode too
+        append_meters(line, cursor_line == 3);
+        // Clock source - press to toggle (one letter beside 18 meters)
+        bool ext = song_player_get_clock_sync();
+        if (OPL2_VOICES <= 9) strcat(line, ext ? "   EXT" : "   INT");
+        else strcat(line, ext ? "E" : "I");
     }
     lcd_print(line);
+
+    // Only the cells that changed go out
+    lcd_flush();
+    PERF_END(RENDER_DISPLAY);
+}
+
+#if LCD_STATS_MS > 0
+static void report_lcd_traffic(uint32_t now) {
+    static uint32_t last_report = 0;
+    static uint32_t last_bytes = 0;
+    if (now - last_report < LCD_STATS_MS) return;
+
+    uint32_t bytes = lcd_get_i2c_bytes();
+    printf("LCD: %lu I2C bytes/s\n", (unsigned long)((uint64_t)(bytes - last_bytes) * 1000 / (now - last_report)));
+    last_report = now;
+    last_bytes = bytes;
 }
+#endif
 
 void menu_init(void) {
     encoder_init();
+    define_meter_glyphs();
     menu_dirty = true;
 }
 
+// Program Change through the engine (Core 1 owns the MIDI state)
+static void send_program(uint8_t channel, uint8_t program) {
+    SongEvent e = { .type = 3, .delay_ms = 0, .channel = channel, .note = program,
+                    .source = MIDI_SOURCE_INTERNAL };
+    audio_engine_add_event(&e);
+}
+
 void menu_update(void) {
     uint32_t now = to_ms_since_boot(get_absolute_time());
+
+    // Engine state first, so edits below start from what Core 1 has now
+    bool engine_changed = audio_engine_get_snapshot(&engine) != engine_generation;
     
     // Handle encoder rotation - moves cursor up/down
     int delta = encoder_get_delta();
@@ -187,7 +263,7 @@ void menu_update(void) {
             // Adjust patch selection while in edit mode
             // Get starting point from current channel's program
             uint8_t display_channel = (selected_channel == CHANNEL_ALL) ? 0 : selected_channel;
-            int new_program = (int)midi_get_program(display_channel) + delta;
+            int new_program = (int)engine.program[display_channel] + delta;
             while (new_program < 0) new_program += 256;
             while (new_program > 255) new_program -= 256;
             
@@ -195,13 +271,19 @@ void menu_update(void) {
             if (selected_channel == CHANNEL_ALL) {
                 // Set all 9 MIDI channels to this patch
                 for (int i = 0; i < 9; i++) {
-                    midi_set_program(i, (uint8_t)new_program);
+                    send_program(i, (uint8_t)new_program);
                 }
             } else {
                 // Set specific MIDI channel
-                midi_set_program(selected_channel, (uint8_t)new_program);
+                send_program(selected_channel, (uint8_t)new_program);
             }
             menu_dirty = true;
+        } else if (current_mode == MODE_SONG && cursor_line == 1 && tempo_edit_mode) {
+            // Adjust tempo scale while in edit mode
+            int new_tempo = (int)song_player_get_tempo_scale() + delta * TEMPO_STEP;
+            if (new_tempo < 0) new_tempo = 0;  // Player clamps to its own range
+            song_player_set_tempo_scale((uint16_t)new_tempo);
+            menu_dirty = true;
         } else {
             // Move cursor
             int new_cursor = cursor_line + delta;
@@ -210,6 +292,7 @@ void menu_update(void) {
             cursor_line = new_cursor;
             patch_edit_mode = false;
             channel_edit_mode = false;
+            tempo_edit_mode = false;
             menu_dirty = true;
         }
     }
@@ -224,16 +307,19 @@ void menu_update(void) {
             
             if (new_mode == MODE_MIDI_IN) {
                 // Switching to MIDI-IN: stop song player, enable MIDI input
-                song_player_pause();
+                song_player_set_clock_sync(false);
+                song_player_stop();
                 midi_input_set_enabled(true);
                 patch_edit_mode = false;
                 channel_edit_mode = false;
+                tempo_edit_mode = false;
             } else {
                 // Switching to SONG: disable MIDI input, start song player
                 midi_input_set_enabled(false);
                 song_player_play();
                 patch_edit_mode = false;
                 channel_edit_mode = false;
+                tempo_edit_mode = false;
             }
             
             current_mode = new_mode;
@@ -244,8 +330,11 @@ void menu_update(void) {
                 // Toggle channel edit mode
                 channel_edit_mode = !channel_edit_mode;
                 menu_dirty = true;
+            } else {
+                // Toggle tempo edit mode
+                tempo_edit_mode = !tempo_edit_mode;
+                menu_dirty = true;
             }
-            // In SONG mode, could skip to next song (future)
         }
         else if (cursor_line == 2) {
             if (current_mode == MODE_MIDI_IN) {
@@ -263,25 +352,45 @@ void menu_update(void) {
             }
         }
         else if (cursor_line == 3) {
-            // Execute playback control (future)
+            if (current_mode == MODE_SONG) {
+                // Toggle internal clock / external MIDI clock
+                song_player_set_clock_sync(!song_player_get_clock_sync());
+            }
             menu_dirty = true;
         }
     }
     else if (btn == ENCODER_BTN_LONG_PRESS) {
         // Long press: back out / decrease value
-        if (cursor_line == 2 && current_mode == MODE_MIDI_IN) {
+        if (cursor_line == 0) {
+            // Cycle through the instrument banks found in flash
+            audio_engine_select_bank(bank_next(bank_get_current()));
+            menu_dirty = true;
+        }
+        else if (cursor_line == 1 && current_mode == MODE_SONG) {
+            // Next song: event list, register stream, MUS lumps and tracker modules in flash
+            song_player_next_source();
+            tempo_edit_mode = false;
+            menu_dirty = true;
+        }
+        else if (cursor_line == 2 && current_mode == MODE_MIDI_IN) {
             // Decrease volume
             volume = (volume - 10 < 0) ? 0 : volume - 10;
             menu_dirty = true;
         }
     }
     
-    // Update display at 20Hz or when dirty
-    if (menu_dirty || (now - last_update) > 50) {
+    // Redraw when the menu changed, or the engine published something new
+    // (no more than every REDRAW_MIN_MS); nothing to show means no redraw
+    if (menu_dirty || (engine_changed && now - last_update >= REDRAW_MIN_MS) ||
+        now - last_update >= REDRAW_IDLE_MS) {
+        engine_generation = engine.generation;
         render_display();
         last_update = now;
         menu_dirty = false;
     }
+#if LCD_STATS_MS > 0
+    report_lcd_traffic(now);
+#endif
 }
 
 void menu_set_mode(menu_mode_t mode) {
@@ -295,19 +404,6 @@ menu_mode_t menu_get_mode(void) {
     return current_mode;
 }
 
-void menu_update_voices(const bool voice_active[9]) {
-    bool changed = false;
-    for (int i = 0; i < 9; i++) {
-        if (voice_states[i] != voice_active[i]) {
-            voice_states[i] = voice_active[i];
-            changed = true;
-        }
-    }
-    if (changed) {
-        menu_dirty = true;
-    }
-}
-
 void menu_set_song_name(const char *name) {
     strncpy(song_name, name, 20);
     song_name[20] = '\0';
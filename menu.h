@@ -42,13 +42,6 @@ void menu_set_mode(menu_mode_t mode);
  */
 menu_mode_t menu_get_mode(void);
 
-/**
- * Update voice activity indicators
- * 
- * @param voice_active Array of 9 bools indicating active voices
- */
-void menu_update_voices(const bool voice_active[9]);
-
 /**
  * Set song name for display
  * 
@@ -1,10 +1,22 @@
 import mido
 import sys
+from bisect import bisect_right
 
 # --- CONFIGURATION ---
 # Default to GM (No translation needed usually)
 USE_MT32_MAP = False
 
+# Controllers passed through to the synth (Sustain, Sostenuto)
+PASS_CONTROLLERS = (64, 66)
+
+# Plan voice allocation offline (--prealloc) and tag notes with voice hints
+USE_PREALLOC = False
+
+# Voice hint bits (SongEvent.voice, see queue.h)
+VOICE_HINT_ASSIGNED = 0x10
+VOICE_HINT_LOADED = 0x20
+MELODIC_VOICES = 8   # Voice 8 belongs to the drums
+
 # --- MAPS ---
 
 # Standard Remaps for Doom/GM (Fixes weak patches)
@@ -37,18 +49,124 @@ MT32_TO_GM = {
     # ... Many MT-32 patches don't map cleanly, but this covers the basics.
 }
 
+# --- OFFLINE VOICE ALLOCATION ---
+# The song is known in full, so unlike the live allocator this one can look
+# ahead (Belady): steal the note that would stop soonest anyway, and on a
+# free voice keep the patches that are needed again soonest.
+# Events are (tick, type, channel, data, velocity); returns a hint per event.
+
+def note_ends(events):
+    """Index of the event where each note-on stops sounding
+    (its note-off, the sustain pedal release or a retrigger)."""
+    end = {}
+    sounding = {}   # (channel, note) -> event index
+    held = {}       # channel -> notes waiting for the sustain pedal
+    pedal = {}
+    for i, (tick, etype, ch, data, vel) in enumerate(events):
+        if etype == 1:
+            if (ch, data) in sounding:
+                end[sounding[(ch, data)]] = i
+            sounding[(ch, data)] = i
+        elif etype == 0 and (ch, data) in sounding:
+            idx = sounding.pop((ch, data))
+            if pedal.get(ch):
+                held.setdefault(ch, []).append(idx)
+            else:
+                end[idx] = i
+        elif etype == 4 and data == 64:
+            pedal[ch] = vel >= 64
+            if not pedal[ch]:
+                for idx in held.pop(ch, []):
+                    end[idx] = i
+    return end
+
+def preallocate(events):
+    end = note_ends(events)
+    never = len(events)
+
+    # Note-on ticks per program, for "when is this patch needed next"
+    program = [0] * 16
+    uses = {}
+    for tick, etype, ch, data, vel in events:
+        if etype == 3:
+            program[ch] = data
+        elif etype == 1 and ch != 9:
+            uses.setdefault(program[ch], []).append(tick)
+
+    def next_use(prog, tick):
+        ticks = uses.get(prog, [])
+        i = bisect_right(ticks, tick)
+        return ticks[i] if i < len(ticks) else float('inf')
+
+    # Simulated voices: last note (channel, note, end index) and loaded patch
+    note = [None] * MELODIC_VOICES
+    patch = [None] * MELODIC_VOICES
+    program = [0] * 16
+    hints = [0] * len(events)
+    steals = 0
+
+    for i, (tick, etype, ch, data, vel) in enumerate(events):
+        if etype == 3:
+            program[ch] = data
+            continue
+        if ch == 9 or etype not in (0, 1):
+            continue
+
+        sounding = [v for v in range(MELODIC_VOICES) if note[v] and note[v][2] >= i]
+        same = [v for v in sounding if note[v][:2] == (ch, data)]
+
+        if etype == 0:
+            # Point the note-off at its voice, unless the note was stolen
+            if same:
+                hints[i] = VOICE_HINT_ASSIGNED | same[0]
+            continue
+
+        prog = program[ch]
+        free = [v for v in range(MELODIC_VOICES) if v not in sounding]
+        if same:
+            v = same[0]
+        elif free:
+            loaded = [v for v in free if patch[v] == prog]
+            # Otherwise overwrite the patch needed furthest in the future
+            v = loaded[0] if loaded else max(free, key=lambda v: next_use(patch[v], tick))
+        else:
+            # Steal the note that was going to stop soonest
+            v = min(sounding, key=lambda v: (note[v][2], -next_use(patch[v], tick)))
+            steals += 1
+
+        hints[i] = VOICE_HINT_ASSIGNED | v
+        if patch[v] == prog:
+            hints[i] |= VOICE_HINT_LOADED
+        patch[v] = prog
+        note[v] = (ch, data, end.get(i, never))
+
+    return hints, steals
+
 def midi_to_c(input_file, output_file, array_name="midi_song"):
     mid = mido.MidiFile(input_file)
+    song = []    # (tick, type, channel, data, velocity)
     events = []
     
     print(f"Parsing {input_file} (MT-32 Mode: {USE_MT32_MAP})...")
     
-    pending_time = 0.0
+    # Keep everything in ticks - the player converts with the tempo map,
+    # so no delta is rounded to whole milliseconds here
+    abs_tick = 0
+    tempo_map = []
 
-    for msg in mid:
-        pending_time += msg.time
+    for msg in mido.merge_tracks(mid.tracks):
+        abs_tick += msg.time
+
+        if msg.type == 'set_tempo':
+            if tempo_map and tempo_map[-1][0] == abs_tick:
+                tempo_map[-1] = (abs_tick, msg.tempo)
+            else:
+                tempo_map.append((abs_tick, msg.tempo))
+            continue
         
-        if msg.type not in ['note_on', 'note_off', 'program_change']:
+        if msg.type not in ['note_on', 'note_off', 'program_change', 'control_change']:
+            continue
+        if msg.type == 'control_change' and msg.control not in PASS_CONTROLLERS:
             continue
 
         # --- NEW CHANNEL MAPPING FOR POLYPHONY ---
@@ -84,6 +202,13 @@ def midi_to_c(input_file, output_file, array_name="midi_song"):
                 # Direct GM mapping
                 data_byte = GM_FIX_MAP.get(original, original)
             
+        elif msg.type == 'control_change':
+            if opl_ch == 9: continue # Drums ignore the pedals
+
+            event_type = 4
+            data_byte = msg.control
+            velocity = msg.value
+
         elif msg.type == 'note_on' and msg.velocity > 0:
             event_type = 1
             data_byte = msg.note
@@ -94,29 +219,56 @@ def midi_to_c(input_file, output_file, array_name="midi_song"):
             data_byte = msg.note
             velocity = 0
 
-        # --- Output ---
-        delay_ms = int(pending_time * 1000)
-        events.append(f"    {{ .type={event_type}, .delay_ms={delay_ms}, .channel={opl_ch}, .note={data_byte}, .velocity={velocity} }},")
-        pending_time = 0.0
+        song.append((abs_tick, event_type, opl_ch, data_byte, velocity))
+
+    hints = [0] * len(song)
+    if USE_PREALLOC:
+        hints, steals = preallocate(song)
+        loaded = sum(1 for h in hints if h & VOICE_HINT_LOADED)
+        print(f"Voice plan: {steals} steals, {loaded} notes find their patch loaded.")
+
+    # --- Output ---
+    last_tick = 0
+    for (tick, event_type, opl_ch, data_byte, velocity), hint in zip(song, hints):
+        pending_ticks = tick - last_tick
+        last_tick = tick
+
+        # Deltas are 16-bit: long rests are split with Wait (255) events
+        while pending_ticks > 0xFFFF:
+            events.append(f"    {{ .type=255, .delta_ticks={0xFFFF} }},")
+            pending_ticks -= 0xFFFF
+        voice = f", .voice=0x{hint:02X}" if hint else ""
+        events.append(f"    {{ .type={event_type}{voice}, .delta_ticks={pending_ticks}, .channel={opl_ch}, .note={data_byte}, .velocity={velocity} }},")
+
+    # MIDI default tempo applies until the first Set Tempo
+    if not tempo_map or tempo_map[0][0] != 0:
+        tempo_map.insert(0, (0, 500000))
 
     with open(output_file, 'w') as f:
         f.write(f"#ifndef {array_name.upper()}_H\n#define {array_name.upper()}_H\n\n")
-        f.write('#include "opl.h"\n\n') # Use opl.h for the struct
-        f.write(f"const SongEvent {array_name}[] = {{\n")
+        f.write('#include "song_format.h"\n\n') # SongTickEvent / TempoChange structs
+        f.write(f"#define {array_name.upper()}_PPQ {mid.ticks_per_beat}\n\n")
+        f.write(f"const TempoChange {array_name}_tempo[] = {{\n")
+        f.write("\n".join(f"    {{ .tick={t}, .us_per_quarter={us} }}," for t, us in tempo_map))
+        f.write("\n};\n\n")
+        f.write(f"const SongTickEvent {array_name}[] = {{\n")
         f.write("\n".join(events))
-        f.write("\n    { .type=2, .delay_ms=0 } // End\n")
+        f.write("\n    { .type=2, .delta_ticks=0 } // End\n")
         f.write("};\n\n#endif\n")
     
-    print(f"Done! Saved {len(events)} events.")
+    print(f"Done! Saved {len(events)} events, {len(tempo_map)} tempo changes.")
 
 if __name__ == "__main__":
     if len(sys.argv) < 2:
-        print("Usage: python midi2c.py <file.mid> [--mt32]")
+        print("Usage: python midi2c.py <file.mid> [--mt32] [--prealloc]")
     else:
         # Simple flag check
         if "--mt32" in sys.argv:
             USE_MT32_MAP = True
             # Remove flag from args so filenames align
             sys.argv.remove("--mt32")
+        if "--prealloc" in sys.argv:
+            USE_PREALLOC = True
+            sys.argv.remove("--prealloc")
             
         midi_to_c(sys.argv[1], "song_data.h", "midi_song")
\ No newline at end of file
@@ -2,16 +2,21 @@
  * midi_input.c
  * 
  * MIDI Input Handler Implementation
- * Receives MIDI data via UART and sends events to audio engine
+ * Receives MIDI data via UART and USB-MIDI and sends events to audio engine
  */
 
 #include "midi_input.h"
 #include "audio_engine.h"
 #include "queue.h"
 #include "menu.h"
+#include "sysex.h"
+#include "song_player.h"
+#include "midi_parser.h"
+#include "perf.h"
 #include "pico/stdlib.h"
 #include "hardware/uart.h"
 #include "hardware/irq.h"
+#include "hardware/sync.h"
 #include <stdio.h>
 
 // MIDI UART Configuration
@@ -21,63 +26,133 @@
 #define MIDI_BAUD_RATE 31250
 #define CHANNEL_ALL 255  // Must match menu.c definition
 
-// MIDI Parser State
+// MIDI Parser State - one parser per source so running status and
+// SysEx from DIN and USB never mix
 static bool enabled = false;
-static uint8_t running_status = 0;
-static uint8_t data_byte_count = 0;
-static uint8_t midi_data[3];
+static bool clock_sync = false;
+static MidiParser din_parser;
+static MidiParser usb_parser;
+static uint8_t sysex_source = MIDI_SOURCE_INTERNAL;  // Source owning the SysEx decoder (INTERNAL = free)
 
-// Forward declaration
-static void process_midi_message(void);
+// Merging DIN and USB
+#define USB_HOLD_MS 2000  // USB_FIRST: DIN stays muted this long after USB activity
+static midi_merge_t merge_policy = MIDI_MERGE_ALL;
+static volatile uint32_t last_usb_ms = 0;
+static volatile bool usb_seen = false;
 
-// UART interrupt handler for immediate MIDI byte processing
-static void on_uart_rx(void) {
-    while (uart_is_readable(MIDI_UART)) {
-        uint8_t byte = uart_getc(MIDI_UART);
-        
-        if (!enabled) continue;
-        
-        // Check if this is a status byte (bit 7 set)
-        if (byte & 0x80) {
-            // Status byte
-            if (byte >= 0xF0) {
-                // System message - ignore for now
-                running_status = 0;
-                data_byte_count = 0;
-                continue;
+// System real-time bytes: clock and transport for the song player
+static void process_realtime(uint8_t byte) {
+    switch (byte) {
+        case 0xF8: song_player_midi_clock(); break;
+        case 0xFA: song_player_midi_start(); break;
+        case 0xFB: song_player_midi_continue(); break;
+        case 0xFC: song_player_midi_stop(); break;
+        default: break;  // Active sensing, reset, undefined
+    }
+}
+
+// Does the merge policy let this source through right now?
+static bool source_allowed(uint8_t source) {
+    switch (merge_policy) {
+        case MIDI_MERGE_DIN_ONLY:
+            return source == MIDI_SOURCE_DIN;
+        case MIDI_MERGE_USB_ONLY:
+            return source == MIDI_SOURCE_USB;
+        case MIDI_MERGE_USB_FIRST:
+            if (source == MIDI_SOURCE_USB) return true;
+            return !usb_seen || to_ms_since_boot(get_absolute_time()) - last_usb_ms > USB_HOLD_MS;
+        case MIDI_MERGE_ALL:
+        default:
+            return true;
+    }
+}
+
+static void handle_parsed(midi_parse_result_t result, const MidiMessage *msg, uint8_t source) {
+    switch (result) {
+        case MIDI_PARSE_CHANNEL: {
+            // Channel messages are only wanted in MIDI-IN mode
+            SongEvent event;
+            if (!enabled || !midi_message_to_event(msg, source, &event)) break;
+
+            if (source == MIDI_SOURCE_USB) {
+                last_usb_ms = to_ms_since_boot(get_absolute_time());
+                usb_seen = true;
             }
-            
-            // Channel message
-            running_status = byte;
-            midi_data[0] = byte;
-            data_byte_count = 0;
-        } else {
-            // Data byte
-            if (running_status == 0) {
-                // No running status, ignore
-                continue;
+            // Note-offs always pass so a policy change never leaves notes hanging
+            if (event.type == 0 || source_allowed(source)) {
+                audio_engine_add_event(&event);
             }
-            
-            // Store data byte
-            midi_data[1 + data_byte_count] = byte;
-            data_byte_count++;
-            
-            // Determine if we have a complete message
-            uint8_t command = running_status & 0xF0;
-            uint8_t expected_bytes = 2; // Most messages are 2 data bytes
-            
-            if (command == 0xC0 || command == 0xD0) {
-                // Program Change and Channel Pressure only have 1 data byte
-                expected_bytes = 1;
+            break;
+        }
+
+        case MIDI_PARSE_REALTIME:
+            if (clock_sync && source_allowed(source)) process_realtime(msg->status);
+            break;
+
+        case MIDI_PARSE_SONG_POSITION:
+            // 14-bit position in MIDI beats (16th notes), LSB first
+            if (clock_sync && source_allowed(source)) {
+                song_player_midi_song_position(msg->data[0] | (msg->data[1] << 7));
             }
-            
-            if (data_byte_count >= expected_bytes) {
-                // Complete message received - process immediately
-                process_midi_message();
-                data_byte_count = 0;
+            break;
+
+        case MIDI_PARSE_SYSEX_BEGIN:
+            // SysEx - patch uploads are decoded as they stream in, one source at a time
+            if (enabled && sysex_source == MIDI_SOURCE_INTERNAL && source_allowed(source)) {
+                sysex_begin();
+                sysex_source = source;
             }
-        }
+            break;
+
+        case MIDI_PARSE_SYSEX_DATA:
+            if (sysex_source == source) sysex_byte(msg->data[0]);
+            break;
+
+        case MIDI_PARSE_SYSEX_END:
+            if (sysex_source == source) {
+                sysex_end();
+                sysex_source = MIDI_SOURCE_INTERNAL;
+            }
+            break;
+
+        case MIDI_PARSE_NONE:
+            break;
+    }
+}
+
+static void feed_byte(MidiParser *parser, uint8_t byte, uint8_t source) {
+    MidiMessage msg;
+    midi_parse_result_t result = midi_parse_byte(parser, byte, &msg);
+    handle_parsed(result, &msg, source);
+
+    if (result == MIDI_PARSE_SYSEX_END && byte != 0xF7) {
+        // SysEx was cut short by another status byte - now process that byte
+        result = midi_parse_byte(parser, byte, &msg);
+        handle_parsed(result, &msg, source);
+    }
+}
+
+// Turn the UART interrupt on while anything wants MIDI bytes
+static void update_uart_irq(void) {
+    int uart_irq = MIDI_UART == uart0 ? UART0_IRQ : UART1_IRQ;
+    bool listen = enabled || clock_sync;
+
+    if (listen) {
+        uart_set_irq_enables(MIDI_UART, true, false);
+        irq_set_enabled(uart_irq, true);
+    } else {
+        irq_set_enabled(uart_irq, false);
+        uart_set_irq_enables(MIDI_UART, false, false);
+    }
+}
+
+// UART interrupt handler for immediate MIDI byte processing
+static void on_uart_rx(void) {
+    PERF_BEGIN(UART_RX);
+    while (uart_is_readable(MIDI_UART)) {
+        feed_byte(&din_parser, uart_getc(MIDI_UART), MIDI_SOURCE_DIN);
     }
+    PERF_END(UART_RX);
 }
 
 void midi_input_init(void) {
@@ -104,101 +179,58 @@ void midi_input_init(void) {
     printf("MIDI Input initialized on GPIO-%d with interrupt\n", MIDI_UART_RX_PIN);
     
     enabled = false;
-    running_status = 0;
-    data_byte_count = 0;
+    midi_parser_init(&din_parser);
+    midi_parser_init(&usb_parser);
 }
 
 void midi_input_set_enabled(bool en) {
     enabled = en;
     
     // Enable or disable UART RX interrupt to prevent stray data interference
-    int uart_irq = MIDI_UART == uart0 ? UART0_IRQ : UART1_IRQ;
-    
     if (enabled) {
         printf("MIDI Input enabled\n");
-        // Flush any old data
-        while (uart_is_readable(MIDI_UART)) {
-            uart_getc(MIDI_UART);
-        }
-        running_status = 0;
-        data_byte_count = 0;
-        
-        // Enable interrupt
-        uart_set_irq_enables(MIDI_UART, true, false);
-        irq_set_enabled(uart_irq, true);
     } else {
         printf("MIDI Input disabled\n");
-        
-        // Disable interrupt to prevent interference
-        irq_set_enabled(uart_irq, false);
-        uart_set_irq_enables(MIDI_UART, false, false);
-        
-        // Flush any pending data
-        while (uart_is_readable(MIDI_UART)) {
-            uart_getc(MIDI_UART);
-        }
-        running_status = 0;
-        data_byte_count = 0;
     }
-}
 
-static void process_midi_message(void) {
-    uint8_t status = midi_data[0];
-    uint8_t channel = status & 0x0F;
-    uint8_t command = status & 0xF0;
-    
-    // Accept all MIDI channels - patches are managed via menu
-    
-    SongEvent event = {0};
-    
-    switch (command) {
-        case 0x80: // Note Off
-            event.type = 0;  // Note Off
-            event.channel = channel;
-            event.note = midi_data[1];
-            event.velocity = 0;
-            event.delay_ms = 0;
-            audio_engine_add_event(&event);
-            break;
-            
-        case 0x90: // Note On
-            if (midi_data[2] == 0) {
-                // Velocity 0 = Note Off
-                event.type = 0;  // Note Off
-                event.channel = channel;
-                event.note = midi_data[1];
-                event.velocity = 0;
-                event.delay_ms = 0;
-            } else {
-                // Real Note On
-                event.type = 1;  // Note On
-                event.channel = channel;
-                event.note = midi_data[1];
-                event.velocity = midi_data[2];
-                event.delay_ms = 0;
-            }
-            audio_engine_add_event(&event);
-            break;
-            
-        case 0xC0: // Program Change
-            event.type = 3;  // Program Change
-            event.channel = channel;
-            event.note = midi_data[1];  // Program number
-            event.velocity = 0;
-            event.delay_ms = 0;
-            audio_engine_add_event(&event);
-            break;
-            
-        default:
-            // Ignore other messages for now
-            break;
+    // Flush any old data
+    while (uart_is_readable(MIDI_UART)) {
+        uart_getc(MIDI_UART);
+    }
+    uint32_t irq_state = save_and_disable_interrupts();
+    midi_parser_init(&din_parser);
+    midi_parser_init(&usb_parser);
+    if (sysex_source != MIDI_SOURCE_INTERNAL) {
+        sysex_end();
+        sysex_source = MIDI_SOURCE_INTERNAL;
     }
+    restore_interrupts(irq_state);
+
+    update_uart_irq();
+}
+
+void midi_input_set_clock_sync(bool en) {
+    clock_sync = en;
+    update_uart_irq();
+}
+
+void midi_input_set_merge_policy(midi_merge_t policy) {
+    merge_policy = policy;
 }
 
-void midi_input_update(void) {
-    // MIDI is now interrupt-driven, so this function is mostly a no-op
-    // Just used to ensure any stale data is cleared when re-enabling
-    if (!enabled) {
-        return;
+midi_merge_t midi_input_get_merge_policy(void) {
+    return merge_policy;
+}
+
+void midi_input_usb_packet(const uint8_t packet[4]) {
+    uint8_t length = midi_usb_packet_length(packet);
+
+    // USB is serviced from the main loop; keep the UART interrupt out while
+    // the shared handlers (song player clock, SysEx decoder) run
+    uint32_t irq_state = save_and_disable_interrupts();
+    for (uint8_t i = 0; i < length; i++) {
+        feed_byte(&usb_parser, packet[1 + i], MIDI_SOURCE_USB);
     }
+    restore_interrupts(irq_state);
 }
+
@@ -2,7 +2,7 @@
  * midi_input.h
  * 
  * MIDI Input Handler
- * Receives MIDI data via UART and sends events to audio engine
+ * Receives MIDI data via UART and USB-MIDI and sends events to audio engine
  */
 
 #ifndef MIDI_INPUT_H
@@ -11,18 +11,20 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+// How DIN and USB input are combined
+typedef enum {
+    MIDI_MERGE_ALL,        // Both sources play (default)
+    MIDI_MERGE_DIN_ONLY,   // USB ignored
+    MIDI_MERGE_USB_ONLY,   // DIN ignored
+    MIDI_MERGE_USB_FIRST   // DIN muted while USB has been active in the last 2 s
+} midi_merge_t;
+
 /**
  * Initialize MIDI input on GPIO-17 (UART0 RX)
  * Sets up 31250 baud, 8N1
  */
 void midi_input_init(void);
 
-/**
- * Update MIDI input - process incoming bytes
- * Call this regularly from main loop when in MIDI-IN mode
- */
-void midi_input_update(void);
-
 /**
  * Enable/disable MIDI input processing
  * 
@@ -30,4 +32,38 @@ void midi_input_update(void);
  */
 void midi_input_set_enabled(bool enabled);
 
+/**
+ * Enable/disable MIDI clock and transport reception
+ * Real-time messages (Clock, Start, Stop, Continue) and Song Position
+ * Pointer are passed to the song player even while channel messages
+ * are disabled
+ * 
+ * @param enabled true to follow external clock
+ */
+void midi_input_set_clock_sync(bool enabled);
+
+/**
+ * Choose how DIN and USB input are merged
+ * Note-offs always pass so switching policy never leaves notes hanging
+ * 
+ * @param policy Merge policy
+ */
+void midi_input_set_merge_policy(midi_merge_t policy);
+
+/**
+ * Get the current merge policy
+ * 
+ * @return Merge policy
+ */
+midi_merge_t midi_input_get_merge_policy(void);
+
+/**
+ * Process one USB-MIDI event packet (called by the USB device task)
+ * Goes through the same parser and event path as the DIN port, tagged
+ * MIDI_SOURCE_USB
+ * 
+ * @param packet 4-byte USB-MIDI event packet
+ */
+void midi_input_usb_packet(const uint8_t packet[4]);
+
 #endif // MIDI_INPUT_H
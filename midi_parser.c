@@ -0,0 +1,158 @@
+/**
+ * midi_parser.c
+ *
+ * MIDI Byte Stream and USB-MIDI Packet Parser Implementation
+ */
+
+#include "midi_parser.h"
+
+// Data bytes that follow a status byte
+static uint8_t data_length(uint8_t status) {
+    switch (status & 0xF0) {
+        case 0xC0: // Program Change
+        case 0xD0: // Channel Pressure
+            return 1;
+
+        case 0xF0: // System common
+            switch (status) {
+                case 0xF1: return 1;  // MTC Quarter Frame
+                case 0xF2: return 2;  // Song Position Pointer
+                case 0xF3: return 1;  // Song Select
+                default:   return 0;
+            }
+
+        default:
+            return 2;
+    }
+}
+
+void midi_parser_init(MidiParser *parser) {
+    parser->running_status = 0;
+    parser->data_count = 0;
+    parser->expected = 0;
+    parser->in_sysex = false;
+}
+
+midi_parse_result_t midi_parse_byte(MidiParser *parser, uint8_t byte, MidiMessage *msg) {
+    // Real-time messages can appear anywhere, even inside SysEx,
+    // and must not disturb the message being assembled
+    if (byte >= 0xF8) {
+        msg->status = byte;
+        return MIDI_PARSE_REALTIME;
+    }
+
+    if (byte & 0x80) {
+        // Any other status byte ends a SysEx message (F7 normally)
+        if (parser->in_sysex) {
+            parser->in_sysex = false;
+            msg->status = 0xF7;
+            return MIDI_PARSE_SYSEX_END;
+        }
+
+        parser->data_count = 0;
+
+        if (byte == 0xF0) {
+            parser->in_sysex = true;
+            parser->running_status = 0;
+            msg->status = byte;
+            return MIDI_PARSE_SYSEX_BEGIN;
+        }
+
+        // Channel messages set running status; system common messages
+        // with data are collected but cancel it once complete
+        parser->expected = data_length(byte);
+        parser->running_status = (parser->expected > 0) ? byte : 0;
+        return MIDI_PARSE_NONE;
+    }
+
+    // Data byte
+    if (parser->in_sysex) {
+        msg->data[0] = byte;
+        return MIDI_PARSE_SYSEX_DATA;
+    }
+
+    if (parser->running_status == 0) {
+        // No running status, ignore
+        return MIDI_PARSE_NONE;
+    }
+
+    parser->data[parser->data_count++] = byte;
+    if (parser->data_count < parser->expected) {
+        return MIDI_PARSE_NONE;
+    }
+
+    // Complete message
+    msg->status = parser->running_status;
+    msg->data[0] = parser->data[0];
+    msg->data[1] = (parser->expected == 2) ? parser->data[1] : 0;
+    parser->data_count = 0;
+
+    if (msg->status >= 0xF0) {
+        parser->running_status = 0;
+        return (msg->status == 0xF2) ? MIDI_PARSE_SONG_POSITION : MIDI_PARSE_NONE;
+    }
+    return MIDI_PARSE_CHANNEL;
+}
+
+bool midi_message_to_event(const MidiMessage *msg, uint8_t source, SongEvent *event) {
+    uint8_t channel = msg->status & 0x0F;
+    uint8_t command = msg->status & 0xF0;
+
+    event->delay_ms = 0;
+    event->channel = channel;
+    event->source = source;
+
+    switch (command) {
+        case 0x80: // Note Off
+            event->type = 0;
+            event->note = msg->data[0];
+            event->velocity = 0;
+            return true;
+
+        case 0x90: // Note On (velocity 0 = Note Off)
+            event->type = (msg->data[1] == 0) ? 0 : 1;
+            event->note = msg->data[0];
+            event->velocity = msg->data[1];
+            return true;
+
+        case 0xB0: // Control Change (sustain/sostenuto pedals etc.)
+            event->type = 4;
+            event->note = msg->data[0];      // Controller number
+            event->velocity = msg->data[1];  // Controller value
+            return true;
+
+        case 0xC0: // Program Change
+            event->type = 3;
+            event->note = msg->data[0];      // Program number
+            event->velocity = 0;
+            return true;
+
+        case 0xE0: // Pitch Bend
+            event->type = 10;
+            event->note = msg->data[0];      // LSB
+            event->velocity = msg->data[1];  // MSB
+            return true;
+
+        default:
+            // Ignore other messages for now
+            return false;
+    }
+}
+
+uint8_t midi_usb_packet_length(const uint8_t packet[4]) {
+    // MIDI bytes per Code Index Number (USB MIDI 1.0, table 4-1)
+    static const uint8_t cin_length[16] = {
+        0, 0,  // 0x0-0x1: reserved (misc / cable events)
+        2,     // 0x2: two-byte system common
+        3,     // 0x3: three-byte system common
+        3,     // 0x4: SysEx starts or continues
+        1,     // 0x5: single-byte system common, or SysEx ends with one byte
+        2,     // 0x6: SysEx ends with two bytes
+        3,     // 0x7: SysEx ends with three bytes
+        3, 3, 3, 3,  // 0x8-0xB: Note Off, Note On, Poly Pressure, Control Change
+        2, 2,  // 0xC-0xD: Program Change, Channel Pressure
+        3,     // 0xE: Pitch Bend
+        1      // 0xF: single byte
+    };
+    return cin_length[packet[0] & 0x0F];
+}
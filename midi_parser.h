@@ -0,0 +1,82 @@
+/**
+ * midi_parser.h
+ *
+ * MIDI Byte Stream and USB-MIDI Packet Parser
+ * Turns raw MIDI bytes into complete messages and SongEvents
+ *
+ * Pure C with no hardware dependencies, so the same parser runs for the
+ * DIN UART, for USB-MIDI and in a host build. One MidiParser per source
+ * keeps running status and SysEx state apart.
+ */
+
+#ifndef MIDI_PARSER_H
+#define MIDI_PARSER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "queue.h"
+
+// What a byte completed (see midi_parse_byte)
+typedef enum {
+    MIDI_PARSE_NONE,           // Nothing complete yet (or byte ignored)
+    MIDI_PARSE_CHANNEL,        // Channel message: status, data[0], data[1]
+    MIDI_PARSE_REALTIME,       // Real-time byte (0xF8-0xFF) in status
+    MIDI_PARSE_SONG_POSITION,  // Song Position Pointer: data[0] LSB, data[1] MSB
+    MIDI_PARSE_SYSEX_BEGIN,    // 0xF0 received
+    MIDI_PARSE_SYSEX_DATA,     // SysEx data byte in data[0]
+    MIDI_PARSE_SYSEX_END       // 0xF7, or SysEx aborted by another status byte
+} midi_parse_result_t;
+
+typedef struct {
+    uint8_t status;
+    uint8_t data[2];
+} MidiMessage;
+
+typedef struct {
+    uint8_t running_status;
+    uint8_t data[2];
+    uint8_t data_count;
+    uint8_t expected;          // Data bytes the current status needs
+    bool in_sysex;
+} MidiParser;
+
+/**
+ * Reset parser state (running status, partial message, SysEx)
+ */
+void midi_parser_init(MidiParser *parser);
+
+/**
+ * Feed one byte of a MIDI stream
+ * Handles running status, and real-time bytes anywhere in the stream
+ * (including inside SysEx) without disturbing the message being assembled.
+ * A status byte other than 0xF7 that interrupts SysEx reports
+ * MIDI_PARSE_SYSEX_END without being consumed, so feed that byte again.
+ *
+ * @param parser Parser state for this source
+ * @param byte Incoming byte
+ * @param msg Filled in when the result is not MIDI_PARSE_NONE
+ * @return What the byte completed
+ */
+midi_parse_result_t midi_parse_byte(MidiParser *parser, uint8_t byte, MidiMessage *msg);
+
+/**
+ * Translate a channel message into a SongEvent for the audio engine
+ *
+ * @param msg Complete channel message
+ * @param source MIDI_SOURCE_* tag for the event
+ * @param event Filled in on success
+ * @return true if the synth uses this message
+ */
+bool midi_message_to_event(const MidiMessage *msg, uint8_t source, SongEvent *event);
+
+/**
+ * Number of MIDI bytes carried by a USB-MIDI event packet
+ * Byte 0 of a packet is cable number (high nibble) and Code Index Number
+ * (low nibble); bytes 1-3 are MIDI data, padded with zeros.
+ *
+ * @param packet 4-byte USB-MIDI event packet
+ * @return 0-3 bytes (0 for reserved CINs)
+ */
+uint8_t midi_usb_packet_length(const uint8_t packet[4]);
+
+#endif // MIDI_PARSER_H
@@ -9,10 +9,32 @@
 // Track the current Instrument assigned to each MIDI Channel
 static uint8_t midi_ch_program[16] = {0};
 
+// Channel volume per MIDI Channel (CC7)
+static uint8_t midi_ch_volume[16];
+
+// Pitch bend and the controllers the control tick follows
+static int16_t midi_ch_bend[16];
+static uint8_t midi_ch_modulation[16];       // CC1
+static uint8_t midi_ch_portamento_time[16];  // CC5
+static uint8_t midi_ch_expression[16];       // CC11
+static uint8_t midi_ch_portamento[16];       // CC65
+static uint8_t midi_ch_tremolo[16];          // CC92
+
+// Pedal state per MIDI Channel (CC64 / CC66)
+static bool midi_ch_sustain[16] = {false};
+static bool midi_ch_sostenuto[16] = {false};
+
+// What a double-voice note gives up when voices run out
+static layer_policy_t midi_ch_layer_policy[16] = {LAYER_DROP};
+
 void midi_state_init(void) {
     for(int i = 0; i < 16; i++) {
         midi_ch_program[i] = 0;
+        midi_ch_layer_policy[i] = LAYER_DROP;
+        midi_reset_controllers(i);
     }
+    midi_reset_volume();
+    midi_reset_pedals();
 }
 
 void midi_set_program(uint8_t channel, uint8_t program) {
@@ -27,3 +49,118 @@ uint8_t midi_get_program(uint8_t channel) {
     }
     return 0; // Default to program 0 if invalid channel
 }
+
+void midi_set_volume(uint8_t channel, uint8_t volume) {
+    if (channel < 16) {
+        midi_ch_volume[channel] = volume > 127 ? 127 : volume;
+    }
+}
+
+uint8_t midi_get_volume(uint8_t channel) {
+    if (channel < 16) {
+        return midi_ch_volume[channel];
+    }
+    return 127;
+}
+
+void midi_reset_volume(void) {
+    for(int i = 0; i < 16; i++) {
+        midi_ch_volume[i] = 127;
+    }
+}
+
+void midi_set_pitch_bend(uint8_t channel, int16_t bend) {
+    if (channel < 16) {
+        midi_ch_bend[channel] = bend;
+    }
+}
+
+int16_t midi_get_pitch_bend(uint8_t channel) {
+    if (channel < 16) {
+        return midi_ch_bend[channel];
+    }
+    return 0;
+}
+
+void midi_set_controller(uint8_t channel, uint8_t controller, uint8_t value) {
+    if (channel >= 16) return;
+    if (value > 127) value = 127;
+
+    switch (controller) {
+        case 1:  midi_ch_modulation[channel] = value; break;
+        case 5:  midi_ch_portamento_time[channel] = value; break;
+        case 11: midi_ch_expression[channel] = value; break;
+        case 65: midi_ch_portamento[channel] = value; break;
+        case 92: midi_ch_tremolo[channel] = value; break;
+    }
+}
+
+uint8_t midi_get_controller(uint8_t channel, uint8_t controller) {
+    if (channel >= 16) return 0;
+
+    switch (controller) {
+        case 1:  return midi_ch_modulation[channel];
+        case 5:  return midi_ch_portamento_time[channel];
+        case 11: return midi_ch_expression[channel];
+        case 65: return midi_ch_portamento[channel];
+        case 92: return midi_ch_tremolo[channel];
+    }
+    return 0;
+}
+
+void midi_reset_controllers(uint8_t channel) {
+    if (channel < 16) {
+        midi_ch_bend[channel] = 0;
+        midi_ch_modulation[channel] = 0;
+        midi_ch_portamento_time[channel] = 0;
+        midi_ch_expression[channel] = 127;
+        midi_ch_portamento[channel] = 0;
+        midi_ch_tremolo[channel] = 0;
+    }
+}
+
+void midi_set_sustain(uint8_t channel, bool down) {
+    if (channel < 16) {
+        midi_ch_sustain[channel] = down;
+    }
+}
+
+bool midi_get_sustain(uint8_t channel) {
+    if (channel < 16) {
+        return midi_ch_sustain[channel];
+    }
+    return false;
+}
+
+void midi_set_sostenuto(uint8_t channel, bool down) {
+    if (channel < 16) {
+        midi_ch_sostenuto[channel] = down;
+    }
+}
+
+bool midi_get_sostenuto(uint8_t channel) {
+    if (channel < 16) {
+        return midi_ch_sostenuto[channel];
+    }
+    return false;
+}
+
+void midi_reset_pedals(void) {
+    for(int i = 0; i < 16; i++) {
+        midi_ch_sustain[i] = false;
+        midi_ch_sostenuto[i] = false;
+    }
+}
+
+void midi_set_layer_policy(uint8_t channel, layer_policy_t policy) {
+    if (channel < 16) {
+        midi_ch_layer_policy[channel] = policy;
+    }
+}
+
+layer_policy_t midi_get_layer_policy(uint8_t channel) {
+    if (channel < 16) {
+        return midi_ch_layer_policy[channel];
+    }
+    return LAYER_DROP;
+}
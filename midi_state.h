@@ -2,16 +2,24 @@
  * midi_state.h
  * 
  * MIDI Channel State Management
- * Tracks program (instrument) assignments for all 16 MIDI channels
+ * Tracks program (instrument) assignments, controllers and pedal state for all 16 MIDI channels
  */
 
 #ifndef MIDI_STATE_H
 #define MIDI_STATE_H
 
 #include <stdint.h>
+#include <stdbool.h>
+
+// How a channel's double-voice notes behave when polyphony is saturated
+typedef enum {
+    LAYER_DROP,  // Play (and give up) the second voice only while voices are spare
+    LAYER_KEEP   // Always play both voices, stealing notes if needed
+} layer_policy_t;
 
 /**
- * Initialize all MIDI channels to program 0 (default)
+ * Initialize all MIDI channels to program 0 (default), full volume, pedals up,
+ * controllers at their defaults
  */
 void midi_state_init(void);
 
@@ -31,4 +39,127 @@ void midi_set_program(uint8_t channel, uint8_t program);
  */
 uint8_t midi_get_program(uint8_t channel);
 
+/**
+ * Set the sustain (damper) pedal state for a MIDI channel (CC64)
+ * 
+ * @param channel MIDI channel (0-15)
+ * @param down true while the pedal is held
+ */
+void midi_set_sustain(uint8_t channel, bool down);
+
+/**
+ * Get the sustain pedal state for a MIDI channel
+ * 
+ * @param channel MIDI channel (0-15)
+ * @return true if the pedal is held
+ */
+bool midi_get_sustain(uint8_t channel);
+
+/**
+ * Set the sostenuto pedal state for a MIDI channel (CC66)
+ * 
+ * @param channel MIDI channel (0-15)
+ * @param down true while the pedal is held
+ */
+void midi_set_sostenuto(uint8_t channel, bool down);
+
+/**
+ * Get the sostenuto pedal state for a MIDI channel
+ * 
+ * @param channel MIDI channel (0-15)
+ * @return true if the pedal is held
+ */
+bool midi_get_sostenuto(uint8_t channel);
+
+/**
+ * Release the sustain and sostenuto pedals on all channels
+ * Used by Reset so a song ending with a pedal down doesn't hang notes
+ */
+void midi_reset_pedals(void);
+
+/**
+ * Set the channel volume for a MIDI channel (CC7)
+ * Scales note velocity; sounding notes fade to it on the control tick
+ * 
+ * @param channel MIDI channel (0-15)
+ * @param volume 0-127
+ */
+void midi_set_volume(uint8_t channel, uint8_t volume);
+
+/**
+ * Get the channel volume for a MIDI channel
+ * 
+ * @param channel MIDI channel (0-15)
+ * @return Volume (0-127, default 127)
+ */
+uint8_t midi_get_volume(uint8_t channel);
+
+/**
+ * Return all channels to full volume
+ * Used by Reset so one song's mix doesn't carry into the next
+ */
+void midi_reset_volume(void);
+
+/**
+ * Set the pitch bend for a MIDI channel (range +/-2 semitones)
+ * 
+ * @param channel MIDI channel (0-15)
+ * @param bend -8192 to 8191 (0 = centre)
+ */
+void midi_set_pitch_bend(uint8_t channel, int16_t bend);
+
+/**
+ * Get the pitch bend for a MIDI channel
+ * 
+ * @param channel MIDI channel (0-15)
+ * @return -8192 to 8191
+ */
+int16_t midi_get_pitch_bend(uint8_t channel);
+
+/**
+ * Set a continuous controller the control tick follows:
+ * CC1 Modulation (vibrato depth), CC5 Portamento Time, CC11 Expression,
+ * CC65 Portamento on/off, CC92 Tremolo Depth
+ * 
+ * @param channel MIDI channel (0-15)
+ * @param controller One of the controllers above (others are ignored)
+ * @param value 0-127
+ */
+void midi_set_controller(uint8_t channel, uint8_t controller, uint8_t value);
+
+/**
+ * Get one of the controllers kept by midi_set_controller()
+ * 
+ * @param channel MIDI channel (0-15)
+ * @param controller Controller number
+ * @return Value (0 for controllers that aren't kept)
+ */
+uint8_t midi_get_controller(uint8_t channel, uint8_t controller);
+
+/**
+ * Reset All Controllers (CC121): pitch bend and the controllers above
+ * return to their defaults (expression 127, the rest 0)
+ * Volume, program and pedals are left alone
+ * 
+ * @param channel MIDI channel (0-15)
+ */
+void midi_reset_controllers(uint8_t channel);
+
+/**
+ * Set how a channel's double-voice notes degrade under voice pressure
+ * (Core 1; Core 0 goes through audio_engine_set_layer_policy)
+ * 
+ * @param channel MIDI channel (0-15)
+ * @param policy LAYER_DROP (default) or LAYER_KEEP
+ */
+void midi_set_layer_policy(uint8_t channel, layer_policy_t policy);
+
+/**
+ * Get a channel's double-voice policy
+ * 
+ * @param channel MIDI channel (0-15)
+ * @return Layer policy
+ */
+layer_policy_t midi_get_layer_policy(uint8_t channel);
+
 #endif // MIDI_STATE_H
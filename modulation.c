@@ -0,0 +1,418 @@
+/**
+ * modulation.c
+ *
+ * Control-Rate Voice Modulation Implementation
+ */
+
+#include "modulation.h"
+#include "voice_manager.h"
+#include "midi_state.h"
+#include "opl2.h"
+#include "instruments.h"
+
+#define VIBRATO_STEP   360   // Phase per tick: ~5.5 Hz
+#define TREMOLO_STEP   262   // ~4 Hz
+#define VIBRATO_MAX    16    // Full modulation wheel: +/- half a semitone (1/32 semitone)
+#define TREMOLO_MAX    8     // Full tremolo depth: 6 dB (0.75 dB steps)
+#define FADE_STEP      1     // Gain per tick: a full-scale fade takes ~127 ms
+#define NO_NOTE        0xFF
+
+// Envelope estimate, in 1/16 dB of attenuation (Q8) per tick: a decay at
+// rate 1 takes ~39 s over 96 dB and each rate step halves it; attacks are
+// ~14x faster. The OPL's exponential attack is taken as linear in dB
+#define ENV_SILENT_Q8      ((uint32_t)(96 * 16) << 8)
+#define ENV_ATTACK_BASE_Q8 139
+#define ENV_DECAY_BASE_Q8  10
+
+// Last key per MIDI channel, and the one before it (where a glide starts);
+// kept by key so both voices of a double-voice note glide alike
+static uint8_t last_key[16];
+static uint8_t glide_from[16];
+
+// Voice and tracker channel the next tick's writes start at
+static uint8_t next_voice = 0;
+static uint8_t next_channel = 0;
+
+// Tracker channels: pitch as written (B0 << 8 | A0) and as sent with the
+// effect on top; phase is the vibrato's, or ms into the arpeggio
+#define CHANNEL_VIBRATO_STEP  51   // Phase per tick per unit of speed (~0.8 Hz)
+#define CHANNEL_VIBRATO_DEPTH 2    // F-number steps per unit of depth
+
+typedef struct {
+    uint16_t freq;
+    uint16_t sent;
+    uint8_t effect;
+    uint8_t param;
+    uint16_t phase;
+} ChannelFx;
+
+static ChannelFx channel_fx[9];
+
+// 2^(n/12) in Q12, for arpeggio steps of 0-9 semitones
+static const uint16_t semitone_q12[10] = {
+    4096, 4340, 4598, 4871, 5161, 5468, 5793, 6137, 6502, 6889
+};
+
+// Master fade: level in 1/256 steps, signed step per tick (0 = still)
+#define MASTER_FULL    (127 << 8)
+static int32_t master_q8 = MASTER_FULL;
+static int32_t master_step_q8 = 0;
+static uint8_t fade_kind = FADE_IN;
+static bool held = false;   // Paused: every channel keyed off, voice state kept
+
+// Pitch bend in 1/32 semitones (+/-8192 = +/-2 semitones)
+static int16_t bend_target(uint8_t channel) {
+    return midi_get_pitch_bend(channel) / 128;
+}
+
+static uint8_t channel_gain(uint8_t channel) {
+    return (uint8_t)((midi_get_volume(channel) * midi_get_controller(channel, 11) + 63) / 127);
+}
+
+// Triangle wave, -0x4000 to 0x4000 over one turn of the phase
+static int32_t triangle(uint16_t phase) {
+    return phase < 0x8000 ? (int32_t)phase - 0x4000 : 0xC000 - (int32_t)phase;
+}
+
+// Pitch of a voice relative to its note, in 1/32 semitones
+static int16_t pitch_offset(uint8_t v, uint8_t channel) {
+    int32_t offset = voice_mod.fine[v] + voice_mod.bend[v] + (voice_mod.glide_q8[v] >> 8);
+
+    uint8_t depth = (uint8_t)(midi_get_controller(channel, 1) * VIBRATO_MAX / 127);
+    if (depth) offset += triangle(voice_mod.vibrato_phase[v]) * depth / 0x4000;
+    return (int16_t)offset;
+}
+
+void modulation_init(void) {
+    for (int ch = 0; ch < 16; ch++) {
+        last_key[ch] = NO_NOTE;
+        glide_from[ch] = NO_NOTE;
+    }
+    next_voice = 0;
+    next_channel = 0;
+    for (int ch = 0; ch < 9; ch++) channel_fx[ch] = (ChannelFx){0};
+
+    master_q8 = MASTER_FULL;
+    master_step_q8 = 0;
+    fade_kind = FADE_IN;
+    held = false;
+    voice_mod.master = 127;
+}
+
+void modulation_note_on(uint8_t voice, uint8_t channel, uint8_t note, int16_t fine, uint8_t velocity) {
+    if (voice >= OPL2_VOICES) return;
+
+    voice_mod.note[voice] = note;
+    voice_mod.fine[voice] = fine;
+    voice_mod.glide_q8[voice] = 0;
+    voice_mod.glide_step_q8[voice] = 0;
+    voice_mod.bend[voice] = 0;
+    voice_mod.vibrato_phase[voice] = 0;
+    voice_mod.tremolo_phase[voice] = 0;
+    voice_mod.tremolo[voice] = 0;
+    voice_mod.gain[voice] = channel_gain(channel);
+
+    // The attack starts from wherever the envelope is (silent if idle)
+    if (voice_mod.env_phase[voice] == ENV_IDLE) voice_mod.env_att_q8[voice] = ENV_SILENT_Q8;
+    voice_mod.env_phase[voice] = ENV_ATTACK;
+
+    if (channel != 9 && channel < 16) {
+        voice_mod.bend[voice] = bend_target(channel);
+
+        uint8_t key = voices[voice].midi_note;
+        if (key != last_key[channel]) {
+            glide_from[channel] = last_key[channel];
+            last_key[channel] = key;
+        }
+
+        // Portamento: start at the previous key and glide over CC5's time
+        // (roughly quadratic: 0 = instant, 127 = about 2 s)
+        uint8_t time = midi_get_controller(channel, 5);
+        uint32_t ticks = (uint32_t)time * time / 8 * 1000 / MOD_TICK_US;
+        if (midi_get_controller(channel, 65) >= 64 && glide_from[channel] != NO_NOTE && ticks > 0) {
+            int32_t distance = ((int32_t)glide_from[channel] - key) * 32 * 256;
+            int32_t step = (distance < 0 ? -distance : distance) / (int32_t)ticks;
+            voice_mod.glide_q8[voice] = distance;
+            voice_mod.glide_step_q8[voice] = step > 0 ? step : 1;
+        }
+    }
+
+    apply_velocity(voice, velocity);
+
+    int16_t offset = pitch_offset(voice, channel);
+    opl2_note_on_fine(voice, note, offset);
+    voice_mod.freq[voice] = midi_to_opl2_freq_fine(note, offset);
+}
+
+// Move a keyed voice's modulation on by one tick
+static void advance_voice(uint8_t v, uint8_t channel) {
+    // Level: fade towards the channel's volume x expression, tremolo
+    uint8_t gain = channel_gain(channel);
+    if (voice_mod.gain[v] < gain) {
+        voice_mod.gain[v] = (gain - voice_mod.gain[v] > FADE_STEP) ? voice_mod.gain[v] + FADE_STEP : gain;
+    } else if (voice_mod.gain[v] > gain) {
+        voice_mod.gain[v] = (voice_mod.gain[v] - gain > FADE_STEP) ? voice_mod.gain[v] - FADE_STEP : gain;
+    }
+
+    uint8_t depth = (uint8_t)(midi_get_controller(channel, 92) * TREMOLO_MAX / 127);
+    if (depth) {
+        voice_mod.tremolo_phase[v] += TREMOLO_STEP;
+        voice_mod.tremolo[v] = (uint8_t)((triangle(voice_mod.tremolo_phase[v]) + 0x4000) * depth / 0x8000);
+    } else {
+        voice_mod.tremolo[v] = 0;
+    }
+
+    if (channel == 9) return;
+
+    // Pitch: glide home, ease the bend towards the channel's, vibrato
+    int32_t glide = voice_mod.glide_q8[v];
+    if (glide != 0) {
+        int32_t step = voice_mod.glide_step_q8[v];
+        if (glide > 0) glide = glide > step ? glide - step : 0;
+        else glide = -glide > step ? glide + step : 0;
+        voice_mod.glide_q8[v] = glide;
+    }
+
+    int16_t diff = bend_target(channel) - voice_mod.bend[v];
+    if (diff != 0) {
+        int16_t step = diff / 4;
+        if (step == 0) step = diff > 0 ? 1 : -1;
+        voice_mod.bend[v] += step;
+    }
+
+    voice_mod.vibrato_phase[v] += VIBRATO_STEP;
+}
+
+void modulation_fade(uint8_t fade, uint16_t ms) {
+    int32_t ticks = (int32_t)((uint32_t)ms * 1000 / MOD_TICK_US);
+    if (ticks < 1) ticks = 1;
+    int32_t step = MASTER_FULL / ticks;
+    if (step < 1) step = 1;
+
+    fade_kind = fade;
+    if (fade != FADE_IN) {
+        master_step_q8 = -step;
+        return;
+    }
+
+    // Resume: the held notes key back on at their current pitch, still silent
+    if (held) {
+        for (uint8_t v = 0; v < OPL2_VOICES; v++) {
+            if (voices[v].active) opl2_write_channel(v, 0xB0, voice_mod.freq[v] >> 8);
+        }
+        held = false;
+    }
+    master_step_q8 = step;
+}
+
+bool modulation_stopping(void) {
+    return fade_kind == FADE_STOP && master_step_q8 != 0;
+}
+
+// Move the master level on by one tick; true when a fade out has just ended
+static bool advance_master(void) {
+    if (master_step_q8 == 0) return false;
+
+    master_q8 += master_step_q8;
+    bool faded_out = false;
+    if (master_q8 >= MASTER_FULL) {
+        master_q8 = MASTER_FULL;
+        master_step_q8 = 0;
+    } else if (master_q8 <= 0) {
+        master_q8 = 0;
+        master_step_q8 = 0;
+        faded_out = true;
+    }
+    voice_mod.master = (uint8_t)(master_q8 >> 8);
+    return faded_out;
+}
+
+static uint32_t rate_step_q8(uint8_t rate, uint32_t base) {
+    return rate ? base << (rate - 1) : 0;
+}
+
+// Move a voice's envelope estimate on by one tick
+static void advance_envelope(uint8_t v) {
+    uint8_t phase = voice_mod.env_phase[v];
+    if (phase == ENV_IDLE) return;
+
+    const OPL_Patch *p = get_channel_patch(v);
+    uint32_t att = voice_mod.env_att_q8[v];
+
+    // Key released (pedal-held notes are still active)
+    if (!voices[v].active && phase != ENV_RELEASE) phase = ENV_RELEASE;
+
+    switch (phase) {
+        case ENV_ATTACK: {
+            uint32_t step = rate_step_q8(p->c_atdec >> 4, ENV_ATTACK_BASE_Q8);
+            att = att > step ? att - step : 0;
+            if (att == 0) phase = ENV_DECAY;
+            break;
+        }
+        case ENV_DECAY: {
+            uint32_t sustain = (uint32_t)(p->c_susrel >> 4) * 3 * 16 << 8;  // 3 dB steps
+            att += rate_step_q8(p->c_atdec & 0x0F, ENV_DECAY_BASE_Q8);
+            if (att >= sustain) {
+                att = sustain;
+                // Sustaining patches hold; percussive ones go on at the release rate
+                phase = (p->c_ave & 0x20) ? ENV_SUSTAIN : ENV_RELEASE;
+            }
+            break;
+        }
+        case ENV_RELEASE:
+            att += rate_step_q8(p->c_susrel & 0x0F, ENV_DECAY_BASE_Q8);
+            if (att >= ENV_SILENT_Q8) {
+                att = ENV_SILENT_Q8;
+                phase = ENV_IDLE;
+            }
+            break;
+    }
+
+    voice_mod.env_phase[v] = phase;
+    voice_mod.env_att_q8[v] = att;
+}
+
+// --- TRACKER CHANNELS ---
+
+// A tracker channel's pitch with its effect applied (key bit kept)
+static uint16_t channel_pitch(const ChannelFx *c) {
+    if (c->effect == CHANNEL_FX_NONE) return c->freq;
+
+    int32_t fnum = c->freq & 0x3FF;
+    uint8_t block = (c->freq >> 10) & 0x07;
+
+    if (c->effect == CHANNEL_FX_ARPEGGIO) {
+        uint8_t step = (uint8_t)(c->phase / ARPEGGIO_MS);
+        uint8_t semitones = step == 1 ? c->param / 10 : step == 2 ? c->param % 10 : 0;
+        fnum = fnum * semitone_q12[semitones] >> 12;
+    } else {
+        fnum += triangle(c->phase) * (c->param % 10) * CHANNEL_VIBRATO_DEPTH / 0x4000;
+    }
+
+    // Past the top of the F-number range: up an octave
+    while (fnum > 0x3FF && block < 7) {
+        fnum >>= 1;
+        block++;
+    }
+    if (fnum > 0x3FF) fnum = 0x3FF;
+    if (fnum < 0) fnum = 0;
+    return (uint16_t)((c->freq & 0xE000) | (block << 10) | fnum);
+}
+
+void modulation_channel_effect(uint8_t channel, uint8_t effect, uint8_t param) {
+    if (channel >= 9) return;
+    ChannelFx *c = &channel_fx[channel];
+    if (effect != c->effect) c->phase = 0;
+    c->effect = effect;
+    c->param = param;
+}
+
+uint8_t modulation_channel_write(uint8_t reg, uint8_t data) {
+    bool low = reg >= 0xA0 && reg <= 0xA8;
+    if (!low && !(reg >= 0xB0 && reg <= 0xB8)) return data;
+
+    ChannelFx *c = &channel_fx[reg & 0x0F];
+    c->freq = low ? (c->freq & 0xFF00) | data : (uint16_t)(data << 8) | (c->freq & 0xFF);
+
+    uint16_t pitch = channel_pitch(c);
+    if (low) {
+        c->sent = (c->sent & 0xFF00) | (pitch & 0xFF);
+        return pitch & 0xFF;
+    }
+    c->sent = (pitch & 0xFF00) | (c->sent & 0xFF);
+    return pitch >> 8;
+}
+
+// Move the tracker channel effects on, then write what changed,
+// round-robin within MOD_CHANNEL_BUDGET; returns the writes made
+static uint8_t tick_channels(void) {
+    for (uint8_t ch = 0; ch < 9; ch++) {
+        ChannelFx *c = &channel_fx[ch];
+        if (c->effect == CHANNEL_FX_ARPEGGIO) {
+            if (++c->phase >= 3 * ARPEGGIO_MS) c->phase = 0;
+        } else if (c->effect == CHANNEL_FX_VIBRATO) {
+            c->phase += (uint16_t)((c->param / 10) * CHANNEL_VIBRATO_STEP);
+        }
+    }
+
+    uint8_t budget = MOD_CHANNEL_BUDGET;
+    for (uint8_t n = 0; n < 9; n++) {
+        uint8_t ch = (uint8_t)((next_channel + n) % 9);
+        ChannelFx *c = &channel_fx[ch];
+        uint16_t pitch = channel_pitch(c);
+        uint8_t writes = ((pitch & 0xFF) != (c->sent & 0xFF)) + ((pitch >> 8) != (c->sent >> 8));
+        if (writes > budget) {
+            next_channel = ch;  // First in line next tick
+            break;
+        }
+        budget -= writes;
+
+        if ((pitch & 0xFF) != (c->sent & 0xFF)) opl2_write(0xA0 + ch, pitch & 0xFF);
+        if ((pitch >> 8) != (c->sent >> 8)) opl2_write(0xB0 + ch, pitch >> 8);
+        c->sent = pitch;
+    }
+    return MOD_CHANNEL_BUDGET - budget;
+}
+
+// Carrier TL (0.75 dB steps) plus the envelope
+uint8_t modulation_vu_level(uint8_t v) {
+    if (v >= OPL2_VOICES || voice_mod.env_phase[v] == ENV_IDLE) return 0;
+
+    uint32_t att = (uint32_t)(voice_mod.level[v] & 0x3F) * 12 + (voice_mod.env_att_q8[v] >> 8);
+    uint32_t step = VU_RANGE_DB * 16 / VU_STEPS;
+    return att >= VU_RANGE_DB * 16 ? 0 : (uint8_t)(VU_STEPS - att / step);
+}
+
+bool modulation_tick(void) {
+    if (advance_master()) {
+        if (fade_kind == FADE_STOP) return true;
+
+        // Pause: silence every channel (tracker and stream notes included),
+        // keeping the voices as they are for the resume
+        opl2_silence_all();
+        held = true;
+    }
+
+    for (uint8_t v = 0; v < OPL2_VOICES; v++) {
+        if (voices[v].active) advance_voice(v, voices[v].midi_channel);
+        advance_envelope(v);
+    }
+
+    // Write what changed, round-robin within the budget. Tracker channels
+    // take at most their share and the voices the rest, so neither starves
+    // the other (a paused tracker channel keeps its key off)
+    uint8_t budget = MOD_WRITE_BUDGET;
+    if (!held) budget -= tick_channels();
+
+    for (uint8_t n = 0; n < OPL2_VOICES; n++) {
+        uint8_t v = (uint8_t)((next_voice + n) % OPL2_VOICES);
+        if (!voices[v].active) continue;
+
+        uint8_t channel = voices[v].midi_channel;
+        uint16_t freq = voice_mod.freq[v];
+        if (channel != 9) freq = midi_to_opl2_freq_fine(voice_mod.note[v], pitch_offset(v, channel));
+        uint8_t level = voice_level(v);
+
+        uint8_t writes = ((freq & 0xFF) != (voice_mod.freq[v] & 0xFF)) +
+                         ((freq >> 8) != (voice_mod.freq[v] >> 8)) +
+                         (level != voice_mod.level[v]);
+        if (writes > budget) {
+            next_voice = v;  // First in line next tick
+            return false;
+        }
+        budget -= writes;
+
+        if ((freq & 0xFF) != (voice_mod.freq[v] & 0xFF)) opl2_write_channel(v, 0xA0, freq & 0xFF);
+        if ((freq >> 8) != (voice_mod.freq[v] >> 8)) {
+            if (!held) opl2_write_channel(v, 0xB0, freq >> 8);
+            shadow_b0[v] = (freq >> 8) & ~0x20;
+        }
+        voice_mod.freq[v] = freq;
+
+        if (level != voice_mod.level[v]) {
+            opl2_write_operator(v, 0x43, level);
+            voice_mod.level[v] = level;
+        }
+    }
+    return false;
+}
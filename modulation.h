@@ -0,0 +1,145 @@
+/**
+ * modulation.h
+ *
+ * Control-Rate Voice Modulation (Core 1)
+ * Time-varying pitch and level for sounding notes
+ *
+ * Core 1 runs modulation_tick() every MOD_TICK_US between events. Each
+ * tick moves every keyed voice along:
+ *
+ *   Pitch  portamento glide (CC65 on, CC5 time), pitch bend smoothed
+ *          towards the channel's bend, vibrato (CC1 depth)
+ *   Level  channel volume x expression (CC7, CC11) faded towards the
+ *          channel's setting, tremolo (CC92 depth)
+ *
+ * and writes A0/B0 and carrier TL only where the value it computes
+ * differs from the one last written. A tick writes at most
+ * MOD_WRITE_BUDGET registers, starting where the last one stopped, so its
+ * cost stays bounded however many voices are moving; a voice that misses
+ * out catches up on the next tick. Percussion (MIDI channel 10) takes the
+ * level modulation only.
+ *
+ * A master level over all voices ramps on the same tick for pause, resume
+ * and stop. A pause fades out and then keys every channel off, keeping the
+ * voice state (notes, pitches, levels) so a resume keys the same notes
+ * back on and fades them in. A stop fades out and then resets the engine;
+ * events wait in the queue until it has.
+ *
+ * For the VU meters the tick also follows each voice's carrier envelope
+ * roughly (attack, decay to the sustain level, release, at the patch's
+ * rates, linear in dB) and adds it to the carrier TL. The engine publishes
+ * the levels to Core 0 with its snapshot every VU_PUBLISH_TICKS (see
+ * audio_engine.h). Notes written as raw registers (tracker, register
+ * streams) do not pass through the voices and show no level.
+ *
+ * Tracker channels (Register Write events on chip 0) can take a pitch
+ * effect of their own, set per channel by the Tracker Effect event:
+ * arpeggio or vibrato on top of the A0/B0 the tracker last wrote. The
+ * tick moves it on at the control rate, so a 50 Hz module still gets a
+ * smooth vibrato. Its writes take up to MOD_CHANNEL_BUDGET of the tick's
+ * budget, round-robin over the channels like the voices, and the voices
+ * get the rest.
+ */
+
+#ifndef MODULATION_H
+#define MODULATION_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "opl2.h"
+
+#define MOD_TICK_US       1000   // Control rate (1 kHz)
+#define MOD_WRITE_BUDGET  (6 * OPL2_CHIPS)  // Register writes per tick (~30 us each, chips overlap)
+#define MOD_CHANNEL_BUDGET 3     // Of those, at most this many for tracker channel effects
+
+// Master fades (Fade event, type 11)
+#define FADE_IN           0      // Resume: key held notes back on, fade up
+#define FADE_PAUSE        1      // Fade out, then hold the notes silent
+#define FADE_STOP         2      // Fade out, then reset the engine
+
+// Tracker channel pitch effects (Tracker Effect event, type 14); the
+// parameter is RAD's two decimal digits x and y (param = 10x + y)
+#define CHANNEL_FX_NONE      0
+#define CHANNEL_FX_ARPEGGIO  1   // Note, +x, +y semitones in turn, ARPEGGIO_MS each
+#define CHANNEL_FX_VIBRATO   2   // x = speed (~0.8 Hz steps), y = depth (2 F-number steps)
+#define ARPEGGIO_MS          20  // One 50 Hz tracker tick
+
+// VU meters
+#define VU_PUBLISH_TICKS  16     // Levels are published at ~60 Hz
+#define VU_STEPS          8      // Bar height of a voice at full level
+#define VU_RANGE_DB       48     // Attenuation that reads as an empty bar
+
+// Estimated envelope phase per voice (voice_mod.env_phase)
+#define ENV_IDLE          0
+#define ENV_ATTACK        1
+#define ENV_DECAY         2
+#define ENV_SUSTAIN       3
+#define ENV_RELEASE       4
+
+/**
+ * Forget every channel's last note (no glide into the next one)
+ * and return the master level to full
+ */
+void modulation_init(void);
+
+/**
+ * Key a voice on, starting its modulation
+ * Takes the place of apply_velocity() + opl2_note_on_fine() for a new note
+ *
+ * @param voice Physical OPL voice
+ * @param channel MIDI channel the note belongs to
+ * @param note Note to play
+ * @param fine Detune in 1/32 semitone
+ * @param velocity MIDI velocity (0-127)
+ */
+void modulation_note_on(uint8_t voice, uint8_t channel, uint8_t note, int16_t fine, uint8_t velocity);
+
+/**
+ * Start a master fade
+ *
+ * @param fade FADE_IN, FADE_PAUSE or FADE_STOP
+ * @param ms Time for a full-scale ramp (0 = next tick)
+ */
+void modulation_fade(uint8_t fade, uint16_t ms);
+
+/**
+ * Check whether a stop fade is still running (hold events back until it ends)
+ */
+bool modulation_stopping(void);
+
+/**
+ * VU bar height of a voice now: carrier TL plus the envelope estimate
+ *
+ * @param voice Physical OPL voice
+ * @return 0 (silent) to VU_STEPS
+ */
+uint8_t modulation_vu_level(uint8_t voice);
+
+/**
+ * Set the pitch effect of a tracker channel (chip 0, raw registers)
+ *
+ * @param channel OPL channel (0-8)
+ * @param effect CHANNEL_FX_*
+ * @param param Effect parameter (0-99)
+ */
+void modulation_channel_effect(uint8_t channel, uint8_t effect, uint8_t param);
+
+/**
+ * Pass a raw register write through the tracker channel effects
+ * A0/B0 writes are kept as the channel's pitch and come back with its
+ * effect applied; anything else comes back as it was
+ *
+ * @param reg Register (chip 0)
+ * @param data Value the tracker wants
+ * @return Value to write
+ */
+uint8_t modulation_channel_write(uint8_t reg, uint8_t data);
+
+/**
+ * Advance all keyed voices by one control tick and write what changed
+ *
+ * @return true when a stop fade has just finished: reset the engine now
+ */
+bool modulation_tick(void);
+
+#endif // MODULATION_H
@@ -0,0 +1,188 @@
+/**
+ * mus_player.c
+ *
+ * Doom MUS Song Decoder Implementation
+ */
+
+#include "mus_player.h"
+#include "hardware/regs/addressmap.h"
+#include <stdio.h>
+#include <string.h>
+
+#define MUS_HEADER_SIZE  16
+
+// Where each lump's score starts, and how long it is
+typedef struct {
+    uint8_t slot;
+    uint16_t score_start;
+    uint16_t score_length;
+} MusLump;
+
+static MusLump lumps[MUS_FLASH_SLOTS];
+static uint8_t lump_count = 0;
+
+// MUS controllers 1-9 as MIDI controllers (0 is Program Change)
+static const uint8_t mus_controllers[10] = {
+    0,    // 0: Program Change
+    0,    // 1: Bank Select
+    1,    // 2: Modulation
+    7,    // 3: Volume
+    10,   // 4: Pan
+    11,   // 5: Expression
+    91,   // 6: Reverb depth
+    93,   // 7: Chorus depth
+    64,   // 8: Sustain pedal
+    67    // 9: Soft pedal
+};
+
+// MUS system events 10-14 as MIDI channel mode controllers
+static const uint8_t mus_system[5] = {
+    120,  // 10: All Sounds Off
+    123,  // 11: All Notes Off
+    126,  // 12: Mono
+    127,  // 13: Poly
+    121   // 14: Reset All Controllers
+};
+
+static const uint8_t* slot_address(uint8_t slot) {
+    return (const uint8_t*)(uintptr_t)(XIP_BASE + MUS_FLASH_OFFSET + (uint32_t)slot * MUS_SLOT_SIZE);
+}
+
+static uint16_t read_u16_le(const uint8_t *p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+
+void mus_init(void) {
+    lump_count = 0;
+    for (uint8_t slot = 0; slot < MUS_FLASH_SLOTS; slot++) {
+        const uint8_t *data = slot_address(slot);
+        if (memcmp(data, "MUS\x1A", 4) != 0) continue;
+
+        uint16_t length = read_u16_le(data + 4);
+        uint16_t start = read_u16_le(data + 6);
+        if (start < MUS_HEADER_SIZE || (uint32_t)start + length > MUS_SLOT_SIZE) {
+            printf("MUS: slot %u has a bad header\n", slot);
+            continue;
+        }
+
+        lumps[lump_count].slot = slot;
+        lumps[lump_count].score_start = start;
+        lumps[lump_count].score_length = length;
+        lump_count++;
+        printf("MUS: slot %u, %u byte score\n", slot, length);
+    }
+}
+
+uint8_t mus_get_count(void) {
+    return lump_count;
+}
+
+void mus_get_name(uint8_t index, char *out, uint8_t size) {
+    snprintf(out, size, "MUS %u", index < lump_count ? lumps[index].slot + 1 : 0);
+}
+
+bool mus_open(MusReader *mus, uint8_t index) {
+    if (index >= lump_count) return false;
+
+    mus->score = slot_address(lumps[index].slot) + lumps[index].score_start;
+    mus->length = lumps[index].score_length;
+    mus->pos = 0;
+    for (int ch = 0; ch < 16; ch++) mus->volume[ch] = 127;
+    return true;
+}
+
+static bool read_byte(MusReader *mus, uint8_t *byte) {
+    if (mus->pos >= mus->length) return false;
+    *byte = mus->score[mus->pos++];
+    return true;
+}
+
+// MUS channel 15 is percussion; 9-14 shift up past MIDI channel 10
+static uint8_t midi_channel(uint8_t mus_channel) {
+    if (mus_channel == 15) return 9;
+    if (mus_channel >= 9) return mus_channel + 1;
+    return mus_channel;
+}
+
+mus_result_t mus_read(MusReader *mus, SongEvent *event, uint32_t *delay) {
+    uint8_t descriptor, a, b;
+    *delay = 0;
+
+    if (!read_byte(mus, &descriptor)) return MUS_END;
+
+    uint8_t mus_channel = descriptor & 0x0F;
+    mus_result_t result = MUS_EVENT;
+
+    event->delay_ms = 0;
+    event->voice = 0;
+    event->source = MIDI_SOURCE_INTERNAL;
+    event->channel = midi_channel(mus_channel);
+    event->velocity = 0;
+
+    switch ((descriptor >> 4) & 0x07) {
+        case 0: // Release Note
+            if (!read_byte(mus, &a)) return MUS_END;
+            event->type = 0;
+            event->note = a & 0x7F;
+            break;
+
+        case 1: // Play Note (bit 7 of the note: a new volume follows)
+            if (!read_byte(mus, &a)) return MUS_END;
+            if (a & 0x80) {
+                if (!read_byte(mus, &b)) return MUS_END;
+                mus->volume[mus_channel] = b & 0x7F;
+            }
+            event->type = 1;
+            event->note = a & 0x7F;
+            event->velocity = mus->volume[mus_channel];
+            break;
+
+        case 2: // Pitch Bend (0-255, 128 = centre, one whole tone either way)
+            if (!read_byte(mus, &a)) return MUS_END;
+            event->type = 10;
+            event->note = (a & 0x01) << 6;   // As a 14-bit MIDI bend
+            event->velocity = a >> 1;
+            break;
+
+        case 3: // System Event
+            if (!read_byte(mus, &a)) return MUS_END;
+            if (a >= 10 && a <= 14) {
+                event->type = 4;
+                event->note = mus_system[a - 10];
+            } else {
+                result = MUS_SKIP;
+            }
+            break;
+
+        case 4: // Controller
+            if (!read_byte(mus, &a) || !read_byte(mus, &b)) return MUS_END;
+            if (b > 127) b = 127;
+            if (a == 0) {
+                event->type = 3;
+                event->note = b;
+            } else if (a <= 9) {
+                event->type = 4;
+                event->note = mus_controllers[a];
+                event->velocity = b;
+            } else {
+                result = MUS_SKIP;
+            }
+            break;
+
+        case 5: // End of Measure
+            result = MUS_SKIP;
+            break;
+
+        default: // 6: Score End (7 is undefined - stop rather than misread)
+            return MUS_END;
+    }
+
+    // Delay: 7 bits per byte, most significant first
+    if (descriptor & 0x80) {
+        uint32_t ticks = 0;
+        do {
+            if (!read_byte(mus, &a)) return MUS_END;
+            ticks = (ticks << 7) | (a & 0x7F);
+        } while (a & 0x80);
+        *delay = ticks;
+    }
+    return result;
+}
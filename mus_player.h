@@ -0,0 +1,88 @@
+/**
+ * mus_player.h
+ *
+ * Doom MUS Song Decoder
+ * Plays MUS lumps straight from flash, one event at a time
+ *
+ * FLASH LAYOUT
+ * ------------
+ * MUS_FLASH_SLOTS slots of MUS_SLOT_SIZE bytes follow the bank slots
+ * (see bank.h). Each slot holds one unmodified MUS lump, e.g.
+ *   picotool load -t bin D_E1M1.mus -o 0x10140000    (slot 0)
+ *   picotool load -t bin D_E1M2.mus -o 0x10150000    (slot 1)
+ *
+ * MUS FORMAT
+ * ----------
+ * "MUS\x1A", score length, score start, channel counts and an instrument
+ * list, then the score: an event byte (bit 7 = a delay follows, bits 4-6
+ * type, bits 0-3 channel), its data, and a variable-length delay in
+ * MUS_TICK_HZ ticks. MUS channel 15 is percussion (MIDI channel 10) and
+ * 9-14 move up one to make room; controllers are numbered MUS-style and
+ * mapped to their MIDI equivalents here, and pitch bends become MIDI
+ * bends (the engine's +/-2 semitone range is MUS's whole tone).
+ */
+
+#ifndef MUS_PLAYER_H
+#define MUS_PLAYER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "bank.h"
+#include "queue.h"
+
+#define MUS_FLASH_OFFSET (BANK_FLASH_OFFSET + BANK_FLASH_SLOTS * BANK_SLOT_SIZE)
+#define MUS_SLOT_SIZE    (64 * 1024)
+#define MUS_FLASH_SLOTS  8
+
+#define MUS_TICK_HZ      140  // Doom's music timer rate
+
+typedef enum {
+    MUS_EVENT,   // event filled in
+    MUS_SKIP,    // Nothing for the engine (measure end, unsupported event)
+    MUS_END      // Score finished (or ran off the end of the lump)
+} mus_result_t;
+
+// Read position in a lump
+typedef struct {
+    const uint8_t *score;
+    uint32_t length;
+    uint32_t pos;
+    uint8_t volume[16];   // Last note volume per MUS channel (MUS repeats it)
+} MusReader;
+
+/**
+ * Scan the flash slots for MUS lumps
+ * Call once at boot
+ */
+void mus_init(void);
+
+/**
+ * Number of MUS lumps found in flash
+ */
+uint8_t mus_get_count(void);
+
+/**
+ * Short name of a lump for display ("MUS 1" ...)
+ */
+void mus_get_name(uint8_t index, char *out, uint8_t size);
+
+/**
+ * Start reading a lump from the top of its score
+ *
+ * @param mus Reader to set up
+ * @param index Lump number (0 to mus_get_count() - 1)
+ * @return false if there is no such lump
+ */
+bool mus_open(MusReader *mus, uint8_t index);
+
+/**
+ * Decode the next MUS event
+ *
+ * @param mus Reader
+ * @param event Filled in for MUS_EVENT (channel already mapped to MIDI)
+ * @param delay Ticks to wait after this event (0 = next event is simultaneous)
+ * @return What was read
+ */
+mus_result_t mus_read(MusReader *mus, SongEvent *event, uint32_t *delay);
+
+#endif // MUS_PLAYER_H
@@ -2,6 +2,7 @@
 #include "pico/stdlib.h"
 #include "opl2.h"
 #include "opl2_hardware.h"
+#include "perf.h"
 
 // ==========================================================
 // OPL2 FREQUENCY MATH
@@ -13,47 +14,143 @@ const uint16_t fnum_table[12] = {
     344, 363, 385, 408, 432, 458, 485, 514, 544, 577, 611, 647
 };
 
-// Shadow registers for all 9 channels
+// Shadow registers for every voice on every chip
 // We need this to remember the Block/F-Number when we send a NoteOff
-uint8_t shadow_b0[9] = {0};
+uint8_t shadow_b0[OPL2_VOICES] = {0};
+
+static const OPL2Trace *trace = NULL;
+static uint32_t write_count = 0;
+
+// Operator register offset of each channel (+3 for its carrier)
+static const uint8_t op_offsets[OPL2_CHANNELS] = {0, 1, 2, 8, 9, 10, 16, 17, 18};
+
+// Chip select of each chip
+static const uint8_t cs_pins[OPL2_CHIPS] = {
+    OPL2_CS,
+#if OPL2_CHIPS > 1
+    OPL2_CS2
+#endif
+};
+
+// Writes waiting per chip (reg << 8 | data), oldest at pending_head
+static uint16_t pending[OPL2_CHIPS][OPL2_PENDING];
+static uint8_t pending_head[OPL2_CHIPS];
+static uint8_t pending_count[OPL2_CHIPS];
+
+// When each chip has taken its last data write (time_us_32)
+static uint32_t chip_ready_us[OPL2_CHIPS];
+
+void opl2_set_trace(const OPL2Trace *t) {
+    trace = t;
+}
+
+uint32_t opl2_get_write_count(void) {
+    return write_count;
+}
+
+// Strobe one write into a chip. Its data settle time is left to run on:
+// only the next write to the same chip waits for it
+static void bus_write(uint8_t chip, uint16_t entry) {
+    PERF_BEGIN(OPL2_WRITE);
+    int32_t settle = (int32_t)(chip_ready_us[chip] - time_us_32());
+    if (settle > 0) sleep_us((uint64_t)settle);
+    uint cs = cs_pins[chip];
 
-void opl2_write(uint8_t reg, uint8_t data) {
     // 1. SELECT REGISTER
     gpio_put(OPL2_A0, 0);
-    gpio_put_masked(OPL2_DATA_MASK, reg);
-    gpio_put(OPL2_CS, 0); 
+    gpio_put_masked(OPL2_DATA_MASK, entry >> 8);
+    gpio_put(cs, 0); 
     gpio_put(OPL2_WR, 0);
     
     sleep_us(1); // Increased from NOPs to 1 microsecond for reliability
     
     gpio_put(OPL2_WR, 1); 
-    gpio_put(OPL2_CS, 1);
+    gpio_put(cs, 1);
     sleep_us(OPL2_WAIT_ADDRESS);
 
     // 2. WRITE DATA
     gpio_put(OPL2_A0, 1);
-    gpio_put_masked(OPL2_DATA_MASK, data);
-    gpio_put(OPL2_CS, 0); 
+    gpio_put_masked(OPL2_DATA_MASK, entry & 0xFF);
+    gpio_put(cs, 0); 
     gpio_put(OPL2_WR, 0);
     
     sleep_us(1); // Increased for reliability
     
     gpio_put(OPL2_WR, 1); 
-    gpio_put(OPL2_CS, 1);
-    sleep_us(OPL2_WAIT_DATA);
+    gpio_put(cs, 1);
+    chip_ready_us[chip] = time_us_32() + OPL2_WAIT_DATA;
+    PERF_END(OPL2_WRITE);
+}
+
+void opl2_flush(void) {
+    while (true) {
+        // Of the chips with writes waiting, the one that is ready first
+        int next = -1;
+        int32_t next_wait = 0;
+        uint32_t now = time_us_32();
+        for (uint8_t chip = 0; chip < OPL2_CHIPS; chip++) {
+            if (pending_count[chip] == 0) continue;
+            int32_t wait = (int32_t)(chip_ready_us[chip] - now);
+            if (next < 0 || wait < next_wait) {
+                next = chip;
+                next_wait = wait;
+            }
+        }
+        if (next < 0) return;
+
+        uint16_t entry = pending[next][pending_head[next]];
+        pending_head[next] = (pending_head[next] + 1) % OPL2_PENDING;
+        pending_count[next]--;
+        bus_write((uint8_t)next, entry);
+    }
+}
+
+void opl2_write_chip(uint8_t chip, uint8_t reg, uint8_t data) {
+    if (chip >= OPL2_CHIPS) return;
+    if (trace) trace->write(chip, reg, data);
+    write_count++;
+
+    if (pending_count[chip] == OPL2_PENDING) opl2_flush();
+    uint8_t tail = (pending_head[chip] + pending_count[chip]) % OPL2_PENDING;
+    pending[chip][tail] = (uint16_t)((reg << 8) | data);
+    pending_count[chip]++;
+}
+
+void opl2_write(uint8_t reg, uint8_t data) {
+    opl2_write_chip(0, reg, data);
+}
+
+void opl2_write_channel(uint8_t voice, uint8_t reg, uint8_t data) {
+    opl2_write_chip(opl2_chip(voice), reg + voice % OPL2_CHANNELS, data);
+}
+
+void opl2_write_operator(uint8_t voice, uint8_t reg, uint8_t data) {
+    opl2_write_chip(opl2_chip(voice), reg + op_offsets[voice % OPL2_CHANNELS], data);
 }
 
 uint16_t midi_to_opl2_freq(uint8_t midi_note) {
+    return midi_to_opl2_freq_fine(midi_note, 0);
+}
+
+uint16_t midi_to_opl2_freq_fine(uint8_t midi_note, int16_t fine) {
+    // Pitch in 1/32 semitones
+    int pitch = midi_note * 32 + fine;
+
     // Clamp to lowest valid note (C0) to prevent negative math
-    if (midi_note < 12) midi_note = 12;
+    if (pitch < 12 * 32) pitch = 12 * 32;
     
-    int block = (midi_note - 12) / 12;
-    int note_idx = (midi_note - 12) % 12;
+    int semitone = pitch / 32 - 12;
+    int frac = pitch % 32;
+    int block = semitone / 12;
+    int note_idx = semitone % 12;
     
     // OPL2 only supports Blocks 0-7
     if (block > 7) block = 7;
 
+    // Interpolate towards the next semitone (B -> C wraps to double the F-Number)
     uint16_t f_num = fnum_table[note_idx];
+    uint16_t f_next = (note_idx == 11) ? fnum_table[0] * 2 : fnum_table[note_idx + 1];
+    f_num += (uint16_t)((f_next - f_num) * frac / 32);
 
     // Pack: KeyOn (0x20) | Block | F-Num High
     uint8_t high_byte = 0x20 | (block << 2) | ((f_num >> 8) & 0x03);
@@ -63,43 +160,51 @@ uint16_t midi_to_opl2_freq(uint8_t midi_note) {
 }
 
 void opl2_note_on(uint8_t channel, uint8_t midi_note) {
-    if (channel > 8) return; // Safety
+    opl2_note_on_fine(channel, midi_note, 0);
+}
+
+void opl2_note_on_fine(uint8_t channel, uint8_t midi_note, int16_t fine) {
+    if (channel >= OPL2_VOICES) return; // Safety
 
     // 1. Calculate params using the helper
-    uint16_t freq_data = midi_to_opl2_freq(midi_note);
+    uint16_t freq_data = midi_to_opl2_freq_fine(midi_note, fine);
     uint8_t high_byte = (freq_data >> 8) & 0xFF; // Includes 0x20 (KeyOn)
     uint8_t low_byte  = freq_data & 0xFF;
 
     // 2. Write to OPL2
-    opl2_write(0xA0 + channel, low_byte);
-    opl2_write(0xB0 + channel, high_byte);
+    if (trace && trace->note_on) trace->note_on(channel, midi_note, fine);
+    opl2_write_channel(channel, 0xA0, low_byte);
+    opl2_write_channel(channel, 0xB0, high_byte);
 
     // 3. Update Shadow (Exclude KeyOn bit for safe storage)
     shadow_b0[channel] = high_byte & ~0x20;
 }
 
 void opl2_note_off(uint8_t channel) {
-    if (channel > 8) return;
+    if (channel >= OPL2_VOICES) return;
 
     // Retrieve the pitch for this channel, but keep KeyOn (0x20) CLEARED
     uint8_t safe_release_byte = shadow_b0[channel];
-    opl2_write(0xB0 + channel, safe_release_byte);
+    if (trace && trace->note_off) trace->note_off(channel);
+    opl2_write_channel(channel, 0xB0, safe_release_byte);
 }
 
 void opl2_clear() {
-    for (int i = 0; i < 256; i++) {
-        opl2_write(i, 0x00);
+    for (uint8_t chip = 0; chip < OPL2_CHIPS; chip++) {
+        for (int i = 0; i < 256; i++) {
+            opl2_write_chip(chip, i, 0x00);
+        }
     }
     // Clear shadow memory too
-    for (int i = 0; i < 9; i++) shadow_b0[i] = 0;
+    for (int i = 0; i < OPL2_VOICES; i++) shadow_b0[i] = 0;
 }
 
 void opl2_silence_all() {
-    // Turn off all 9 voices by clearing the KeyOn bit (0x20)
+    // Turn off every voice by clearing the KeyOn bit (0x20)
     // but preserve the pitch information in shadow registers
-    for (int i = 0; i < 9; i++) {
+    for (int i = 0; i < OPL2_VOICES; i++) {
         // Write the shadow value which has KeyOn cleared
-        opl2_write(0xB0 + i, shadow_b0[i] & ~0x20);
+        opl2_write_channel(i, 0xB0, shadow_b0[i] & ~0x20);
         // Don't clear shadow_b0 - keep the pitch data
     }
 }
\ No newline at end of file
@@ -3,15 +3,53 @@
 
 #include <stdint.h>
 
+// YM3812s on the bus: they share data, A0, WR and IC and each has its own
+// CS line (opl2_hardware.h). Build with -DOPL2_CHIPS=2 for 18 voices
+#ifndef OPL2_CHIPS
+#define OPL2_CHIPS 1
+#endif
+
+#define OPL2_CHANNELS  9                            // Per chip
+#define OPL2_VOICES    (OPL2_CHANNELS * OPL2_CHIPS) // Voice v is channel v % 9 of chip v / 9
+#define OPL2_PENDING   32                           // Writes a chip holds before they must go out
+
+static inline uint8_t opl2_chip(uint8_t voice) { return voice / OPL2_CHANNELS; }
+
 // Core OPL2 Functions
-extern void opl2_write(uint8_t reg, uint8_t data);
+// Writes are queued per chip and go out on opl2_flush() (or when a queue
+// fills), taking turns between the chips: one chip's data settle time is
+// spent strobing the other, so two chips take twice the writes of one.
+// Queued writes reach each chip in the order they were made.
+extern void opl2_write(uint8_t reg, uint8_t data);  // Chip 0 (tracker, streams, setup)
+extern void opl2_write_chip(uint8_t chip, uint8_t reg, uint8_t data);
+extern void opl2_write_channel(uint8_t voice, uint8_t reg, uint8_t data);   // reg + channel (A0, B0, C0)
+extern void opl2_write_operator(uint8_t voice, uint8_t reg, uint8_t data);  // reg + operator (20-F5; +3 = carrier)
+extern void opl2_flush(void);
 extern void opl2_note_on(uint8_t channel, uint8_t midi_note);
 extern void opl2_note_off(uint8_t channel);
 extern uint16_t midi_to_opl2_freq(uint8_t midi_note);
+
+// Fine pitch: offset in 1/32 semitone steps (may span several semitones)
+extern void opl2_note_on_fine(uint8_t channel, uint8_t midi_note, int16_t fine);
+extern uint16_t midi_to_opl2_freq_fine(uint8_t midi_note, int16_t fine);
 extern void opl2_clear();
 extern void opl2_silence_all();
 
-// Shadow variables
-extern uint8_t shadow_b0[9];
+// Shadow variables (per voice, so each chip has its own)
+extern uint8_t shadow_b0[OPL2_VOICES];
+
+// Register trace (host tools such as songc/): sees every register write
+// as it is queued, plus the note behind each key-on/key-off just before
+// its A0/B0 writes, so a recorder can keep pitches symbolic (note_on and
+// note_off may be NULL)
+typedef struct {
+    void (*write)(uint8_t chip, uint8_t reg, uint8_t data);
+    void (*note_on)(uint8_t channel, uint8_t midi_note, int16_t fine);
+    void (*note_off)(uint8_t channel);
+} OPL2Trace;
+
+extern void opl2_set_trace(const OPL2Trace *trace);  // NULL to stop tracing
+
+extern uint32_t opl2_get_write_count(void);  // Register writes since boot
 
 #endif // OPL_H
\ No newline at end of file
@@ -10,11 +10,17 @@ void opl2_hw_init() {
 
     // Initialize Control Pins
     uint32_t control_mask = (1 << OPL2_A0) | (1 << OPL2_WR) | (1 << OPL2_CS) | (1 << OPL2_IC);
+#if OPL2_CHIPS > 1
+    control_mask |= 1 << OPL2_CS2;
+#endif
     gpio_init_mask(control_mask);
     gpio_set_dir_out_masked(control_mask);
 
-    // Set default idle state: CS and WR High, IC High
+    // Set default idle state: CS and WR High, IC High (IC resets every chip)
     gpio_put(OPL2_CS, 1);
+#if OPL2_CHIPS > 1
+    gpio_put(OPL2_CS2, 1);
+#endif
     gpio_put(OPL2_WR, 1);
     gpio_put(OPL2_IC, 1);
 
@@ -26,7 +32,7 @@ void opl2_hw_init() {
 }
 
 void start_opl2_clock() {
-    // We want 3.579545 MHz. 
+    // We want 3.579545 MHz (one clock drives every chip). 
     // The Pico system clock is usually 125MHz.
     // We can use the PWM slice to create a precise clock divider.
     uint gpio = 21; // Using GP21 (Pin 27)
@@ -55,18 +61,21 @@ void hardware_setup() {
     // 3. Optional: Give the chip a moment to stabilize
     sleep_ms(100);
 
-    // 4. Clear all registers (optional but recommended)
-    for(int i = 0; i < 255; i++) opl2_write(i, 0x00);
+    for (uint8_t chip = 0; chip < OPL2_CHIPS; chip++) {
+        // 4. Clear all registers (optional but recommended)
+        for(int i = 0; i < 255; i++) opl2_write_chip(chip, i, 0x00);
 
-    // 5. ENABLE WAVEFORM SELECT (The "Secret Sauce")
-    // Register 0x01, Bit 5 must be 1 to allow non-sine waveforms.
-    // Without this, OPL2 ignores waveform settings in your MIDI patches.
-    opl2_write(0x01, 0x20); 
+        // 5. ENABLE WAVEFORM SELECT (The "Secret Sauce")
+        // Register 0x01, Bit 5 must be 1 to allow non-sine waveforms.
+        // Without this, OPL2 ignores waveform settings in your MIDI patches.
+        opl2_write_chip(chip, 0x01, 0x20); 
 
-    // 6. INITIALIZE RHYTHM MODE (Optional)
-    // Register 0xBD controls the percussion. Zeroing it (done above) 
-    // puts it in "6-melody, 5-rhythm" or "9-melody" mode.
-    opl2_write(0xBD, 0x00); 
+        // 6. INITIALIZE RHYTHM MODE (Optional)
+        // Register 0xBD controls the percussion. Zeroing it (done above) 
+        // puts it in "6-melody, 5-rhythm" or "9-melody" mode.
+        opl2_write_chip(chip, 0xBD, 0x00); 
+    }
+    opl2_flush();
 
     // printf("YM3812 Hardware Initialized and Waveforms Unlocked.\n");
 }
\ No newline at end of file
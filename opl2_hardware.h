@@ -6,11 +6,18 @@
 #define OPL2_WR        9
 #define OPL2_CS        10
 #define OPL2_IC        11
+#define OPL2_CS2       18   // Second YM3812's chip select (OPL2_CHIPS 2, see opl2.h)
 
 // Timing constants (slightly conservative for clones)
 #define OPL2_WAIT_ADDRESS 4  // microseconds
 #define OPL2_WAIT_DATA    23 // microseconds
 
+// One write, both strobes included: a chip takes ~34,000 writes a second
+// at most (it needs 12 + 84 of its 3.58 MHz cycles, ~27 us, so this is
+// within 10% of its own limit). A second chip's writes go in while the
+// first settles, so the bus holds OPL2_CHIPS times that
+#define OPL2_WRITE_US     (2 + OPL2_WAIT_ADDRESS + OPL2_WAIT_DATA)
+
 extern void opl2_hw_init();
 extern void opl2_write(uint8_t reg, uint8_t data);
 extern void start_opl2_clock();
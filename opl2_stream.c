@@ -0,0 +1,102 @@
+/**
+ * opl2_stream.c
+ *
+ * Precompiled OPL2 Register Stream Playback
+ */
+
+#include "opl2_stream.h"
+#include "opl2.h"
+#include "instruments.h"
+#include <stddef.h>
+
+static const uint8_t *stream = NULL;
+static int8_t transpose = 0;
+static uint8_t attenuation = 0;
+
+void opl2_stream_select(const uint8_t *data) {
+    stream = data;
+}
+
+// Carrier total level (0x43+off) with the playback volume applied;
+// 0x40-0x55 holds modulators at offsets 0-2 and carriers at 3-5 of each group of 8
+static uint8_t stream_level(uint8_t reg, uint8_t data) {
+    if (reg < 0x40 || reg > 0x55 || ((reg - 0x40) & 7) < 3) return data;
+
+    uint8_t tl = (data & 0x3F) + attenuation;
+    if (tl > 63) tl = 63;
+    return (data & 0xC0) | tl;
+}
+
+void opl2_stream_run(uint32_t pos) {
+    if (stream == NULL) return;
+    const uint8_t *s = stream;
+
+    invalidate_channel_programs();
+
+    while (true) {
+        uint8_t op = s[pos];
+        if (op < STREAM_OP_NOTE_ON) {
+            opl2_write(op, stream_level(op, s[pos + 1]));
+            pos += 2;
+        } else if (op == STREAM_OP_NOTE_ON) {
+            uint8_t voice = s[pos + 1];
+            int note = s[pos + 2];
+            if (voice != 8) {  // Streams are one chip's (songc): 8 is its drum voice
+                note += transpose;
+                if (note < 0) note = 0;
+                if (note > 127) note = 127;
+            }
+            opl2_note_on_fine(voice, (uint8_t)note, (int8_t)s[pos + 3]);
+            pos += 4;
+        } else if (op == STREAM_OP_NOTE_OFF) {
+            opl2_note_off(s[pos + 1]);
+            pos += 2;
+        } else {
+            return;  // Wait or end: Core 0 schedules the next run
+        }
+    }
+}
+
+bool opl2_stream_next(const uint8_t *s, uint32_t *pos, uint32_t *units) {
+    uint32_t p = *pos;
+
+    while (true) {
+        uint8_t op = s[p];
+        if (op < STREAM_OP_NOTE_ON || op == STREAM_OP_NOTE_OFF) {
+            p += 2;
+        } else if (op == STREAM_OP_NOTE_ON) {
+            p += 4;
+        } else if (op == STREAM_OP_WAIT) {
+            *units = s[p + 1];
+            *pos = p + 2;
+            return true;
+        } else if (op == STREAM_OP_WAIT16) {
+            *units = s[p + 1] | (s[p + 2] << 8);
+            *pos = p + 3;
+            return true;
+        } else {
+            // End (anything unknown is treated as the end too)
+            *units = 0;
+            *pos = p;
+            return false;
+        }
+    }
+}
+
+void opl2_stream_set_transpose(int8_t semitones) {
+    if (semitones < -24) semitones = -24;
+    if (semitones > 24) semitones = 24;
+    transpose = semitones;
+}
+
+int8_t opl2_stream_get_transpose(void) {
+    return transpose;
+}
+
+void opl2_stream_set_attenuation(uint8_t steps) {
+    attenuation = steps > 63 ? 63 : steps;
+}
+
+uint8_t opl2_stream_get_attenuation(void) {
+    return attenuation;
+}
@@ -0,0 +1,99 @@
+/**
+ * opl2_stream.h
+ *
+ * Precompiled OPL2 Register Streams
+ * Songs compiled offline by songc/ into timed register writes
+ *
+ * songc runs the real audio engine, voice manager and instrument code on
+ * the host against the register trace (opl2_set_trace), so a stream holds
+ * exactly the writes the engine would have made - velocity, patch loads
+ * and voice allocation are all done at compile time. Playback is a loop
+ * of register writes with no per-event decisions.
+ *
+ * STREAM FORMAT
+ * -------------
+ * A byte stream of opcodes:
+ *
+ *   0x00-0xF5  reg, data          Register write
+ *   0xF6       voice, note, fine  Key on (fine: int8, 1/32 semitone)
+ *   0xF7       voice              Key off
+ *   0xF8       n                  Wait n units
+ *   0xF9       lo, hi             Wait n units (16-bit)
+ *   0xFF                          End of song
+ *
+ * One unit is STREAM_TICK_US. Keys stay symbolic so playback can
+ * transpose them, and carrier total-level writes take the playback volume;
+ * both are applied as the stream runs.
+ */
+
+#ifndef OPL2_STREAM_H
+#define OPL2_STREAM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define STREAM_TICK_US      100   // Time unit of stream waits
+
+#define STREAM_OP_NOTE_ON   0xF6
+#define STREAM_OP_NOTE_OFF  0xF7
+#define STREAM_OP_WAIT      0xF8
+#define STREAM_OP_WAIT16    0xF9
+#define STREAM_OP_END       0xFF
+
+/**
+ * Make a stream current for opl2_stream_run()
+ * Set before the first run is queued (Core 0)
+ */
+void opl2_stream_select(const uint8_t *stream);
+
+/**
+ * Play the register writes from pos up to the next wait (Core 1)
+ * The instrument cache is invalidated, as the writes bypass it
+ *
+ * @param pos Byte offset of the first opcode
+ */
+void opl2_stream_run(uint32_t pos);
+
+/**
+ * Step over the writes at pos to the next wait, and read it
+ * Core 0 uses this to schedule runs without touching the chip
+ *
+ * @param stream Stream data
+ * @param pos Byte offset; advanced past the wait
+ * @param units Set to the wait length (0 at the end of the stream)
+ * @return false at the end of the stream (pos left on the end opcode)
+ */
+bool opl2_stream_next(const uint8_t *stream, uint32_t *pos, uint32_t *units);
+
+/**
+ * Transpose stream notes (drums on voice 8 keep their pitch)
+ * Safe from Core 0 (the console's "stream" command): a single byte that
+ * Core 1 reads at each note
+ *
+ * @param semitones -24 to +24
+ */
+void opl2_stream_set_transpose(int8_t semitones);
+
+/**
+ * Get the stream transpose
+ *
+ * @return Semitones
+ */
+int8_t opl2_stream_get_transpose(void);
+
+/**
+ * Quieten stream playback
+ * Safe from Core 0 like the transpose; takes effect on the next level write
+ *
+ * @param steps Extra carrier attenuation in 0.75 dB steps (0 = as compiled)
+ */
+void opl2_stream_set_attenuation(uint8_t steps);
+
+/**
+ * Get the stream attenuation
+ *
+ * @return Steps of 0.75 dB
+ */
+uint8_t opl2_stream_get_attenuation(void);
+
+#endif // OPL2_STREAM_H
@@ -0,0 +1,73 @@
+import re
+import sys
+
+# Builds SysEx patch uploads for PicoOPL2 (protocol documented in sysex.h)
+#
+#   python patch2syx.py instruments.c bank.syx             # whole bank
+#   python patch2syx.py instruments.c patch.syx 30         # one program
+#   python patch2syx.py instruments.c --send "Port Name" 30
+
+FIELDS = ['m_ave', 'm_ksl', 'm_atdec', 'm_susrel', 'm_wave',
+          'c_ave', 'c_ksl', 'c_atdec', 'c_susrel', 'c_wave', 'feedback']
+
+MANUFACTURER_ID = 0x7D
+CMD_PATCH = 0x01
+CMD_BANK = 0x02
+
+def read_bank(c_file):
+    # Pull "[n] = { .m_ave=0x.., ... }" entries out of instruments.c
+    bank = {}
+    entry = re.compile(r'\[(\d+)\]\s*=\s*\{([^}]*)\}')
+    for m in entry.finditer(open(c_file).read()):
+        values = dict(re.findall(r'\.(\w+)=(0x[0-9A-Fa-f]+|\d+)', m.group(2)))
+        if all(f in values for f in FIELDS):
+            bank[int(m.group(1))] = [int(values[f], 0) for f in FIELDS]
+    return bank
+
+def encode_record(program, patch):
+    nibbles = []
+    for b in patch:
+        nibbles += [(b >> 4) & 0x0F, b & 0x0F]
+    total = (program >> 4) + (program & 0x0F) + sum(nibbles)
+    return nibbles + [(128 - (total & 0x7F)) & 0x7F]
+
+def build_sysex(bank, first, count):
+    cmd = CMD_PATCH if count == 1 else CMD_BANK
+    msg = [0xF0, MANUFACTURER_ID, cmd, first >> 4, first & 0x0F]
+    for program in range(first, first + count):
+        # Programs missing from the source keep a silent patch
+        msg += encode_record(program, bank.get(program, [0] * 11))
+    msg.append(0xF7)
+    return bytes(msg)
+
+if __name__ == "__main__":
+    if len(sys.argv) < 3:
+        print("Usage: python patch2syx.py <instruments.c> <out.syx | --send PORT> [program]")
+        sys.exit(1)
+
+    bank = read_bank(sys.argv[1])
+    send_port = None
+    args = sys.argv[2:]
+    if args[0] == "--send":
+        send_port = args[1]
+        args = args[2:]
+    else:
+        out_file = args[0]
+        args = args[1:]
+
+    if args:
+        first, count = int(args[0]), 1
+    else:
+        first, count = 0, 256
+
+    data = build_sysex(bank, first, count)
+
+    if send_port:
+        import mido
+        with mido.open_output(send_port) as port:
+            port.send(mido.Message('sysex', data=data[1:-1]))
+        print(f"Sent {count} patch(es) to {send_port}")
+    else:
+        with open(out_file, 'wb') as f:
+            f.write(data)
+        print(f"Wrote {count} patch(es), {len(data)} bytes to {out_file}")
@@ -0,0 +1,54 @@
+/**
+ * perf.c
+ *
+ * Cycle Counters Implementation
+ */
+
+#include "perf.h"
+#include <stddef.h>
+
+static const char *const names[PERF_COUNT] = {
+    "opl2_write", "write_patch", "allocate", "velocity", "uart_rx", "render", "core1_event"
+};
+
+const char* perf_name(perf_id_t id) {
+    return id < PERF_COUNT ? names[id] : "?";
+}
+
+#if PERF_ENABLED
+
+#if PICO_ON_DEVICE
+#include "pico/platform.h"
+
+PerfCounter __scratch_y("perf") perf_core0[PERF_COUNT];
+PerfCounter __scratch_x("perf") perf_core1[PERF_COUNT];
+
+void perf_init_core(void) {
+    systick_hw->rvr = PERF_CYCLE_MASK;
+    systick_hw->cvr = 0;
+    systick_hw->csr = 0x5;  // Enable, processor clock, no interrupt
+}
+
+const PerfCounter* perf_counters(uint8_t core) {
+    if (core == 0) return perf_core0;
+    if (core == 1) return perf_core1;
+    return NULL;
+}
+#else
+PerfCounter perf_core0[PERF_COUNT];
+
+void perf_init_core(void) {}
+
+const PerfCounter* perf_counters(uint8_t core) {
+    return core == 0 ? perf_core0 : NULL;
+}
+#endif
+
+#else
+
+const PerfCounter* perf_counters(uint8_t core) {
+    (void)core;
+    return NULL;
+}
+
+#endif // PERF_ENABLED
@@ -0,0 +1,125 @@
+/**
+ * perf.h
+ *
+ * Cycle Counters
+ * Call counts and cycle totals for the hot paths, compiled in on demand
+ *
+ * Build with PERF_ENABLED=1 (cmake -DPERF=ON) to turn the PERF_BEGIN /
+ * PERF_END pairs into counters; otherwise they compile to nothing.
+ *
+ * On the Pico the count comes from the core's own SysTick, running at the
+ * system clock, so the figures are CPU cycles (24 bits: spans up to ~0.1 s
+ * at 125 MHz). Each core has its own table - Core 0's in scratch Y, Core
+ * 1's in scratch X, next to their stacks - and only ever writes its own,
+ * so no atomics are needed. A reader on the other core may catch a counter
+ * mid-update; that costs one sample, not correctness.
+ *
+ * Host builds (songc) use the same macros on clock_gettime(), counting
+ * nanoseconds, with a single table.
+ *
+ * Read them with the console's "perf" command (console.h).
+ */
+
+#ifndef PERF_H
+#define PERF_H
+
+#include <stdint.h>
+
+#ifndef PERF_ENABLED
+#define PERF_ENABLED 0
+#endif
+
+// What is counted (PERF_BEGIN(OPL2_WRITE) ... PERF_END(OPL2_WRITE))
+typedef enum {
+    PERF_OPL2_WRITE,       // One register write on the bus (see opl2_flush)
+    PERF_WRITE_PATCH,      // write_patch_to_channel(): a full patch
+    PERF_ALLOCATE_VOICE,   // allocate_voice(s)()
+    PERF_APPLY_VELOCITY,   // apply_velocity()
+    PERF_UART_RX,          // MIDI UART interrupt
+    PERF_RENDER_DISPLAY,   // Menu redraw, up to queueing the LCD writes
+    PERF_CORE1_EVENT,      // Core 1 loop: handling one event (its writes are queued)
+    PERF_COUNT
+} perf_id_t;
+
+typedef struct {
+    uint32_t calls;
+    uint32_t max;          // Longest call
+    uint64_t total;
+} PerfCounter;
+
+#define PERF_CORES 2
+
+/**
+ * Name of a counter, for reports
+ */
+const char* perf_name(perf_id_t id);
+
+/**
+ * A core's counters (host builds have only core 0)
+ *
+ * @return PERF_COUNT counters, or NULL if the core has none
+ */
+const PerfCounter* perf_counters(uint8_t core);
+
+#if PERF_ENABLED
+
+#if PICO_ON_DEVICE
+#include "hardware/structs/systick.h"
+#include "hardware/sync.h"
+
+#define PERF_CYCLE_MASK 0xFFFFFFu
+
+extern PerfCounter perf_core0[PERF_COUNT];
+extern PerfCounter perf_core1[PERF_COUNT];
+
+// SysTick counts down; flip it so later is larger
+static inline uint32_t perf_cycles(void) {
+    return ~systick_hw->cvr;
+}
+
+static inline PerfCounter* perf_table(void) {
+    return get_core_num() ? perf_core1 : perf_core0;
+}
+#else
+#include <time.h>
+
+#define PERF_CYCLE_MASK 0xFFFFFFFFu
+
+extern PerfCounter perf_core0[PERF_COUNT];
+
+static inline uint32_t perf_cycles(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec);
+}
+
+static inline PerfCounter* perf_table(void) {
+    return perf_core0;
+}
+#endif
+
+static inline void perf_record(perf_id_t id, uint32_t begin) {
+    uint32_t cycles = (perf_cycles() - begin) & PERF_CYCLE_MASK;
+    PerfCounter *c = &perf_table()[id];
+    c->calls++;
+    c->total += cycles;
+    if (cycles > c->max) c->max = cycles;
+}
+
+/**
+ * Start the calling core's cycle counter (once per core, before counting)
+ */
+void perf_init_core(void);
+
+#define PERF_BEGIN(id)  uint32_t perf_begin_##id = perf_cycles()
+#define PERF_END(id)    perf_record(PERF_##id, perf_begin_##id)
+
+#else
+
+#define perf_init_core()  ((void)0)
+#define PERF_BEGIN(id)    ((void)0)
+#define PERF_END(id)      ((void)0)
+
+#endif // PERF_ENABLED
+
+#endif // PERF_H
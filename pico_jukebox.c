@@ -239,7 +239,12 @@ int main() {
         printf("Core 0: Feeding Queue...\n");
         int i = 0;
         while(true) {
-            SongEvent e = midi_song[i++];
+            // Song data is in ticks: this test loop just plays it at the
+            // opening tempo (tick deltas converted to ms)
+            const SongTickEvent *t = &midi_song[i++];
+            if (t->type == 255) continue;  // Wait marker, the test loop has no long rests
+            SongEvent e = { .type=t->type, .channel=t->channel, .note=t->note, .velocity=t->velocity };
+            e.delay_ms = (uint16_t)((uint64_t)t->delta_ticks * midi_song_tempo[0].us_per_quarter / (MIDI_SONG_PPQ * 1000ULL));
             
             if (e.type == 2) {
                 // End of song marker
@@ -2,20 +2,42 @@
 #define QUEUE_H
 
 #include <stdint.h>
-#include "pico/util/queue.h"
+
+// Where a live event came from (SongEvent.source)
+#define MIDI_SOURCE_INTERNAL  0   // Song player, menu, SysEx notifications
+#define MIDI_SOURCE_DIN       1   // 5-pin DIN UART
+#define MIDI_SOURCE_USB       2   // USB-MIDI device
+
+// Voice hint from midi2c.py's allocation pre-pass (SongEvent.voice)
+// 0 = no hint: the engine allocates the voice itself
+#define VOICE_HINT_ASSIGNED   0x10  // Low nibble is the physical voice the note uses
+#define VOICE_HINT_LOADED     0x20  // That voice already holds the note's patch
+#define VOICE_HINT_VOICE(h)   ((h) & 0x0F)
 
 // --- The Data Packet ---
 // Used by: 
-// 1. Python Script (generates arrays of this)
-// 2. Queue (passes these between cores)
-// 3. Audio Engine (processes MIDI events)
+// 1. Queue (passes these between cores)
+// 2. Audio Engine (processes MIDI events)
+// Song files are stored in ticks instead (SongTickEvent, see song_format.h)
 
 typedef struct {
-    uint8_t type;      // 1=NoteOn, 0=NoteOff, 3=PatchChange
+    uint8_t type;      // 1=NoteOn, 0=NoteOff, 2=Reset, 3=PatchChange, 4=ControlChange,
+                       // 5=PatchUpdate (bank edit, payload in the engine's patch queue),
+                       // 6=BankSelect (note = bank number),
+                       // 7=Prefetch (note = program to preload on an idle voice),
+                       // 8=StreamRun (channel:note:velocity = 24-bit offset, see opl2_stream.h),
+                       // 9=RegisterWrite (note = register, velocity = data, see tracker_player.h),
+                       // 10=PitchBend (note = LSB, velocity = MSB),
+                       // 11=Fade (note = FADE_*, channel:velocity = ms, see modulation.h),
+                       // 12=DrumPatch (note = GM drum note, loaded on the drum voice),
+                       // 13=LayerPolicy (note = layer_policy_t for the channel, see midi_state.h),
+                       // 14=TrackerEffect (channel = OPL channel, note = CHANNEL_FX_*, velocity = parameter)
+    uint8_t voice;     // VOICE_HINT_* for song notes and prefetches, else 0
     uint16_t delay_ms; // 16-bit Delay
     uint8_t channel;   // 0-8
-    uint8_t note;      // MIDI Note (0-127) or Program Number
-    uint8_t velocity;  // 0-127 (Volume Dynamics)
+    uint8_t note;      // MIDI Note (0-127), Program Number or Controller Number
+    uint8_t velocity;  // 0-127 (Volume Dynamics) or Controller Value
+    uint8_t source;    // MIDI_SOURCE_* (voice and source keep the struct at 8 bytes)
 } SongEvent;
 
 #endif // QUEUE_H
\ No newline at end of file
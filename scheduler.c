@@ -0,0 +1,77 @@
+/**
+ * scheduler.c
+ *
+ * Core 0 Task Scheduler Implementation
+ */
+
+#include "scheduler.h"
+#include "pico/stdlib.h"
+
+typedef struct {
+    const char *name;
+    sched_task_fn run;
+    uint32_t period_us;
+    uint32_t budget_us;
+    uint64_t due_us;       // Next deadline
+    uint32_t overruns;     // Runs over budget
+    uint32_t max_us;       // Longest run
+} SchedTask;
+
+static SchedTask tasks[SCHED_MAX_TASKS];
+static uint8_t task_count = 0;
+
+bool scheduler_add(const char *name, sched_task_fn run, uint32_t period_us, uint32_t budget_us) {
+    if (task_count >= SCHED_MAX_TASKS) return false;
+
+    SchedTask *t = &tasks[task_count++];
+    t->name = name;
+    t->run = run;
+    t->period_us = period_us;
+    t->budget_us = budget_us;
+    t->due_us = time_us_64();
+    t->overruns = 0;
+    t->max_us = 0;
+    return true;
+}
+
+void scheduler_run_once(void) {
+    uint64_t now = time_us_64();
+    uint64_t earliest = UINT64_MAX;
+
+    for (uint8_t i = 0; i < task_count; i++) {
+        SchedTask *t = &tasks[i];
+        if (now < t->due_us) {
+            if (t->due_us < earliest) earliest = t->due_us;
+            continue;
+        }
+
+        t->run();
+        uint64_t end = time_us_64();
+        uint32_t cost = (uint32_t)(end - now);
+        if (cost > t->max_us) t->max_us = cost;
+        if (cost > t->budget_us) t->overruns++;
+
+        // Next period on the same grid; a late task is run once, not replayed
+        t->due_us += t->period_us;
+        if (t->due_us <= end) t->due_us = end + t->period_us;
+        return;  // Look again from the top
+    }
+
+    if (earliest != UINT64_MAX) {
+        absolute_time_t wake;
+        update_us_since_boot(&wake, earliest);
+        best_effort_wfe_or_timeout(wake);
+    }
+}
+
+bool scheduler_get_stats(uint8_t index, SchedStats *out) {
+    if (index >= task_count) return false;
+
+    const SchedTask *t = &tasks[index];
+    out->name = t->name;
+    out->period_us = t->period_us;
+    out->budget_us = t->budget_us;
+    out->max_us = t->max_us;
+    out->overruns = t->overruns;
+    return true;
+}
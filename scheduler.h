@@ -0,0 +1,81 @@
+/**
+ * scheduler.h
+ *
+ * Core 0 Task Scheduler
+ * Runs the main loop's jobs by deadline and priority
+ *
+ * Each task has a period and a time budget. Tasks are added highest
+ * priority first (song feed, then USB, then the UI; DIN MIDI is parsed
+ * in the UART interrupt and needs no task). The scheduler runs
+ * the highest-priority task that is due, then looks again from the top,
+ * so a song deadline that fell due while the menu was drawing goes next.
+ * A task that falls more than a period behind is run once, not replayed.
+ * With nothing due, core 0 sleeps (WFE) until the earliest deadline or an
+ * interrupt (UART, USB, encoder), instead of polling.
+ *
+ * A task that runs longer than its budget counts as an overrun; budgets
+ * are not enforced, so they show where the time goes rather than cut it
+ * (console.h: stats).
+ */
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SCHED_MAX_TASKS 8
+
+// The firmware's task set (PicoOPL2.c), period and budget in us. While
+// every run keeps to its budget, a song event is released less than
+// SCHED_JITTER_LIMIT_US after it falls due: at most one song period plus
+// the longest other task. songc/sched_jitter checks this on the host;
+// "stats" on the console shows the runs on hardware that overran
+#define SCHED_JITTER_LIMIT_US  200
+#define SCHED_SONG_PERIOD_US   100
+#define SCHED_SONG_BUDGET_US   50
+#define SCHED_USB_PERIOD_US    1000
+#define SCHED_USB_BUDGET_US    80
+#define SCHED_UI_PERIOD_US     5000
+#define SCHED_UI_BUDGET_US     80
+#define SCHED_CON_PERIOD_US    2000
+#define SCHED_CON_BUDGET_US    80
+
+typedef void (*sched_task_fn)(void);
+
+// A task's counters since boot, for the console
+typedef struct {
+    const char *name;
+    uint32_t period_us;
+    uint32_t budget_us;
+    uint32_t max_us;       // Longest run
+    uint32_t overruns;     // Runs over budget
+} SchedStats;
+
+/**
+ * Add a task (call in priority order, highest first)
+ *
+ * @param name Short name for the report
+ * @param run Function to call each period
+ * @param period_us Time between runs
+ * @param budget_us Longest a run should take
+ * @return false if the task table is full
+ */
+bool scheduler_add(const char *name, sched_task_fn run, uint32_t period_us, uint32_t budget_us);
+
+/**
+ * Run the due task of highest priority, or sleep until one is due
+ * Call from the main loop
+ */
+void scheduler_run_once(void);
+
+/**
+ * Read a task's counters
+ *
+ * @param index Task number, in the order added
+ * @param out Filled with the task's counters
+ * @return false past the last task
+ */
+bool scheduler_get_stats(uint8_t index, SchedStats *out);
+
+#endif // SCHEDULER_H
@@ -1,4677 +1,4684 @@
 #ifndef MIDI_SONG_H
 #define MIDI_SONG_H
 
-#include "queue.h"
+#include "song_format.h"
 
-const SongEvent midi_song[] = {
-    { .type=3, .delay_ms=0, .channel=0, .note=30, .velocity=0 },
-    { .type=3, .delay_ms=0, .channel=1, .note=29, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=108 },
-    { .type=3, .delay_ms=0, .channel=2, .note=34, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=120 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=115 },
-    { .type=1, .delay_ms=0, .channel=9, .note=41, .velocity=120 },
-    { .type=0, .delay_ms=41, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=45, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=1, .note=40, .velocity=114 },
-    { .type=0, .delay_ms=8, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=41, .velocity=0 },
-    { .type=1, .delay_ms=116, .channel=1, .note=52, .velocity=114 },
-    { .type=0, .delay_ms=20, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=112, .channel=1, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=110 },
-    { .type=0, .delay_ms=41, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=91, .channel=1, .note=40, .velocity=110 },
-    { .type=1, .delay_ms=133, .channel=1, .note=50, .velocity=111 },
-    { .type=0, .delay_ms=12, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=104, .channel=1, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=1, .note=40, .velocity=104 },
-    { .type=0, .delay_ms=41, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=91, .channel=1, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=133, .channel=1, .note=48, .velocity=116 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=125, .channel=1, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=108 },
-    { .type=0, .delay_ms=41, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=91, .channel=1, .note=40, .velocity=110 },
-    { .type=1, .delay_ms=133, .channel=1, .note=46, .velocity=110 },
-    { .type=0, .delay_ms=12, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=116, .channel=1, .note=46, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=110 },
-    { .type=0, .delay_ms=58, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=75, .channel=1, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=137, .channel=1, .note=47, .velocity=110 },
-    { .type=0, .delay_ms=125, .channel=1, .note=47, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=1, .note=48, .velocity=117 },
-    { .type=0, .delay_ms=91, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=25, .channel=1, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=2, .note=40, .velocity=127 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=41, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=123 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=25, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=70, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=41, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=133, .channel=1, .note=52, .velocity=114 },
-    { .type=0, .delay_ms=29, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=87, .channel=1, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=16, .channel=1, .note=40, .velocity=106 },
-    { .type=0, .delay_ms=41, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=87, .channel=1, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=133, .channel=1, .note=50, .velocity=106 },
-    { .type=0, .delay_ms=20, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=112, .channel=1, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=114 },
-    { .type=0, .delay_ms=41, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=87, .channel=1, .note=40, .velocity=106 },
-    { .type=0, .delay_ms=133, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=48, .velocity=117 },
-    { .type=0, .delay_ms=112, .channel=1, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=25, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=50, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=1, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=133, .channel=1, .note=46, .velocity=114 },
-    { .type=0, .delay_ms=645, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=2, .note=40, .velocity=127 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=41, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=123 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=108 },
-    { .type=0, .delay_ms=20, .channel=1, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=41, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=1, .note=40, .velocity=107 },
-    { .type=1, .delay_ms=129, .channel=1, .note=52, .velocity=113 },
-    { .type=0, .delay_ms=62, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=70, .channel=1, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=105 },
-    { .type=0, .delay_ms=50, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=87, .channel=1, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=133, .channel=1, .note=50, .velocity=110 },
-    { .type=0, .delay_ms=20, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=112, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=0, .channel=1, .note=50, .velocity=0 },
-    { .type=0, .delay_ms=54, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=75, .channel=1, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=133, .channel=1, .note=48, .velocity=118 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=116, .channel=1, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=106 },
-    { .type=0, .delay_ms=41, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=87, .channel=1, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=133, .channel=1, .note=46, .velocity=115 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=125, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=20, .channel=1, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=87, .channel=1, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=133, .channel=1, .note=47, .velocity=110 },
-    { .type=0, .delay_ms=133, .channel=1, .note=47, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=1, .note=48, .velocity=111 },
-    { .type=0, .delay_ms=70, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=54, .channel=1, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=127 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=119 },
-    { .type=1, .delay_ms=0, .channel=9, .note=41, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=119 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=110 },
-    { .type=0, .delay_ms=41, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=50, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=41, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=9, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=16, .channel=1, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=129, .channel=1, .note=52, .velocity=117 },
-    { .type=0, .delay_ms=100, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=33, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=12, .channel=1, .note=52, .velocity=0 },
-    { .type=0, .delay_ms=37, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=1, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=129, .channel=1, .note=50, .velocity=110 },
-    { .type=0, .delay_ms=37, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=95, .channel=1, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=114 },
-    { .type=0, .delay_ms=41, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=91, .channel=1, .note=40, .velocity=115 },
-    { .type=0, .delay_ms=129, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=48, .velocity=117 },
-    { .type=1, .delay_ms=133, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=50, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=1, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=66, .channel=1, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=133, .channel=1, .note=46, .velocity=114 },
-    { .type=0, .delay_ms=645, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=41, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=57, .velocity=61 },
-    { .type=1, .delay_ms=0, .channel=9, .note=49, .velocity=71 },
-    { .type=0, .delay_ms=4, .channel=1, .note=46, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=108 },
-    { .type=0, .delay_ms=37, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=57, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=9, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=41, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=62, .channel=9, .note=57, .velocity=23 },
-    { .type=1, .delay_ms=0, .channel=9, .note=49, .velocity=23 },
-    { .type=0, .delay_ms=41, .channel=9, .note=57, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=49, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=52, .velocity=114 },
-    { .type=1, .delay_ms=8, .channel=1, .note=52, .velocity=114 },
-    { .type=0, .delay_ms=12, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=104, .channel=0, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=0, .note=40, .velocity=110 },
-    { .type=0, .delay_ms=0, .channel=1, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=110 },
-    { .type=0, .delay_ms=41, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=91, .channel=0, .note=40, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=110 },
-    { .type=1, .delay_ms=133, .channel=0, .note=50, .velocity=111 },
-    { .type=1, .delay_ms=4, .channel=1, .note=50, .velocity=111 },
-    { .type=0, .delay_ms=8, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=95, .channel=0, .note=50, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=0, .note=40, .velocity=104 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=104 },
-    { .type=0, .delay_ms=33, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=125, .channel=0, .note=48, .velocity=116 },
-    { .type=0, .delay_ms=0, .channel=0, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=1, .note=48, .velocity=116 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=120, .channel=0, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=0, .note=40, .velocity=108 },
-    { .type=0, .delay_ms=0, .channel=1, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=108 },
-    { .type=0, .delay_ms=33, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=110 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=110 },
-    { .type=1, .delay_ms=125, .channel=0, .note=46, .velocity=110 },
-    { .type=1, .delay_ms=4, .channel=1, .note=46, .velocity=110 },
-    { .type=0, .delay_ms=8, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=108, .channel=0, .note=46, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=40, .velocity=110 },
-    { .type=0, .delay_ms=0, .channel=1, .note=46, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=110 },
-    { .type=0, .delay_ms=50, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=70, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=129, .channel=0, .note=47, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=1, .note=47, .velocity=110 },
-    { .type=0, .delay_ms=125, .channel=0, .note=47, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=48, .velocity=117 },
-    { .type=0, .delay_ms=0, .channel=1, .note=47, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=48, .velocity=117 },
-    { .type=0, .delay_ms=91, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=25, .channel=0, .note=48, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=16, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=125 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=41, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=57, .velocity=64 },
-    { .type=1, .delay_ms=0, .channel=9, .note=49, .velocity=70 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=20, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=58, .channel=9, .note=57, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=41, .velocity=0 },
-    { .type=1, .delay_ms=33, .channel=0, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=0, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=54, .channel=9, .note=57, .velocity=23 },
-    { .type=1, .delay_ms=0, .channel=9, .note=49, .velocity=23 },
-    { .type=0, .delay_ms=50, .channel=9, .note=57, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=49, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=52, .velocity=114 },
-    { .type=1, .delay_ms=8, .channel=1, .note=52, .velocity=114 },
-    { .type=0, .delay_ms=20, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=83, .channel=0, .note=52, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=106 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=106 },
-    { .type=0, .delay_ms=37, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=125, .channel=0, .note=50, .velocity=106 },
-    { .type=1, .delay_ms=8, .channel=1, .note=50, .velocity=106 },
-    { .type=0, .delay_ms=12, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=104, .channel=0, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=40, .velocity=114 },
-    { .type=0, .delay_ms=4, .channel=1, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=114 },
-    { .type=0, .delay_ms=37, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=106 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=106 },
-    { .type=1, .delay_ms=125, .channel=0, .note=48, .velocity=117 },
-    { .type=0, .delay_ms=8, .channel=0, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=48, .velocity=117 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=100, .channel=0, .note=48, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=50, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=133, .channel=0, .note=46, .velocity=114 },
-    { .type=1, .delay_ms=4, .channel=1, .note=46, .velocity=114 },
-    { .type=0, .delay_ms=641, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=125 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=121 },
-    { .type=1, .delay_ms=0, .channel=9, .note=41, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=49, .velocity=74 },
-    { .type=1, .delay_ms=0, .channel=9, .note=57, .velocity=56 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=108 },
-    { .type=0, .delay_ms=12, .channel=0, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=57, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=41, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=9, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=16, .channel=0, .note=40, .velocity=107 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=107 },
-    { .type=0, .delay_ms=8, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=54, .channel=9, .note=49, .velocity=23 },
-    { .type=1, .delay_ms=0, .channel=9, .note=57, .velocity=23 },
-    { .type=0, .delay_ms=41, .channel=9, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=57, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=52, .velocity=113 },
-    { .type=1, .delay_ms=8, .channel=1, .note=52, .velocity=113 },
-    { .type=0, .delay_ms=54, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=62, .channel=0, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=40, .velocity=105 },
-    { .type=0, .delay_ms=8, .channel=1, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=105 },
-    { .type=0, .delay_ms=41, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=133, .channel=0, .note=50, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=1, .note=50, .velocity=110 },
-    { .type=0, .delay_ms=20, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=112, .channel=0, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=0, .channel=0, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=0, .channel=1, .note=50, .velocity=0 },
-    { .type=0, .delay_ms=50, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=75, .channel=0, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=125, .channel=0, .note=48, .velocity=118 },
-    { .type=0, .delay_ms=8, .channel=0, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=48, .velocity=118 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=112, .channel=0, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=106 },
-    { .type=0, .delay_ms=0, .channel=1, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=106 },
-    { .type=0, .delay_ms=37, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=125, .channel=0, .note=46, .velocity=115 },
-    { .type=0, .delay_ms=8, .channel=0, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=46, .velocity=115 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=120, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=16, .channel=0, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=125, .channel=0, .note=47, .velocity=110 },
-    { .type=1, .delay_ms=8, .channel=1, .note=47, .velocity=110 },
-    { .type=0, .delay_ms=125, .channel=0, .note=47, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=0, .note=48, .velocity=111 },
-    { .type=0, .delay_ms=0, .channel=1, .note=47, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=48, .velocity=111 },
-    { .type=0, .delay_ms=70, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=45, .channel=0, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=110 },
-    { .type=0, .delay_ms=0, .channel=1, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=116 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=41, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=49, .velocity=74 },
-    { .type=1, .delay_ms=0, .channel=9, .note=57, .velocity=68 },
-    { .type=0, .delay_ms=41, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=57, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=41, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=108 },
-    { .type=0, .delay_ms=41, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=16, .channel=9, .note=49, .velocity=23 },
-    { .type=1, .delay_ms=0, .channel=9, .note=57, .velocity=23 },
-    { .type=0, .delay_ms=45, .channel=9, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=57, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=52, .velocity=117 },
-    { .type=1, .delay_ms=8, .channel=1, .note=52, .velocity=117 },
-    { .type=0, .delay_ms=91, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=29, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=4, .channel=0, .note=52, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=52, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=79, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=125, .channel=0, .note=50, .velocity=110 },
-    { .type=1, .delay_ms=8, .channel=1, .note=50, .velocity=110 },
-    { .type=0, .delay_ms=29, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=91, .channel=0, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=40, .velocity=114 },
-    { .type=0, .delay_ms=8, .channel=1, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=114 },
-    { .type=0, .delay_ms=33, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=115 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=115 },
-    { .type=0, .delay_ms=79, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=45, .channel=0, .note=63, .velocity=112 },
-    { .type=1, .delay_ms=0, .channel=9, .note=41, .velocity=91 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=90 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=93 },
-    { .type=1, .delay_ms=8, .channel=1, .note=66, .velocity=112 },
-    { .type=0, .delay_ms=54, .channel=9, .note=41, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=0, .note=63, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=60, .velocity=105 },
-    { .type=0, .delay_ms=8, .channel=1, .note=66, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=64, .velocity=105 },
-    { .type=0, .delay_ms=54, .channel=0, .note=60, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=59, .velocity=112 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=85 },
-    { .type=1, .delay_ms=0, .channel=9, .note=41, .velocity=93 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=81 },
-    { .type=0, .delay_ms=8, .channel=1, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=63, .velocity=112 },
-    { .type=0, .delay_ms=45, .channel=9, .note=41, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=0, .note=59, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=63, .velocity=103 },
-    { .type=0, .delay_ms=4, .channel=1, .note=63, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=66, .velocity=103 },
-    { .type=0, .delay_ms=62, .channel=0, .note=63, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=66, .velocity=111 },
-    { .type=0, .delay_ms=0, .channel=1, .note=66, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=69, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=88 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=88 },
-    { .type=1, .delay_ms=0, .channel=9, .note=41, .velocity=90 },
-    { .type=0, .delay_ms=62, .channel=0, .note=66, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=64, .velocity=102 },
-    { .type=0, .delay_ms=0, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=41, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=69, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=67, .velocity=102 },
-    { .type=0, .delay_ms=0, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=62, .channel=0, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=63, .velocity=113 },
-    { .type=0, .delay_ms=0, .channel=1, .note=67, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=66, .velocity=113 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=88 },
-    { .type=1, .delay_ms=0, .channel=9, .note=41, .velocity=91 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=73 },
-    { .type=0, .delay_ms=54, .channel=9, .note=41, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=0, .note=63, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=59, .velocity=103 },
-    { .type=0, .delay_ms=0, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=66, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=63, .velocity=103 },
-    { .type=0, .delay_ms=0, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=62, .channel=0, .note=59, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=63, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=93 },
-    { .type=1, .delay_ms=0, .channel=9, .note=41, .velocity=88 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=88 },
-    { .type=0, .delay_ms=4, .channel=1, .note=63, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=66, .velocity=111 },
-    { .type=0, .delay_ms=50, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=0, .note=63, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=64, .velocity=101 },
-    { .type=0, .delay_ms=0, .channel=9, .note=41, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=66, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=67, .velocity=101 },
-    { .type=0, .delay_ms=62, .channel=0, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=66, .velocity=112 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=93 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=82 },
-    { .type=1, .delay_ms=0, .channel=9, .note=41, .velocity=87 },
-    { .type=0, .delay_ms=8, .channel=1, .note=67, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=69, .velocity=112 },
-    { .type=0, .delay_ms=54, .channel=0, .note=66, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=67, .velocity=103 },
-    { .type=0, .delay_ms=0, .channel=9, .note=41, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=69, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=71, .velocity=103 },
-    { .type=0, .delay_ms=62, .channel=0, .note=67, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=66, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=91 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=91 },
-    { .type=1, .delay_ms=0, .channel=9, .note=41, .velocity=93 },
-    { .type=0, .delay_ms=8, .channel=1, .note=71, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=69, .velocity=110 },
-    { .type=0, .delay_ms=45, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=0, .note=66, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=64, .velocity=100 },
-    { .type=0, .delay_ms=0, .channel=9, .note=41, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=69, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=67, .velocity=100 },
-    { .type=0, .delay_ms=0, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=62, .channel=0, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=63, .velocity=113 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=93 },
-    { .type=1, .delay_ms=0, .channel=9, .note=41, .velocity=93 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=90 },
-    { .type=0, .delay_ms=4, .channel=1, .note=67, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=66, .velocity=113 },
-    { .type=0, .delay_ms=58, .channel=9, .note=41, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=0, .note=63, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=59, .velocity=103 },
-    { .type=0, .delay_ms=0, .channel=1, .note=66, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=63, .velocity=103 },
-    { .type=0, .delay_ms=62, .channel=0, .note=59, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=86 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=118 },
-    { .type=0, .delay_ms=8, .channel=1, .note=63, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=72 },
-    { .type=0, .delay_ms=33, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=58, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=125, .channel=0, .note=52, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=118 },
-    { .type=1, .delay_ms=4, .channel=1, .note=52, .velocity=114 },
-    { .type=1, .delay_ms=8, .channel=9, .note=46, .velocity=85 },
-    { .type=0, .delay_ms=8, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=62, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=25, .channel=0, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=40, .velocity=110 },
-    { .type=0, .delay_ms=8, .channel=1, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=110 },
-    { .type=0, .delay_ms=33, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=86 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=116 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=110 },
-    { .type=1, .delay_ms=12, .channel=9, .note=46, .velocity=81 },
-    { .type=0, .delay_ms=54, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=37, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=9, .note=46, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=50, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=1, .note=50, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=118 },
-    { .type=0, .delay_ms=16, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=62, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=37, .channel=0, .note=50, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=40, .velocity=104 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=104 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=123 },
-    { .type=1, .delay_ms=12, .channel=9, .note=46, .velocity=81 },
-    { .type=0, .delay_ms=29, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=46, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=125, .channel=0, .note=48, .velocity=116 },
-    { .type=0, .delay_ms=0, .channel=0, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=123 },
-    { .type=1, .delay_ms=8, .channel=1, .note=48, .velocity=116 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=75 },
-    { .type=0, .delay_ms=95, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=0, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=108 },
-    { .type=0, .delay_ms=0, .channel=1, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=108 },
-    { .type=0, .delay_ms=33, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=117 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=110 },
-    { .type=1, .delay_ms=16, .channel=9, .note=46, .velocity=72 },
-    { .type=0, .delay_ms=66, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=46, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=46, .velocity=110 },
-    { .type=1, .delay_ms=8, .channel=1, .note=46, .velocity=110 },
-    { .type=0, .delay_ms=8, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=108, .channel=0, .note=46, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=110 },
-    { .type=0, .delay_ms=0, .channel=1, .note=46, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=83 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=116 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=110 },
-    { .type=1, .delay_ms=4, .channel=9, .note=46, .velocity=75 },
-    { .type=0, .delay_ms=41, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=121 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=79, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=45, .channel=0, .note=47, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=83 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=8, .channel=1, .note=47, .velocity=110 },
-    { .type=1, .delay_ms=8, .channel=9, .note=46, .velocity=78 },
-    { .type=0, .delay_ms=66, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=0, .note=47, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=48, .velocity=117 },
-    { .type=0, .delay_ms=0, .channel=1, .note=47, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=1, .note=48, .velocity=117 },
-    { .type=0, .delay_ms=83, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=48, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=8, .channel=9, .note=46, .velocity=68 },
-    { .type=0, .delay_ms=12, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=70, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=133, .channel=0, .note=52, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=121 },
-    { .type=1, .delay_ms=4, .channel=1, .note=52, .velocity=114 },
-    { .type=1, .delay_ms=8, .channel=9, .note=46, .velocity=72 },
-    { .type=0, .delay_ms=12, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=50, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=0, .note=52, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=0, .note=40, .velocity=106 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=106 },
-    { .type=0, .delay_ms=33, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=116 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=20, .channel=9, .note=46, .velocity=65 },
-    { .type=0, .delay_ms=41, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=46, .velocity=0 },
-    { .type=1, .delay_ms=16, .channel=0, .note=50, .velocity=106 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=117 },
-    { .type=1, .delay_ms=4, .channel=1, .note=50, .velocity=106 },
-    { .type=0, .delay_ms=16, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=62, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=45, .channel=0, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=83 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=0, .delay_ms=8, .channel=1, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=12, .channel=9, .note=46, .velocity=75 },
-    { .type=0, .delay_ms=20, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=40, .velocity=106 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=106 },
-    { .type=1, .delay_ms=125, .channel=0, .note=48, .velocity=117 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=75 },
-    { .type=0, .delay_ms=4, .channel=0, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=48, .velocity=117 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=75, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=48, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=41, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=75, .channel=0, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=117 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=69 },
-    { .type=0, .delay_ms=83, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=25, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=46, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=1, .note=46, .velocity=114 },
-    { .type=1, .delay_ms=124, .channel=9, .note=46, .velocity=73 },
-    { .type=1, .delay_ms=8, .channel=2, .note=40, .velocity=86 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=121 },
-    { .type=0, .delay_ms=70, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=9, .note=36, .velocity=120 },
-    { .type=0, .delay_ms=83, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=45, .channel=2, .note=40, .velocity=71 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=8, .channel=9, .note=46, .velocity=71 },
-    { .type=0, .delay_ms=75, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=129, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=9, .note=46, .velocity=75 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=77 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=108 },
-    { .type=0, .delay_ms=16, .channel=0, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=37, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=0, .note=40, .velocity=107 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=107 },
-    { .type=1, .delay_ms=125, .channel=0, .note=52, .velocity=113 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=69 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=121 },
-    { .type=1, .delay_ms=8, .channel=1, .note=52, .velocity=113 },
-    { .type=0, .delay_ms=54, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=40, .velocity=105 },
-    { .type=0, .delay_ms=4, .channel=1, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=105 },
-    { .type=0, .delay_ms=41, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=79 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=70, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=50, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=115 },
-    { .type=1, .delay_ms=8, .channel=1, .note=50, .velocity=110 },
-    { .type=0, .delay_ms=12, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=54, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=50, .channel=9, .note=46, .velocity=71 },
-    { .type=1, .delay_ms=4, .channel=0, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=0, .channel=0, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=123 },
-    { .type=0, .delay_ms=8, .channel=1, .note=50, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=133, .channel=0, .note=48, .velocity=118 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=98 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=0, .delay_ms=4, .channel=0, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=48, .velocity=118 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=65 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=83, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=0, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=0, .note=40, .velocity=106 },
-    { .type=0, .delay_ms=0, .channel=1, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=106 },
-    { .type=0, .delay_ms=33, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=75 },
-    { .type=0, .delay_ms=83, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=25, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=16, .channel=0, .note=46, .velocity=115 },
-    { .type=0, .delay_ms=4, .channel=0, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=46, .velocity=115 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=116, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=86 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=72 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=12, .channel=0, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=29, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=125, .channel=0, .note=47, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=4, .channel=1, .note=47, .velocity=110 },
-    { .type=1, .delay_ms=8, .channel=9, .note=46, .velocity=71 },
-    { .type=0, .delay_ms=75, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=0, .note=47, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=48, .velocity=111 },
-    { .type=0, .delay_ms=8, .channel=1, .note=47, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=48, .velocity=111 },
-    { .type=0, .delay_ms=70, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=50, .channel=0, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=40, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=123 },
-    { .type=0, .delay_ms=8, .channel=1, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=72 },
-    { .type=0, .delay_ms=41, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=37, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=125, .channel=9, .note=46, .velocity=73 },
-    { .type=1, .delay_ms=8, .channel=0, .note=52, .velocity=117 },
-    { .type=1, .delay_ms=0, .channel=1, .note=52, .velocity=117 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=83 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=123 },
-    { .type=0, .delay_ms=75, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=8, .channel=0, .note=52, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=52, .velocity=0 },
-    { .type=0, .delay_ms=25, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=79, .channel=9, .note=46, .velocity=71 },
-    { .type=1, .delay_ms=4, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=108 },
-    { .type=0, .delay_ms=62, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=50, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=8, .channel=1, .note=50, .velocity=110 },
-    { .type=0, .delay_ms=25, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=50, .channel=0, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=98 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=120 },
-    { .type=0, .delay_ms=4, .channel=1, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=73 },
-    { .type=0, .delay_ms=37, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=115 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=115 },
-    { .type=0, .delay_ms=70, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=50, .channel=0, .note=67, .velocity=112 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=104 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=82 },
-    { .type=1, .delay_ms=8, .channel=1, .note=71, .velocity=112 },
-    { .type=1, .delay_ms=0, .channel=9, .note=50, .velocity=91 },
-    { .type=1, .delay_ms=4, .channel=9, .note=40, .velocity=82 },
-    { .type=0, .delay_ms=20, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=9, .note=50, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=0, .note=67, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=64, .velocity=105 },
-    { .type=0, .delay_ms=4, .channel=1, .note=71, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=67, .velocity=105 },
-    { .type=0, .delay_ms=41, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=0, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=59, .velocity=112 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=92 },
-    { .type=0, .delay_ms=4, .channel=1, .note=67, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=64, .velocity=112 },
-    { .type=0, .delay_ms=37, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=25, .channel=0, .note=59, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=64, .velocity=103 },
-    { .type=0, .delay_ms=8, .channel=1, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=67, .velocity=103 },
-    { .type=0, .delay_ms=54, .channel=0, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=67, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=98 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=92 },
-    { .type=0, .delay_ms=8, .channel=1, .note=67, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=71, .velocity=111 },
-    { .type=1, .delay_ms=8, .channel=9, .note=40, .velocity=85 },
-    { .type=1, .delay_ms=4, .channel=9, .note=47, .velocity=85 },
-    { .type=0, .delay_ms=20, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=47, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=0, .note=67, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=64, .velocity=102 },
-    { .type=0, .delay_ms=8, .channel=1, .note=71, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=67, .velocity=102 },
-    { .type=0, .delay_ms=33, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=67, .velocity=113 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=93 },
-    { .type=0, .delay_ms=8, .channel=1, .note=67, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=71, .velocity=113 },
-    { .type=0, .delay_ms=41, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=67, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=71, .velocity=103 },
-    { .type=0, .delay_ms=4, .channel=1, .note=71, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=76, .velocity=103 },
-    { .type=0, .delay_ms=62, .channel=0, .note=71, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=67, .velocity=111 },
-    { .type=0, .delay_ms=0, .channel=1, .note=76, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=71, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=87 },
-    { .type=1, .delay_ms=20, .channel=9, .note=45, .velocity=93 },
-    { .type=1, .delay_ms=8, .channel=9, .note=40, .velocity=91 },
-    { .type=0, .delay_ms=12, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=67, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=64, .velocity=101 },
-    { .type=0, .delay_ms=0, .channel=9, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=71, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=67, .velocity=101 },
-    { .type=0, .delay_ms=33, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=0, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=67, .velocity=112 },
-    { .type=0, .delay_ms=0, .channel=1, .note=67, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=71, .velocity=112 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=93 },
-    { .type=0, .delay_ms=41, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=67, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=64, .velocity=103 },
-    { .type=0, .delay_ms=8, .channel=1, .note=71, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=67, .velocity=103 },
-    { .type=0, .delay_ms=62, .channel=0, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=67, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=104 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=93 },
-    { .type=0, .delay_ms=4, .channel=1, .note=67, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=71, .velocity=110 },
-    { .type=1, .delay_ms=16, .channel=9, .note=40, .velocity=90 },
-    { .type=1, .delay_ms=4, .channel=9, .note=41, .velocity=73 },
-    { .type=0, .delay_ms=16, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=0, .note=67, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=71, .velocity=100 },
-    { .type=0, .delay_ms=0, .channel=9, .note=41, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=71, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=76, .velocity=100 },
-    { .type=0, .delay_ms=37, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=25, .channel=0, .note=71, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=76, .velocity=113 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=93 },
-    { .type=0, .delay_ms=8, .channel=1, .note=76, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=79, .velocity=113 },
-    { .type=1, .delay_ms=8, .channel=9, .note=40, .velocity=91 },
-    { .type=1, .delay_ms=0, .channel=9, .note=41, .velocity=88 },
-    { .type=0, .delay_ms=25, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=0, .note=76, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=79, .velocity=103 },
-    { .type=0, .delay_ms=0, .channel=9, .note=41, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=79, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=83, .velocity=103 },
-    { .type=0, .delay_ms=62, .channel=0, .note=79, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=45, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=86 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=118 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=112 },
-    { .type=0, .delay_ms=8, .channel=1, .note=83, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=45, .velocity=108 },
-    { .type=0, .delay_ms=25, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=2, .note=33, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=45, .velocity=114 },
-    { .type=1, .delay_ms=4, .channel=1, .note=45, .velocity=114 },
-    { .type=1, .delay_ms=125, .channel=0, .note=57, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=118 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=116 },
-    { .type=1, .delay_ms=8, .channel=1, .note=57, .velocity=114 },
-    { .type=0, .delay_ms=12, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=2, .note=33, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=0, .note=57, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=45, .velocity=110 },
-    { .type=0, .delay_ms=0, .channel=1, .note=57, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=1, .note=45, .velocity=110 },
-    { .type=0, .delay_ms=33, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=45, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=86 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=116 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=116 },
-    { .type=1, .delay_ms=4, .channel=1, .note=45, .velocity=110 },
-    { .type=0, .delay_ms=62, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=25, .channel=0, .note=55, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=118 },
-    { .type=1, .delay_ms=8, .channel=1, .note=55, .velocity=111 },
-    { .type=0, .delay_ms=12, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=62, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=0, .note=55, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=55, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=45, .velocity=104 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=110 },
-    { .type=1, .delay_ms=8, .channel=1, .note=45, .velocity=104 },
-    { .type=0, .delay_ms=41, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=25, .channel=0, .note=45, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=1, .note=45, .velocity=111 },
-    { .type=1, .delay_ms=133, .channel=0, .note=53, .velocity=116 },
-    { .type=0, .delay_ms=0, .channel=0, .note=45, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=53, .velocity=116 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=117 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=75, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=2, .note=33, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=0, .note=53, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=45, .velocity=108 },
-    { .type=0, .delay_ms=0, .channel=1, .note=53, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=1, .note=45, .velocity=108 },
-    { .type=0, .delay_ms=37, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=45, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=45, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=117 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=119 },
-    { .type=1, .delay_ms=8, .channel=1, .note=45, .velocity=110 },
-    { .type=0, .delay_ms=75, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=51, .velocity=110 },
-    { .type=0, .delay_ms=8, .channel=0, .note=45, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=51, .velocity=110 },
-    { .type=0, .delay_ms=4, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=112, .channel=0, .note=51, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=45, .velocity=110 },
-    { .type=0, .delay_ms=0, .channel=1, .note=51, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=83 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=116 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=111 },
-    { .type=1, .delay_ms=4, .channel=1, .note=45, .velocity=110 },
-    { .type=0, .delay_ms=50, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=45, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=121 },
-    { .type=1, .delay_ms=8, .channel=1, .note=45, .velocity=111 },
-    { .type=0, .delay_ms=75, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=50, .channel=0, .note=52, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=83 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=111 },
-    { .type=1, .delay_ms=8, .channel=1, .note=52, .velocity=110 },
-    { .type=0, .delay_ms=75, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=25, .channel=2, .note=33, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=0, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=53, .velocity=117 },
-    { .type=0, .delay_ms=0, .channel=1, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=1, .note=53, .velocity=117 },
-    { .type=0, .delay_ms=83, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=53, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=0, .note=45, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=108 },
-    { .type=1, .delay_ms=8, .channel=1, .note=45, .velocity=111 },
-    { .type=0, .delay_ms=20, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=45, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=45, .velocity=111 },
-    { .type=1, .delay_ms=8, .channel=1, .note=45, .velocity=111 },
-    { .type=1, .delay_ms=129, .channel=0, .note=57, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=1, .note=57, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=121 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=111 },
-    { .type=0, .delay_ms=29, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=50, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=2, .note=33, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=0, .note=57, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=57, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=45, .velocity=106 },
-    { .type=1, .delay_ms=0, .channel=1, .note=45, .velocity=106 },
-    { .type=0, .delay_ms=41, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=45, .velocity=0 },
-    { .type=1, .delay_ms=91, .channel=0, .note=45, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=116 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=101 },
-    { .type=1, .delay_ms=4, .channel=1, .note=45, .velocity=108 },
-    { .type=0, .delay_ms=62, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=25, .channel=0, .note=55, .velocity=106 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=117 },
-    { .type=1, .delay_ms=8, .channel=1, .note=55, .velocity=106 },
-    { .type=0, .delay_ms=8, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=58, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=54, .channel=0, .note=55, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=45, .velocity=114 },
-    { .type=0, .delay_ms=0, .channel=1, .note=55, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=83 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=112 },
-    { .type=1, .delay_ms=8, .channel=1, .note=45, .velocity=114 },
-    { .type=0, .delay_ms=33, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=45, .velocity=106 },
-    { .type=1, .delay_ms=4, .channel=1, .note=45, .velocity=106 },
-    { .type=1, .delay_ms=125, .channel=0, .note=53, .velocity=117 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=105 },
-    { .type=0, .delay_ms=8, .channel=0, .note=45, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=53, .velocity=117 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=66, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=0, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=2, .note=33, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=53, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=45, .velocity=111 },
-    { .type=1, .delay_ms=8, .channel=1, .note=45, .velocity=111 },
-    { .type=0, .delay_ms=41, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=45, .velocity=0 },
-    { .type=1, .delay_ms=79, .channel=0, .note=45, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=117 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=108 },
-    { .type=1, .delay_ms=4, .channel=1, .note=45, .velocity=114 },
-    { .type=0, .delay_ms=79, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=51, .velocity=114 },
-    { .type=1, .delay_ms=8, .channel=1, .note=51, .velocity=114 },
-    { .type=1, .delay_ms=124, .channel=2, .note=33, .velocity=86 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=121 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=117 },
-    { .type=0, .delay_ms=75, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=9, .note=36, .velocity=120 },
-    { .type=0, .delay_ms=83, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=49, .channel=2, .note=33, .velocity=71 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=108 },
-    { .type=0, .delay_ms=75, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=2, .note=33, .velocity=0 },
-    { .type=0, .delay_ms=124, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=45, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=77 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=107 },
-    { .type=1, .delay_ms=8, .channel=1, .note=45, .velocity=108 },
-    { .type=0, .delay_ms=12, .channel=0, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=45, .velocity=107 },
-    { .type=1, .delay_ms=8, .channel=1, .note=45, .velocity=107 },
-    { .type=1, .delay_ms=125, .channel=0, .note=57, .velocity=113 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=121 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=115 },
-    { .type=1, .delay_ms=4, .channel=1, .note=57, .velocity=113 },
-    { .type=0, .delay_ms=50, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=25, .channel=2, .note=33, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=57, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=45, .velocity=105 },
-    { .type=0, .delay_ms=0, .channel=1, .note=57, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=1, .note=45, .velocity=105 },
-    { .type=0, .delay_ms=33, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=45, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=107 },
-    { .type=1, .delay_ms=8, .channel=1, .note=45, .velocity=111 },
-    { .type=0, .delay_ms=66, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=25, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=16, .channel=0, .note=55, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=115 },
-    { .type=1, .delay_ms=4, .channel=1, .note=55, .velocity=110 },
-    { .type=0, .delay_ms=16, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=58, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=45, .channel=0, .note=45, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=114 },
-    { .type=0, .delay_ms=8, .channel=0, .note=55, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=45, .velocity=111 },
-    { .type=0, .delay_ms=0, .channel=1, .note=55, .velocity=0 },
-    { .type=0, .delay_ms=50, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=37, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=45, .velocity=114 },
-    { .type=1, .delay_ms=8, .channel=1, .note=45, .velocity=114 },
-    { .type=1, .delay_ms=129, .channel=0, .note=53, .velocity=118 },
-    { .type=1, .delay_ms=0, .channel=1, .note=53, .velocity=118 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=98 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=110 },
-    { .type=0, .delay_ms=8, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=66, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=2, .note=33, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=0, .note=53, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=45, .velocity=106 },
-    { .type=0, .delay_ms=0, .channel=1, .note=53, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=45, .velocity=106 },
-    { .type=0, .delay_ms=41, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=45, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=119 },
-    { .type=1, .delay_ms=4, .channel=1, .note=45, .velocity=108 },
-    { .type=0, .delay_ms=70, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=51, .velocity=115 },
-    { .type=0, .delay_ms=8, .channel=0, .note=45, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=51, .velocity=115 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=1, .delay_ms=116, .channel=0, .note=45, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=86 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=110 },
-    { .type=1, .delay_ms=8, .channel=1, .note=45, .velocity=111 },
-    { .type=0, .delay_ms=4, .channel=0, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=29, .channel=0, .note=45, .velocity=111 },
-    { .type=1, .delay_ms=4, .channel=1, .note=45, .velocity=111 },
-    { .type=1, .delay_ms=125, .channel=0, .note=52, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=110 },
-    { .type=1, .delay_ms=8, .channel=1, .note=52, .velocity=110 },
-    { .type=0, .delay_ms=75, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=2, .note=33, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=0, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=53, .velocity=111 },
-    { .type=0, .delay_ms=8, .channel=1, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=53, .velocity=111 },
-    { .type=0, .delay_ms=66, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=50, .channel=0, .note=53, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=45, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=119 },
-    { .type=0, .delay_ms=4, .channel=1, .note=53, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=45, .velocity=110 },
-    { .type=0, .delay_ms=41, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=45, .velocity=108 },
-    { .type=1, .delay_ms=8, .channel=1, .note=45, .velocity=108 },
-    { .type=1, .delay_ms=125, .channel=0, .note=57, .velocity=117 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=83 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=115 },
-    { .type=1, .delay_ms=8, .channel=1, .note=57, .velocity=117 },
-    { .type=0, .delay_ms=75, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=45, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=1, .note=45, .velocity=111 },
-    { .type=0, .delay_ms=16, .channel=0, .note=57, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=57, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=45, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=1, .note=45, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=119 },
-    { .type=0, .delay_ms=70, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=25, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=16, .channel=0, .note=55, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=4, .channel=1, .note=55, .velocity=110 },
-    { .type=0, .delay_ms=29, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=45, .channel=0, .note=55, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=45, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=98 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=120 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=117 },
-    { .type=0, .delay_ms=8, .channel=1, .note=55, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=45, .velocity=114 },
-    { .type=0, .delay_ms=29, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=45, .velocity=115 },
-    { .type=1, .delay_ms=8, .channel=1, .note=45, .velocity=115 },
-    { .type=0, .delay_ms=66, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=1, .delay_ms=50, .channel=0, .note=69, .velocity=112 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=104 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=113 },
-    { .type=1, .delay_ms=4, .channel=1, .note=64, .velocity=112 },
-    { .type=1, .delay_ms=8, .channel=9, .note=40, .velocity=82 },
-    { .type=0, .delay_ms=20, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=0, .note=69, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=65, .velocity=105 },
-    { .type=0, .delay_ms=0, .channel=1, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=62, .velocity=105 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=88 },
-    { .type=0, .delay_ms=8, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=2, .note=33, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=0, .note=65, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=64, .velocity=112 },
-    { .type=0, .delay_ms=8, .channel=1, .note=62, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=60, .velocity=112 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=79 },
-    { .type=0, .delay_ms=20, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=0, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=69, .velocity=103 },
-    { .type=0, .delay_ms=0, .channel=1, .note=60, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=64, .velocity=103 },
-    { .type=0, .delay_ms=62, .channel=0, .note=69, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=64, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=98 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=93 },
-    { .type=0, .delay_ms=8, .channel=1, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=60, .velocity=111 },
-    { .type=0, .delay_ms=20, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=0, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=60, .velocity=102 },
-    { .type=0, .delay_ms=4, .channel=1, .note=60, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=57, .velocity=102 },
-    { .type=0, .delay_ms=37, .channel=2, .note=33, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=60, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=64, .velocity=113 },
-    { .type=0, .delay_ms=4, .channel=1, .note=57, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=60, .velocity=113 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=88 },
-    { .type=0, .delay_ms=16, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=45, .channel=0, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=69, .velocity=103 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=86 },
-    { .type=0, .delay_ms=8, .channel=1, .note=60, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=64, .velocity=103 },
-    { .type=0, .delay_ms=20, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=0, .note=69, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=72, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=92 },
-    { .type=0, .delay_ms=8, .channel=1, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=69, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=93 },
-    { .type=0, .delay_ms=29, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=0, .note=72, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=69, .velocity=101 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=87 },
-    { .type=0, .delay_ms=8, .channel=1, .note=69, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=64, .velocity=101 },
-    { .type=0, .delay_ms=25, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=2, .note=33, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=69, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=64, .velocity=112 },
-    { .type=0, .delay_ms=8, .channel=1, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=60, .velocity=112 },
-    { .type=1, .delay_ms=4, .channel=9, .note=36, .velocity=86 },
-    { .type=0, .delay_ms=20, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=37, .channel=0, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=69, .velocity=103 },
-    { .type=0, .delay_ms=4, .channel=1, .note=60, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=64, .velocity=103 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=93 },
-    { .type=0, .delay_ms=29, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=0, .note=69, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=64, .velocity=110 },
-    { .type=0, .delay_ms=0, .channel=1, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=60, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=104 },
-    { .type=1, .delay_ms=8, .channel=9, .note=40, .velocity=93 },
-    { .type=0, .delay_ms=29, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=25, .channel=0, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=69, .velocity=100 },
-    { .type=0, .delay_ms=8, .channel=1, .note=60, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=64, .velocity=100 },
-    { .type=1, .delay_ms=8, .channel=9, .note=40, .velocity=88 },
-    { .type=0, .delay_ms=25, .channel=2, .note=33, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=0, .note=69, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=64, .velocity=113 },
-    { .type=0, .delay_ms=0, .channel=1, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=60, .velocity=113 },
-    { .type=1, .delay_ms=8, .channel=9, .note=36, .velocity=93 },
-    { .type=0, .delay_ms=20, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=0, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=60, .velocity=103 },
-    { .type=0, .delay_ms=8, .channel=1, .note=60, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=57, .velocity=103 },
-    { .type=0, .delay_ms=62, .channel=0, .note=60, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=86 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=118 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=72 },
-    { .type=0, .delay_ms=4, .channel=1, .note=57, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=108 },
-    { .type=0, .delay_ms=29, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=54, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=25, .channel=0, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=125, .channel=0, .note=52, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=118 },
-    { .type=1, .delay_ms=8, .channel=1, .note=52, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=85 },
-    { .type=0, .delay_ms=12, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=70, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=110 },
-    { .type=0, .delay_ms=0, .channel=1, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=110 },
-    { .type=0, .delay_ms=37, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=86 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=116 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=110 },
-    { .type=1, .delay_ms=8, .channel=9, .note=46, .velocity=81 },
-    { .type=0, .delay_ms=54, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=46, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=50, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=118 },
-    { .type=1, .delay_ms=8, .channel=1, .note=50, .velocity=111 },
-    { .type=0, .delay_ms=12, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=70, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=25, .channel=0, .note=50, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=104 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=123 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=104 },
-    { .type=1, .delay_ms=16, .channel=9, .note=46, .velocity=81 },
-    { .type=0, .delay_ms=25, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=37, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=25, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=46, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=125, .channel=0, .note=48, .velocity=116 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=123 },
-    { .type=0, .delay_ms=8, .channel=0, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=48, .velocity=116 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=9, .note=46, .velocity=75 },
-    { .type=0, .delay_ms=91, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=0, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=0, .note=40, .velocity=108 },
-    { .type=0, .delay_ms=0, .channel=1, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=108 },
-    { .type=0, .delay_ms=41, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=117 },
-    { .type=1, .delay_ms=12, .channel=9, .note=46, .velocity=72 },
-    { .type=0, .delay_ms=70, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=46, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=46, .velocity=110 },
-    { .type=0, .delay_ms=4, .channel=0, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=46, .velocity=110 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=112, .channel=0, .note=46, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=0, .note=40, .velocity=110 },
-    { .type=0, .delay_ms=0, .channel=1, .note=46, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=83 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=116 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=75 },
-    { .type=0, .delay_ms=50, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=121 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=66, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=58, .channel=0, .note=47, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=83 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=4, .channel=1, .note=47, .velocity=110 },
-    { .type=1, .delay_ms=8, .channel=9, .note=46, .velocity=78 },
-    { .type=0, .delay_ms=70, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=0, .note=47, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=0, .note=48, .velocity=117 },
-    { .type=0, .delay_ms=0, .channel=1, .note=47, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=1, .note=48, .velocity=117 },
-    { .type=0, .delay_ms=83, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=48, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=68 },
-    { .type=0, .delay_ms=20, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=70, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=125, .channel=0, .note=52, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=121 },
-    { .type=1, .delay_ms=8, .channel=1, .note=52, .velocity=114 },
-    { .type=1, .delay_ms=8, .channel=9, .note=46, .velocity=72 },
-    { .type=0, .delay_ms=12, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=54, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=0, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=106 },
-    { .type=0, .delay_ms=0, .channel=1, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=106 },
-    { .type=0, .delay_ms=33, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=87, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=116 },
-    { .type=1, .delay_ms=29, .channel=9, .note=46, .velocity=65 },
-    { .type=0, .delay_ms=41, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=9, .note=46, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=50, .velocity=106 },
-    { .type=1, .delay_ms=0, .channel=1, .note=50, .velocity=106 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=117 },
-    { .type=0, .delay_ms=12, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=54, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=50, .channel=0, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=114 },
-    { .type=0, .delay_ms=0, .channel=1, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=83 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=16, .channel=9, .note=46, .velocity=75 },
-    { .type=0, .delay_ms=20, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=37, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=106 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=106 },
-    { .type=1, .delay_ms=125, .channel=0, .note=48, .velocity=117 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=75 },
-    { .type=0, .delay_ms=8, .channel=0, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=48, .velocity=117 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=79, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=0, .note=48, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=16, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=41, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=75, .channel=0, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=117 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=69 },
-    { .type=0, .delay_ms=83, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=46, .velocity=114 },
-    { .type=1, .delay_ms=8, .channel=1, .note=46, .velocity=114 },
-    { .type=1, .delay_ms=124, .channel=2, .note=40, .velocity=86 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=73 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=121 },
-    { .type=0, .delay_ms=66, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=9, .note=36, .velocity=120 },
-    { .type=0, .delay_ms=91, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=41, .channel=2, .note=40, .velocity=71 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=12, .channel=9, .note=46, .velocity=71 },
-    { .type=0, .delay_ms=70, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=133, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=9, .note=46, .velocity=75 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=77 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=0, .delay_ms=20, .channel=0, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=107 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=107 },
-    { .type=1, .delay_ms=120, .channel=9, .note=46, .velocity=69 },
-    { .type=1, .delay_ms=4, .channel=0, .note=52, .velocity=113 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=121 },
-    { .type=1, .delay_ms=8, .channel=1, .note=52, .velocity=113 },
-    { .type=0, .delay_ms=50, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=105 },
-    { .type=0, .delay_ms=0, .channel=1, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=105 },
-    { .type=0, .delay_ms=33, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=79 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=70, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=50, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=115 },
-    { .type=1, .delay_ms=8, .channel=1, .note=50, .velocity=110 },
-    { .type=0, .delay_ms=12, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=54, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=50, .channel=0, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=0, .channel=0, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=71 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=123 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=0, .channel=1, .note=50, .velocity=0 },
-    { .type=0, .delay_ms=45, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=125, .channel=0, .note=48, .velocity=118 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=98 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=8, .channel=1, .note=48, .velocity=118 },
-    { .type=0, .delay_ms=8, .channel=0, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=65 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=79, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=0, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=40, .velocity=106 },
-    { .type=0, .delay_ms=8, .channel=1, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=106 },
-    { .type=0, .delay_ms=41, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=8, .channel=9, .note=46, .velocity=75 },
-    { .type=0, .delay_ms=83, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=46, .velocity=115 },
-    { .type=1, .delay_ms=0, .channel=1, .note=46, .velocity=115 },
-    { .type=0, .delay_ms=8, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=125, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=86 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=72 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=8, .channel=0, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=37, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=25, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=125, .channel=0, .note=47, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=8, .channel=1, .note=47, .velocity=110 },
-    { .type=1, .delay_ms=4, .channel=9, .note=46, .velocity=71 },
-    { .type=0, .delay_ms=79, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=0, .note=47, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=48, .velocity=111 },
-    { .type=0, .delay_ms=4, .channel=1, .note=47, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=48, .velocity=111 },
-    { .type=0, .delay_ms=70, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=45, .channel=0, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=40, .velocity=110 },
-    { .type=0, .delay_ms=0, .channel=1, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=123 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=72 },
-    { .type=0, .delay_ms=41, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=116, .channel=9, .note=46, .velocity=73 },
-    { .type=1, .delay_ms=8, .channel=0, .note=52, .velocity=117 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=83 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=123 },
-    { .type=1, .delay_ms=4, .channel=1, .note=52, .velocity=117 },
-    { .type=0, .delay_ms=70, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=12, .channel=0, .note=52, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=52, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=75, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=71 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=108 },
-    { .type=0, .delay_ms=66, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=50, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=1, .note=50, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=0, .delay_ms=37, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=45, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=50, .channel=0, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=40, .velocity=114 },
-    { .type=0, .delay_ms=0, .channel=1, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=98 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=120 },
-    { .type=1, .delay_ms=8, .channel=9, .note=46, .velocity=73 },
-    { .type=0, .delay_ms=25, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=115 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=115 },
-    { .type=0, .delay_ms=125, .channel=0, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=48, .velocity=117 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=104 },
-    { .type=1, .delay_ms=0, .channel=9, .note=38, .velocity=85 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=92 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=48, .velocity=117 },
-    { .type=0, .delay_ms=8, .channel=9, .note=38, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=100, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=86 },
-    { .type=1, .delay_ms=12, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=0, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=0, .note=48, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=45, .channel=9, .note=38, .velocity=82 },
-    { .type=1, .delay_ms=8, .channel=9, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=98 },
-    { .type=0, .delay_ms=0, .channel=9, .note=38, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=114 },
-    { .type=0, .delay_ms=0, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=100, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=9, .note=36, .velocity=91 },
-    { .type=1, .delay_ms=4, .channel=0, .note=46, .velocity=114 },
-    { .type=1, .delay_ms=8, .channel=1, .note=46, .velocity=114 },
-    { .type=0, .delay_ms=8, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=116, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=38, .velocity=79 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=88 },
-    { .type=0, .delay_ms=12, .channel=9, .note=38, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=33, .channel=9, .note=38, .velocity=79 },
-    { .type=1, .delay_ms=8, .channel=9, .note=40, .velocity=90 },
-    { .type=0, .delay_ms=8, .channel=9, .note=38, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=9, .note=36, .velocity=93 },
-    { .type=0, .delay_ms=20, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=104, .channel=9, .note=38, .velocity=87 },
-    { .type=1, .delay_ms=4, .channel=2, .note=40, .velocity=104 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=93 },
-    { .type=0, .delay_ms=8, .channel=9, .note=38, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=95, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=9, .note=36, .velocity=93 },
-    { .type=0, .delay_ms=16, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=108, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=0, .note=46, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=49, .velocity=108 },
-    { .type=0, .delay_ms=0, .channel=1, .note=46, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=49, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=37, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=118 },
-    { .type=1, .delay_ms=0, .channel=9, .note=57, .velocity=79 },
-    { .type=0, .delay_ms=37, .channel=0, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=9, .note=57, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=29, .channel=0, .note=49, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=1, .note=49, .velocity=114 },
-    { .type=0, .delay_ms=0, .channel=2, .note=37, .velocity=0 },
-    { .type=1, .delay_ms=125, .channel=9, .note=53, .velocity=123 },
-    { .type=1, .delay_ms=8, .channel=0, .note=61, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=37, .velocity=98 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=118 },
-    { .type=1, .delay_ms=4, .channel=1, .note=61, .velocity=114 },
-    { .type=0, .delay_ms=8, .channel=0, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=62, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=37, .channel=0, .note=61, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=0, .note=49, .velocity=110 },
-    { .type=0, .delay_ms=0, .channel=1, .note=61, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=1, .note=49, .velocity=110 },
-    { .type=0, .delay_ms=29, .channel=2, .note=37, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=0, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=49, .velocity=0 },
-    { .type=1, .delay_ms=75, .channel=9, .note=53, .velocity=125 },
-    { .type=1, .delay_ms=8, .channel=0, .note=49, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=37, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=116 },
-    { .type=1, .delay_ms=8, .channel=1, .note=49, .velocity=110 },
-    { .type=0, .delay_ms=12, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=50, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=62, .channel=0, .note=59, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=118 },
-    { .type=1, .delay_ms=4, .channel=1, .note=59, .velocity=111 },
-    { .type=0, .delay_ms=8, .channel=0, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=2, .note=37, .velocity=0 },
-    { .type=0, .delay_ms=54, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=0, .note=59, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=59, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=9, .note=53, .velocity=122 },
-    { .type=1, .delay_ms=4, .channel=0, .note=49, .velocity=104 },
-    { .type=1, .delay_ms=0, .channel=2, .note=37, .velocity=104 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=123 },
-    { .type=1, .delay_ms=8, .channel=1, .note=49, .velocity=104 },
-    { .type=0, .delay_ms=12, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=9, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=50, .channel=0, .note=49, .velocity=111 },
-    { .type=1, .delay_ms=8, .channel=1, .note=49, .velocity=111 },
-    { .type=0, .delay_ms=12, .channel=2, .note=37, .velocity=0 },
-    { .type=1, .delay_ms=112, .channel=0, .note=57, .velocity=116 },
-    { .type=1, .delay_ms=0, .channel=2, .note=37, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=9, .note=53, .velocity=124 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=123 },
-    { .type=0, .delay_ms=4, .channel=0, .note=49, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=57, .velocity=116 },
-    { .type=0, .delay_ms=0, .channel=1, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=79, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=25, .channel=0, .note=57, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=49, .velocity=108 },
-    { .type=0, .delay_ms=0, .channel=1, .note=57, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=1, .note=49, .velocity=108 },
-    { .type=0, .delay_ms=12, .channel=2, .note=37, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=0, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=49, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=49, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=37, .velocity=104 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=117 },
-    { .type=1, .delay_ms=8, .channel=1, .note=49, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=9, .note=53, .velocity=114 },
-    { .type=0, .delay_ms=25, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=58, .channel=9, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=45, .channel=0, .note=55, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=1, .note=55, .velocity=110 },
-    { .type=0, .delay_ms=8, .channel=0, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=2, .note=37, .velocity=0 },
-    { .type=0, .delay_ms=95, .channel=0, .note=55, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=49, .velocity=110 },
-    { .type=0, .delay_ms=0, .channel=1, .note=55, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=49, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=37, .velocity=104 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=116 },
-    { .type=1, .delay_ms=0, .channel=9, .note=53, .velocity=120 },
-    { .type=0, .delay_ms=29, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=25, .channel=0, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=62, .channel=0, .note=49, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=121 },
-    { .type=1, .delay_ms=4, .channel=1, .note=49, .velocity=111 },
-    { .type=0, .delay_ms=29, .channel=2, .note=37, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=50, .channel=9, .note=53, .velocity=124 },
-    { .type=1, .delay_ms=4, .channel=0, .note=56, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=37, .velocity=98 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=8, .channel=1, .note=56, .velocity=110 },
-    { .type=0, .delay_ms=12, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=62, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=0, .note=56, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=57, .velocity=117 },
-    { .type=0, .delay_ms=0, .channel=1, .note=56, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=1, .note=57, .velocity=117 },
-    { .type=0, .delay_ms=20, .channel=2, .note=37, .velocity=0 },
-    { .type=0, .delay_ms=62, .channel=0, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=57, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=57, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=47, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=35, .velocity=77 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=49, .velocity=79 },
-    { .type=1, .delay_ms=4, .channel=1, .note=47, .velocity=111 },
-    { .type=0, .delay_ms=20, .channel=0, .note=47, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=47, .velocity=0 },
-    { .type=0, .delay_ms=62, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=49, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=47, .velocity=111 },
-    { .type=1, .delay_ms=8, .channel=1, .note=47, .velocity=111 },
-    { .type=0, .delay_ms=33, .channel=2, .note=35, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=9, .note=53, .velocity=124 },
-    { .type=1, .delay_ms=8, .channel=0, .note=59, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=35, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=121 },
-    { .type=1, .delay_ms=8, .channel=1, .note=59, .velocity=114 },
-    { .type=0, .delay_ms=20, .channel=0, .note=47, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=47, .velocity=0 },
-    { .type=0, .delay_ms=58, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=0, .note=59, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=59, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=47, .velocity=106 },
-    { .type=1, .delay_ms=4, .channel=1, .note=47, .velocity=106 },
-    { .type=0, .delay_ms=29, .channel=2, .note=35, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=0, .note=47, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=47, .velocity=0 },
-    { .type=1, .delay_ms=79, .channel=9, .note=53, .velocity=119 },
-    { .type=1, .delay_ms=4, .channel=0, .note=47, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=35, .velocity=104 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=116 },
-    { .type=1, .delay_ms=8, .channel=1, .note=47, .velocity=108 },
-    { .type=0, .delay_ms=20, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=62, .channel=0, .note=57, .velocity=106 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=117 },
-    { .type=1, .delay_ms=8, .channel=1, .note=57, .velocity=106 },
-    { .type=0, .delay_ms=12, .channel=0, .note=47, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=47, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=2, .note=35, .velocity=0 },
-    { .type=0, .delay_ms=54, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=41, .channel=9, .note=53, .velocity=124 },
-    { .type=0, .delay_ms=8, .channel=0, .note=57, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=0, .note=47, .velocity=114 },
-    { .type=0, .delay_ms=0, .channel=1, .note=57, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=47, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=35, .velocity=86 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=0, .delay_ms=16, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=25, .channel=0, .note=47, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=47, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=9, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=50, .channel=0, .note=47, .velocity=106 },
-    { .type=1, .delay_ms=0, .channel=1, .note=47, .velocity=106 },
-    { .type=0, .delay_ms=12, .channel=2, .note=35, .velocity=0 },
-    { .type=1, .delay_ms=112, .channel=9, .note=53, .velocity=125 },
-    { .type=1, .delay_ms=8, .channel=0, .note=55, .velocity=117 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=98 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=123 },
-    { .type=0, .delay_ms=4, .channel=0, .note=47, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=55, .velocity=117 },
-    { .type=0, .delay_ms=8, .channel=1, .note=47, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=79, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=0, .note=55, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=55, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=46, .velocity=111 },
-    { .type=1, .delay_ms=8, .channel=1, .note=46, .velocity=111 },
-    { .type=0, .delay_ms=20, .channel=2, .note=33, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=1, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=0, .note=46, .velocity=0 },
-    { .type=1, .delay_ms=70, .channel=0, .note=45, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=98 },
-    { .type=1, .delay_ms=0, .channel=9, .note=53, .velocity=125 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=117 },
-    { .type=1, .delay_ms=8, .channel=1, .note=45, .velocity=114 },
-    { .type=0, .delay_ms=20, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=54, .channel=9, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=50, .channel=0, .note=53, .velocity=114 },
-    { .type=1, .delay_ms=4, .channel=1, .note=53, .velocity=114 },
-    { .type=0, .delay_ms=20, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=104, .channel=2, .note=33, .velocity=86 },
-    { .type=1, .delay_ms=0, .channel=9, .note=53, .velocity=125 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=121 },
-    { .type=0, .delay_ms=29, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=62, .channel=9, .note=36, .velocity=120 },
-    { .type=0, .delay_ms=29, .channel=2, .note=33, .velocity=0 },
-    { .type=0, .delay_ms=62, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=41, .channel=2, .note=33, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=53, .velocity=125 },
-    { .type=0, .delay_ms=33, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=50, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=83, .channel=2, .note=33, .velocity=0 },
-    { .type=0, .delay_ms=83, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=45, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=80 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=57, .velocity=79 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=108 },
-    { .type=0, .delay_ms=12, .channel=0, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=37, .channel=9, .note=57, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=25, .channel=0, .note=40, .velocity=107 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=107 },
-    { .type=0, .delay_ms=20, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=104, .channel=9, .note=53, .velocity=125 },
-    { .type=1, .delay_ms=8, .channel=0, .note=52, .velocity=113 },
-    { .type=1, .delay_ms=0, .channel=1, .note=52, .velocity=113 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=83 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=121 },
-    { .type=0, .delay_ms=20, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=0, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=105 },
-    { .type=0, .delay_ms=0, .channel=1, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=105 },
-    { .type=0, .delay_ms=37, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=83 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=53, .velocity=125 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=29, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=62, .channel=0, .note=50, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=115 },
-    { .type=1, .delay_ms=8, .channel=1, .note=50, .velocity=110 },
-    { .type=0, .delay_ms=12, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=54, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=33, .channel=9, .note=53, .velocity=124 },
-    { .type=1, .delay_ms=16, .channel=0, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=0, .channel=0, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=83 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=123 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=0, .channel=1, .note=50, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=54, .channel=0, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=114 },
-    { .type=0, .delay_ms=33, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=9, .note=53, .velocity=124 },
-    { .type=1, .delay_ms=8, .channel=0, .note=48, .velocity=118 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=77 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=8, .channel=1, .note=48, .velocity=118 },
-    { .type=0, .delay_ms=4, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=66, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=37, .channel=0, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=40, .velocity=106 },
-    { .type=0, .delay_ms=4, .channel=1, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=106 },
-    { .type=0, .delay_ms=29, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=79, .channel=9, .note=53, .velocity=125 },
-    { .type=1, .delay_ms=4, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=74 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=108 },
-    { .type=0, .delay_ms=20, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=62, .channel=9, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=41, .channel=0, .note=46, .velocity=115 },
-    { .type=0, .delay_ms=8, .channel=0, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=46, .velocity=115 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=104, .channel=9, .note=53, .velocity=125 },
-    { .type=1, .delay_ms=4, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=0, .delay_ms=16, .channel=0, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=50, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=33, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=33, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=100, .channel=0, .note=47, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=83 },
-    { .type=1, .delay_ms=0, .channel=9, .note=53, .velocity=119 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=4, .channel=1, .note=47, .velocity=110 },
-    { .type=0, .delay_ms=16, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=66, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=0, .note=47, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=48, .velocity=111 },
-    { .type=0, .delay_ms=0, .channel=1, .note=47, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=1, .note=48, .velocity=111 },
-    { .type=0, .delay_ms=29, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=45, .channel=0, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=110 },
-    { .type=0, .delay_ms=0, .channel=1, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=86 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=53, .velocity=124 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=110 },
-    { .type=0, .delay_ms=20, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=45, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=37, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=108 },
-    { .type=0, .delay_ms=16, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=108, .channel=0, .note=52, .velocity=117 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=98 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=123 },
-    { .type=1, .delay_ms=8, .channel=1, .note=52, .velocity=117 },
-    { .type=1, .delay_ms=0, .channel=9, .note=53, .velocity=125 },
-    { .type=0, .delay_ms=29, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=62, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=29, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=12, .channel=0, .note=52, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=52, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=79, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=9, .note=53, .velocity=124 },
-    { .type=0, .delay_ms=29, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=54, .channel=0, .note=50, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=8, .channel=1, .note=50, .velocity=110 },
-    { .type=0, .delay_ms=29, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=50, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=0, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=104 },
-    { .type=1, .delay_ms=0, .channel=9, .note=53, .velocity=125 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=120 },
-    { .type=0, .delay_ms=8, .channel=1, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=114 },
-    { .type=0, .delay_ms=20, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=9, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=54, .channel=0, .note=40, .velocity=115 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=115 },
-    { .type=0, .delay_ms=58, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=75, .channel=0, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=67, .velocity=112 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=64, .velocity=112 },
-    { .type=1, .delay_ms=0, .channel=2, .note=28, .velocity=104 },
-    { .type=1, .delay_ms=0, .channel=9, .note=38, .velocity=116 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=99 },
-    { .type=1, .delay_ms=0, .channel=9, .note=53, .velocity=125 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=0, .delay_ms=20, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=38, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=0, .note=67, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=71, .velocity=105 },
-    { .type=0, .delay_ms=8, .channel=1, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=67, .velocity=105 },
-    { .type=0, .delay_ms=62, .channel=0, .note=71, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=64, .velocity=112 },
-    { .type=0, .delay_ms=0, .channel=2, .note=28, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=67, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=59, .velocity=112 },
-    { .type=0, .delay_ms=58, .channel=0, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=59, .velocity=103 },
-    { .type=0, .delay_ms=4, .channel=1, .note=59, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=55, .velocity=103 },
-    { .type=0, .delay_ms=62, .channel=0, .note=59, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=67, .velocity=111 },
-    { .type=0, .delay_ms=8, .channel=1, .note=55, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=64, .velocity=111 },
-    { .type=0, .delay_ms=54, .channel=0, .note=67, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=64, .velocity=102 },
-    { .type=0, .delay_ms=8, .channel=1, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=59, .velocity=102 },
-    { .type=0, .delay_ms=62, .channel=0, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=71, .velocity=113 },
-    { .type=0, .delay_ms=8, .channel=1, .note=59, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=67, .velocity=113 },
-    { .type=0, .delay_ms=54, .channel=0, .note=71, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=67, .velocity=103 },
-    { .type=0, .delay_ms=8, .channel=1, .note=67, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=64, .velocity=103 },
-    { .type=0, .delay_ms=62, .channel=0, .note=67, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=71, .velocity=111 },
-    { .type=0, .delay_ms=4, .channel=1, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=67, .velocity=111 },
-    { .type=0, .delay_ms=62, .channel=0, .note=71, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=67, .velocity=101 },
-    { .type=0, .delay_ms=0, .channel=1, .note=67, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=64, .velocity=101 },
-    { .type=0, .delay_ms=62, .channel=0, .note=67, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=64, .velocity=112 },
-    { .type=0, .delay_ms=8, .channel=1, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=59, .velocity=112 },
-    { .type=0, .delay_ms=62, .channel=0, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=59, .velocity=103 },
-    { .type=0, .delay_ms=0, .channel=1, .note=59, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=55, .velocity=103 },
-    { .type=0, .delay_ms=62, .channel=0, .note=59, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=67, .velocity=110 },
-    { .type=0, .delay_ms=8, .channel=1, .note=55, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=64, .velocity=110 },
-    { .type=0, .delay_ms=62, .channel=0, .note=67, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=71, .velocity=100 },
-    { .type=0, .delay_ms=4, .channel=1, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=67, .velocity=100 },
-    { .type=0, .delay_ms=58, .channel=0, .note=71, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=76, .velocity=113 },
-    { .type=0, .delay_ms=4, .channel=1, .note=67, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=71, .velocity=113 },
-    { .type=0, .delay_ms=62, .channel=0, .note=76, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=79, .velocity=103 },
-    { .type=0, .delay_ms=8, .channel=1, .note=71, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=76, .velocity=103 },
-    { .type=0, .delay_ms=54, .channel=0, .note=79, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=41, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=57, .velocity=61 },
-    { .type=1, .delay_ms=0, .channel=9, .note=49, .velocity=71 },
-    { .type=0, .delay_ms=8, .channel=1, .note=76, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=108 },
-    { .type=0, .delay_ms=33, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=57, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=41, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=62, .channel=9, .note=57, .velocity=23 },
-    { .type=1, .delay_ms=0, .channel=9, .note=49, .velocity=23 },
-    { .type=0, .delay_ms=41, .channel=9, .note=57, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=49, .velocity=0 },
-    { .type=1, .delay_ms=25, .channel=0, .note=52, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=1, .note=52, .velocity=114 },
-    { .type=0, .delay_ms=16, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=104, .channel=0, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=110 },
-    { .type=0, .delay_ms=0, .channel=1, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=110 },
-    { .type=0, .delay_ms=41, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=91, .channel=0, .note=40, .velocity=110 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=110 },
-    { .type=1, .delay_ms=125, .channel=0, .note=50, .velocity=111 },
-    { .type=1, .delay_ms=8, .channel=1, .note=50, .velocity=111 },
-    { .type=0, .delay_ms=8, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=100, .channel=0, .note=50, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=104 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=104 },
-    { .type=0, .delay_ms=33, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=125, .channel=0, .note=48, .velocity=116 },
-    { .type=0, .delay_ms=0, .channel=0, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=1, .note=48, .velocity=116 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=116, .channel=0, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=108 },
-    { .type=0, .delay_ms=0, .channel=1, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=108 },
-    { .type=0, .delay_ms=33, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=110 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=110 },
-    { .type=1, .delay_ms=125, .channel=0, .note=46, .velocity=110 },
-    { .type=1, .delay_ms=8, .channel=1, .note=46, .velocity=110 },
-    { .type=0, .delay_ms=8, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=112, .channel=0, .note=46, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=40, .velocity=110 },
-    { .type=0, .delay_ms=0, .channel=1, .note=46, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=110 },
-    { .type=0, .delay_ms=45, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=75, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=133, .channel=0, .note=47, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=1, .note=47, .velocity=110 },
-    { .type=0, .delay_ms=125, .channel=0, .note=47, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=48, .velocity=117 },
-    { .type=0, .delay_ms=0, .channel=1, .note=47, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=1, .note=48, .velocity=117 },
-    { .type=0, .delay_ms=83, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=0, .note=48, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=125 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=41, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=57, .velocity=64 },
-    { .type=1, .delay_ms=0, .channel=9, .note=49, .velocity=70 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=20, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=62, .channel=9, .note=57, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=41, .velocity=0 },
-    { .type=1, .delay_ms=33, .channel=0, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=0, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=54, .channel=9, .note=57, .velocity=23 },
-    { .type=1, .delay_ms=0, .channel=9, .note=49, .velocity=23 },
-    { .type=0, .delay_ms=50, .channel=9, .note=57, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=49, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=52, .velocity=114 },
-    { .type=1, .delay_ms=4, .channel=1, .note=52, .velocity=114 },
-    { .type=0, .delay_ms=20, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=83, .channel=0, .note=52, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=0, .note=40, .velocity=106 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=106 },
-    { .type=0, .delay_ms=33, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=125, .channel=0, .note=50, .velocity=106 },
-    { .type=1, .delay_ms=4, .channel=1, .note=50, .velocity=106 },
-    { .type=0, .delay_ms=16, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=104, .channel=0, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=40, .velocity=114 },
-    { .type=0, .delay_ms=8, .channel=1, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=114 },
-    { .type=0, .delay_ms=41, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=106 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=106 },
-    { .type=1, .delay_ms=129, .channel=0, .note=48, .velocity=117 },
-    { .type=1, .delay_ms=0, .channel=1, .note=48, .velocity=117 },
-    { .type=0, .delay_ms=8, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=95, .channel=0, .note=48, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=50, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=125, .channel=0, .note=46, .velocity=114 },
-    { .type=1, .delay_ms=8, .channel=1, .note=46, .velocity=114 },
-    { .type=0, .delay_ms=637, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=125 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=121 },
-    { .type=1, .delay_ms=0, .channel=9, .note=41, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=49, .velocity=74 },
-    { .type=1, .delay_ms=0, .channel=9, .note=57, .velocity=56 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=108 },
-    { .type=0, .delay_ms=16, .channel=0, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=57, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=9, .note=41, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=40, .velocity=107 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=107 },
-    { .type=0, .delay_ms=8, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=54, .channel=9, .note=49, .velocity=23 },
-    { .type=1, .delay_ms=0, .channel=9, .note=57, .velocity=23 },
-    { .type=0, .delay_ms=41, .channel=9, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=57, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=52, .velocity=113 },
-    { .type=1, .delay_ms=8, .channel=1, .note=52, .velocity=113 },
-    { .type=0, .delay_ms=54, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=62, .channel=0, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=0, .note=40, .velocity=105 },
-    { .type=0, .delay_ms=0, .channel=1, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=105 },
-    { .type=0, .delay_ms=41, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=133, .channel=0, .note=50, .velocity=110 },
-    { .type=1, .delay_ms=4, .channel=1, .note=50, .velocity=110 },
-    { .type=0, .delay_ms=16, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=104, .channel=0, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=0, .channel=0, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=0, .channel=1, .note=50, .velocity=0 },
-    { .type=0, .delay_ms=50, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=75, .channel=0, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=125, .channel=0, .note=48, .velocity=118 },
-    { .type=0, .delay_ms=4, .channel=0, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=48, .velocity=118 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=116, .channel=0, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=40, .velocity=106 },
-    { .type=0, .delay_ms=0, .channel=1, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=106 },
-    { .type=0, .delay_ms=33, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=125, .channel=0, .note=46, .velocity=115 },
-    { .type=0, .delay_ms=4, .channel=0, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=46, .velocity=115 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=116, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=12, .channel=0, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=129, .channel=0, .note=47, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=1, .note=47, .velocity=110 },
-    { .type=0, .delay_ms=125, .channel=0, .note=47, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=48, .velocity=111 },
-    { .type=0, .delay_ms=0, .channel=1, .note=47, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=48, .velocity=111 },
-    { .type=0, .delay_ms=70, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=50, .channel=0, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=110 },
-    { .type=0, .delay_ms=0, .channel=1, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=116 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=41, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=49, .velocity=74 },
-    { .type=1, .delay_ms=0, .channel=9, .note=57, .velocity=68 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=110 },
-    { .type=0, .delay_ms=37, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=9, .note=57, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=9, .note=41, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=9, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=108 },
-    { .type=0, .delay_ms=41, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=9, .note=49, .velocity=23 },
-    { .type=1, .delay_ms=0, .channel=9, .note=57, .velocity=23 },
-    { .type=0, .delay_ms=50, .channel=9, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=57, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=52, .velocity=117 },
-    { .type=1, .delay_ms=8, .channel=1, .note=52, .velocity=117 },
-    { .type=0, .delay_ms=87, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=29, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=8, .channel=0, .note=52, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=52, .velocity=0 },
-    { .type=0, .delay_ms=25, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=75, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=125, .channel=0, .note=50, .velocity=110 },
-    { .type=1, .delay_ms=8, .channel=1, .note=50, .velocity=110 },
-    { .type=0, .delay_ms=25, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=91, .channel=0, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=40, .velocity=114 },
-    { .type=0, .delay_ms=4, .channel=1, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=114 },
-    { .type=0, .delay_ms=37, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=115 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=115 },
-    { .type=0, .delay_ms=75, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=41, .channel=0, .note=66, .velocity=112 },
-    { .type=1, .delay_ms=0, .channel=9, .note=41, .velocity=91 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=90 },
-    { .type=1, .delay_ms=8, .channel=1, .note=63, .velocity=112 },
-    { .type=0, .delay_ms=54, .channel=9, .note=41, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=0, .note=66, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=64, .velocity=105 },
-    { .type=0, .delay_ms=4, .channel=1, .note=63, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=60, .velocity=105 },
-    { .type=0, .delay_ms=62, .channel=0, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=63, .velocity=112 },
-    { .type=0, .delay_ms=0, .channel=1, .note=60, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=59, .velocity=112 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=93 },
-    { .type=0, .delay_ms=62, .channel=0, .note=63, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=59, .velocity=103 },
-    { .type=0, .delay_ms=0, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=59, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=54, .velocity=103 },
-    { .type=0, .delay_ms=62, .channel=0, .note=59, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=69, .velocity=111 },
-    { .type=0, .delay_ms=0, .channel=1, .note=54, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=66, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=88 },
-    { .type=1, .delay_ms=0, .channel=9, .note=41, .velocity=90 },
-    { .type=0, .delay_ms=62, .channel=0, .note=69, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=66, .velocity=102 },
-    { .type=0, .delay_ms=0, .channel=9, .note=41, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=66, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=63, .velocity=102 },
-    { .type=0, .delay_ms=0, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=62, .channel=0, .note=66, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=63, .velocity=113 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=88 },
-    { .type=0, .delay_ms=4, .channel=1, .note=63, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=59, .velocity=113 },
-    { .type=0, .delay_ms=58, .channel=0, .note=63, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=59, .velocity=103 },
-    { .type=0, .delay_ms=0, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=59, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=57, .velocity=103 },
-    { .type=0, .delay_ms=62, .channel=0, .note=59, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=71, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=93 },
-    { .type=1, .delay_ms=0, .channel=9, .note=41, .velocity=88 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=88 },
-    { .type=0, .delay_ms=8, .channel=1, .note=57, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=69, .velocity=111 },
-    { .type=0, .delay_ms=50, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=0, .note=71, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=69, .velocity=101 },
-    { .type=0, .delay_ms=0, .channel=9, .note=41, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=69, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=66, .velocity=101 },
-    { .type=0, .delay_ms=62, .channel=0, .note=69, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=66, .velocity=112 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=93 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=82 },
-    { .type=1, .delay_ms=0, .channel=9, .note=41, .velocity=87 },
-    { .type=0, .delay_ms=8, .channel=1, .note=66, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=63, .velocity=112 },
-    { .type=0, .delay_ms=54, .channel=0, .note=66, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=63, .velocity=103 },
-    { .type=0, .delay_ms=0, .channel=9, .note=41, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=63, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=59, .velocity=103 },
-    { .type=0, .delay_ms=62, .channel=0, .note=63, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=75, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=91 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=91 },
-    { .type=1, .delay_ms=0, .channel=9, .note=41, .velocity=93 },
-    { .type=0, .delay_ms=4, .channel=1, .note=59, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=71, .velocity=110 },
-    { .type=0, .delay_ms=50, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=41, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=0, .note=75, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=73, .velocity=100 },
-    { .type=0, .delay_ms=0, .channel=1, .note=71, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=69, .velocity=100 },
-    { .type=0, .delay_ms=0, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=62, .channel=0, .note=73, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=71, .velocity=113 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=93 },
-    { .type=1, .delay_ms=0, .channel=9, .note=41, .velocity=93 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=90 },
-    { .type=0, .delay_ms=8, .channel=1, .note=69, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=66, .velocity=113 },
-    { .type=0, .delay_ms=54, .channel=9, .note=41, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=0, .note=71, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=69, .velocity=103 },
-    { .type=0, .delay_ms=0, .channel=1, .note=66, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=63, .velocity=103 },
-    { .type=0, .delay_ms=62, .channel=0, .note=69, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=86 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=118 },
-    { .type=0, .delay_ms=8, .channel=1, .note=63, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=72 },
-    { .type=0, .delay_ms=33, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=54, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=125, .channel=0, .note=52, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=118 },
-    { .type=1, .delay_ms=8, .channel=1, .note=55, .velocity=114 },
-    { .type=1, .delay_ms=8, .channel=9, .note=46, .velocity=85 },
-    { .type=0, .delay_ms=4, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=62, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=40, .velocity=110 },
-    { .type=0, .delay_ms=8, .channel=1, .note=55, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=110 },
-    { .type=0, .delay_ms=33, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=87, .channel=0, .note=40, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=86 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=116 },
-    { .type=1, .delay_ms=16, .channel=9, .note=46, .velocity=81 },
-    { .type=0, .delay_ms=54, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=46, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=50, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=1, .note=54, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=118 },
-    { .type=0, .delay_ms=12, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=62, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=0, .note=50, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=54, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=104 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=123 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=104 },
-    { .type=1, .delay_ms=16, .channel=9, .note=46, .velocity=81 },
-    { .type=0, .delay_ms=20, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=37, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=9, .note=46, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=125, .channel=0, .note=48, .velocity=116 },
-    { .type=0, .delay_ms=0, .channel=0, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=123 },
-    { .type=1, .delay_ms=8, .channel=1, .note=51, .velocity=116 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=9, .note=46, .velocity=75 },
-    { .type=0, .delay_ms=91, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=0, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=108 },
-    { .type=0, .delay_ms=0, .channel=1, .note=51, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=108 },
-    { .type=0, .delay_ms=37, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=117 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=110 },
-    { .type=1, .delay_ms=12, .channel=9, .note=46, .velocity=72 },
-    { .type=0, .delay_ms=70, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=46, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=46, .velocity=110 },
-    { .type=1, .delay_ms=8, .channel=1, .note=50, .velocity=110 },
-    { .type=0, .delay_ms=4, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=120, .channel=0, .note=46, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=40, .velocity=110 },
-    { .type=0, .delay_ms=0, .channel=1, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=83 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=116 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=110 },
-    { .type=1, .delay_ms=8, .channel=9, .note=46, .velocity=75 },
-    { .type=0, .delay_ms=41, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=37, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=121 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=75, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=50, .channel=0, .note=47, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=83 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=8, .channel=1, .note=50, .velocity=110 },
-    { .type=1, .delay_ms=4, .channel=9, .note=46, .velocity=78 },
-    { .type=0, .delay_ms=70, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=0, .note=47, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=0, .note=48, .velocity=117 },
-    { .type=0, .delay_ms=0, .channel=1, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=52, .velocity=117 },
-    { .type=0, .delay_ms=91, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=48, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=8, .channel=9, .note=46, .velocity=68 },
-    { .type=0, .delay_ms=12, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=66, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=125, .channel=0, .note=52, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=121 },
-    { .type=1, .delay_ms=8, .channel=1, .note=55, .velocity=114 },
-    { .type=1, .delay_ms=8, .channel=9, .note=46, .velocity=72 },
-    { .type=0, .delay_ms=12, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=45, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=52, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=55, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=106 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=106 },
-    { .type=0, .delay_ms=33, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=116 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=20, .channel=9, .note=46, .velocity=65 },
-    { .type=0, .delay_ms=41, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=46, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=50, .velocity=106 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=117 },
-    { .type=1, .delay_ms=8, .channel=1, .note=54, .velocity=106 },
-    { .type=0, .delay_ms=12, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=54, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=50, .channel=0, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=83 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=0, .delay_ms=8, .channel=1, .note=54, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=12, .channel=9, .note=46, .velocity=75 },
-    { .type=0, .delay_ms=20, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=16, .channel=0, .note=40, .velocity=106 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=106 },
-    { .type=1, .delay_ms=125, .channel=0, .note=48, .velocity=117 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=75 },
-    { .type=0, .delay_ms=8, .channel=0, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=52, .velocity=117 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=75, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=48, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=41, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=117 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=69 },
-    { .type=0, .delay_ms=83, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=46, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=1, .note=49, .velocity=114 },
-    { .type=1, .delay_ms=133, .channel=2, .note=40, .velocity=86 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=73 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=121 },
-    { .type=0, .delay_ms=66, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=24, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=9, .note=36, .velocity=120 },
-    { .type=0, .delay_ms=83, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=49, .channel=2, .note=40, .velocity=71 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=8, .channel=9, .note=46, .velocity=71 },
-    { .type=0, .delay_ms=75, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=133, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=77 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=75 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=0, .delay_ms=8, .channel=1, .note=49, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=108 },
-    { .type=0, .delay_ms=12, .channel=0, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=107 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=107 },
-    { .type=1, .delay_ms=125, .channel=0, .note=52, .velocity=113 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=69 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=121 },
-    { .type=1, .delay_ms=4, .channel=1, .note=55, .velocity=113 },
-    { .type=0, .delay_ms=58, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=40, .velocity=105 },
-    { .type=0, .delay_ms=8, .channel=1, .note=55, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=105 },
-    { .type=0, .delay_ms=41, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=75, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=79 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=66, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=25, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=50, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=1, .note=54, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=115 },
-    { .type=0, .delay_ms=20, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=62, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=41, .channel=9, .note=46, .velocity=71 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=0, .channel=0, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=123 },
-    { .type=0, .delay_ms=8, .channel=1, .note=54, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=125, .channel=0, .note=48, .velocity=118 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=98 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=0, .delay_ms=8, .channel=0, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=51, .velocity=118 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=65 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=83, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=0, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=106 },
-    { .type=0, .delay_ms=0, .channel=1, .note=51, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=106 },
-    { .type=0, .delay_ms=33, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=75 },
-    { .type=0, .delay_ms=83, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=46, .velocity=115 },
-    { .type=0, .delay_ms=8, .channel=0, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=50, .velocity=115 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=116, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=86 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=72 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=12, .channel=0, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=50, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=125, .channel=0, .note=47, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=8, .channel=1, .note=50, .velocity=110 },
-    { .type=1, .delay_ms=8, .channel=9, .note=46, .velocity=71 },
-    { .type=0, .delay_ms=83, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=25, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=0, .note=47, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=48, .velocity=111 },
-    { .type=0, .delay_ms=8, .channel=1, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=52, .velocity=111 },
-    { .type=0, .delay_ms=66, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=50, .channel=0, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=0, .note=40, .velocity=110 },
-    { .type=0, .delay_ms=0, .channel=1, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=72 },
-    { .type=0, .delay_ms=41, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=125, .channel=9, .note=46, .velocity=73 },
-    { .type=1, .delay_ms=8, .channel=0, .note=52, .velocity=117 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=83 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=123 },
-    { .type=1, .delay_ms=4, .channel=1, .note=55, .velocity=117 },
-    { .type=0, .delay_ms=70, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=8, .channel=0, .note=52, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=55, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=71 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=108 },
-    { .type=0, .delay_ms=62, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=25, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=16, .channel=0, .note=50, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=4, .channel=1, .note=54, .velocity=110 },
-    { .type=0, .delay_ms=29, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=45, .channel=0, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=98 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=120 },
-    { .type=0, .delay_ms=8, .channel=1, .note=54, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=73 },
-    { .type=0, .delay_ms=33, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=115 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=115 },
-    { .type=0, .delay_ms=75, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=50, .channel=0, .note=79, .velocity=103 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=104 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=82 },
-    { .type=1, .delay_ms=4, .channel=1, .note=76, .velocity=103 },
-    { .type=1, .delay_ms=0, .channel=9, .note=50, .velocity=91 },
-    { .type=1, .delay_ms=8, .channel=9, .note=40, .velocity=82 },
-    { .type=0, .delay_ms=20, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=50, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=0, .note=79, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=76, .velocity=113 },
-    { .type=0, .delay_ms=8, .channel=1, .note=76, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=71, .velocity=113 },
-    { .type=0, .delay_ms=41, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=0, .note=76, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=71, .velocity=100 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=92 },
-    { .type=0, .delay_ms=8, .channel=1, .note=71, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=67, .velocity=100 },
-    { .type=0, .delay_ms=33, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=0, .note=71, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=67, .velocity=110 },
-    { .type=0, .delay_ms=8, .channel=1, .note=67, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=64, .velocity=110 },
-    { .type=0, .delay_ms=54, .channel=0, .note=67, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=76, .velocity=103 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=98 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=92 },
-    { .type=0, .delay_ms=8, .channel=1, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=71, .velocity=103 },
-    { .type=1, .delay_ms=4, .channel=9, .note=40, .velocity=85 },
-    { .type=1, .delay_ms=8, .channel=9, .note=47, .velocity=85 },
-    { .type=0, .delay_ms=20, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=47, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=0, .note=76, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=79, .velocity=112 },
-    { .type=0, .delay_ms=4, .channel=1, .note=71, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=76, .velocity=112 },
-    { .type=0, .delay_ms=37, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=25, .channel=0, .note=79, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=76, .velocity=101 },
-    { .type=0, .delay_ms=0, .channel=1, .note=76, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=71, .velocity=101 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=93 },
-    { .type=0, .delay_ms=41, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=76, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=71, .velocity=111 },
-    { .type=0, .delay_ms=8, .channel=1, .note=71, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=67, .velocity=111 },
-    { .type=0, .delay_ms=62, .channel=0, .note=71, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=67, .velocity=103 },
-    { .type=0, .delay_ms=0, .channel=1, .note=67, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=64, .velocity=103 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=87 },
-    { .type=1, .delay_ms=20, .channel=9, .note=45, .velocity=93 },
-    { .type=1, .delay_ms=8, .channel=9, .note=40, .velocity=91 },
-    { .type=0, .delay_ms=12, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=67, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=71, .velocity=113 },
-    { .type=0, .delay_ms=0, .channel=9, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=67, .velocity=113 },
-    { .type=0, .delay_ms=33, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=0, .note=71, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=76, .velocity=102 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=93 },
-    { .type=0, .delay_ms=4, .channel=1, .note=67, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=71, .velocity=102 },
-    { .type=0, .delay_ms=37, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=76, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=71, .velocity=111 },
-    { .type=0, .delay_ms=4, .channel=1, .note=71, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=67, .velocity=111 },
-    { .type=0, .delay_ms=62, .channel=0, .note=71, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=79, .velocity=103 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=104 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=93 },
-    { .type=0, .delay_ms=8, .channel=1, .note=67, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=76, .velocity=103 },
-    { .type=1, .delay_ms=12, .channel=9, .note=40, .velocity=90 },
-    { .type=1, .delay_ms=8, .channel=9, .note=41, .velocity=73 },
-    { .type=0, .delay_ms=12, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=0, .note=79, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=76, .velocity=112 },
-    { .type=0, .delay_ms=0, .channel=9, .note=41, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=76, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=71, .velocity=112 },
-    { .type=0, .delay_ms=41, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=76, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=71, .velocity=105 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=93 },
-    { .type=0, .delay_ms=8, .channel=1, .note=71, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=67, .velocity=105 },
-    { .type=0, .delay_ms=41, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=0, .note=71, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=67, .velocity=112 },
-    { .type=0, .delay_ms=8, .channel=1, .note=67, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=64, .velocity=112 },
-    { .type=0, .delay_ms=62, .channel=0, .note=67, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=45, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=86 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=118 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=112 },
-    { .type=0, .delay_ms=4, .channel=1, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=45, .velocity=108 },
-    { .type=0, .delay_ms=29, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=2, .note=33, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=45, .velocity=114 },
-    { .type=1, .delay_ms=8, .channel=1, .note=45, .velocity=114 },
-    { .type=1, .delay_ms=125, .channel=0, .note=57, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=118 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=116 },
-    { .type=1, .delay_ms=8, .channel=1, .note=60, .velocity=114 },
-    { .type=0, .delay_ms=12, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=45, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=2, .note=33, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=0, .note=57, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=45, .velocity=110 },
-    { .type=0, .delay_ms=4, .channel=1, .note=60, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=45, .velocity=110 },
-    { .type=0, .delay_ms=37, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=45, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=45, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=86 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=116 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=116 },
-    { .type=1, .delay_ms=8, .channel=1, .note=45, .velocity=110 },
-    { .type=0, .delay_ms=70, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=55, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=118 },
-    { .type=1, .delay_ms=8, .channel=1, .note=59, .velocity=111 },
-    { .type=0, .delay_ms=12, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=62, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=0, .note=55, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=59, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=45, .velocity=104 },
-    { .type=1, .delay_ms=0, .channel=1, .note=45, .velocity=104 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=110 },
-    { .type=0, .delay_ms=41, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=29, .channel=0, .note=45, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=1, .note=45, .velocity=111 },
-    { .type=1, .delay_ms=133, .channel=0, .note=53, .velocity=116 },
-    { .type=0, .delay_ms=0, .channel=0, .note=45, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=117 },
-    { .type=1, .delay_ms=4, .channel=1, .note=56, .velocity=116 },
-    { .type=0, .delay_ms=0, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=79, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=2, .note=33, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=0, .note=53, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=0, .note=45, .velocity=108 },
-    { .type=0, .delay_ms=0, .channel=1, .note=56, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=1, .note=45, .velocity=108 },
-    { .type=0, .delay_ms=33, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=45, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=117 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=119 },
-    { .type=1, .delay_ms=8, .channel=1, .note=45, .velocity=110 },
-    { .type=0, .delay_ms=75, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=51, .velocity=110 },
-    { .type=0, .delay_ms=4, .channel=0, .note=45, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=55, .velocity=110 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=112, .channel=0, .note=51, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=0, .note=45, .velocity=110 },
-    { .type=0, .delay_ms=0, .channel=1, .note=55, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=83 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=116 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=111 },
-    { .type=1, .delay_ms=8, .channel=1, .note=45, .velocity=110 },
-    { .type=0, .delay_ms=50, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=45, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=121 },
-    { .type=1, .delay_ms=8, .channel=1, .note=45, .velocity=111 },
-    { .type=0, .delay_ms=75, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=50, .channel=0, .note=52, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=83 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=111 },
-    { .type=1, .delay_ms=4, .channel=1, .note=55, .velocity=110 },
-    { .type=0, .delay_ms=79, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=2, .note=33, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=0, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=53, .velocity=117 },
-    { .type=0, .delay_ms=0, .channel=1, .note=55, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=1, .note=57, .velocity=117 },
-    { .type=0, .delay_ms=83, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=57, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=45, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=108 },
-    { .type=1, .delay_ms=8, .channel=1, .note=45, .velocity=111 },
-    { .type=0, .delay_ms=20, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=50, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=45, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=1, .note=45, .velocity=111 },
-    { .type=1, .delay_ms=133, .channel=0, .note=57, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=1, .note=60, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=121 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=111 },
-    { .type=0, .delay_ms=29, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=45, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=2, .note=33, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=0, .note=57, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=60, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=45, .velocity=106 },
-    { .type=1, .delay_ms=4, .channel=1, .note=45, .velocity=106 },
-    { .type=0, .delay_ms=37, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=45, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=45, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=116 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=101 },
-    { .type=1, .delay_ms=8, .channel=1, .note=45, .velocity=108 },
-    { .type=0, .delay_ms=62, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=29, .channel=0, .note=55, .velocity=106 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=117 },
-    { .type=1, .delay_ms=8, .channel=1, .note=59, .velocity=106 },
-    { .type=0, .delay_ms=12, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=54, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=58, .channel=0, .note=55, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=45, .velocity=114 },
-    { .type=0, .delay_ms=0, .channel=1, .note=59, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=83 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=112 },
-    { .type=1, .delay_ms=4, .channel=1, .note=45, .velocity=114 },
-    { .type=0, .delay_ms=37, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=37, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=45, .velocity=106 },
-    { .type=1, .delay_ms=8, .channel=1, .note=45, .velocity=106 },
-    { .type=1, .delay_ms=125, .channel=0, .note=53, .velocity=117 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=105 },
-    { .type=0, .delay_ms=8, .channel=0, .note=45, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=57, .velocity=117 },
-    { .type=0, .delay_ms=4, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=70, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=0, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=2, .note=33, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=57, .velocity=0 },
-    { .type=1, .delay_ms=16, .channel=0, .note=45, .velocity=111 },
-    { .type=1, .delay_ms=4, .channel=1, .note=45, .velocity=111 },
-    { .type=0, .delay_ms=41, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=1, .delay_ms=75, .channel=0, .note=45, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=117 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=108 },
-    { .type=1, .delay_ms=8, .channel=1, .note=45, .velocity=114 },
-    { .type=0, .delay_ms=75, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=51, .velocity=114 },
-    { .type=1, .delay_ms=8, .channel=1, .note=55, .velocity=114 },
-    { .type=1, .delay_ms=129, .channel=2, .note=33, .velocity=86 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=121 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=117 },
-    { .type=0, .delay_ms=70, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=9, .note=36, .velocity=120 },
-    { .type=0, .delay_ms=83, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=49, .channel=2, .note=33, .velocity=71 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=108 },
-    { .type=0, .delay_ms=83, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=2, .note=33, .velocity=0 },
-    { .type=0, .delay_ms=133, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=45, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=45, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=77 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=107 },
-    { .type=1, .delay_ms=8, .channel=1, .note=45, .velocity=108 },
-    { .type=0, .delay_ms=12, .channel=0, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=55, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=45, .velocity=107 },
-    { .type=1, .delay_ms=4, .channel=1, .note=45, .velocity=107 },
-    { .type=1, .delay_ms=125, .channel=0, .note=57, .velocity=113 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=121 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=115 },
-    { .type=1, .delay_ms=8, .channel=1, .note=60, .velocity=113 },
-    { .type=0, .delay_ms=50, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=2, .note=33, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=57, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=45, .velocity=105 },
-    { .type=0, .delay_ms=0, .channel=1, .note=60, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=1, .note=45, .velocity=105 },
-    { .type=0, .delay_ms=41, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=45, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=45, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=107 },
-    { .type=1, .delay_ms=4, .channel=1, .note=45, .velocity=111 },
-    { .type=0, .delay_ms=70, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=55, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=115 },
-    { .type=1, .delay_ms=8, .channel=1, .note=59, .velocity=110 },
-    { .type=0, .delay_ms=12, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=54, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=50, .channel=0, .note=45, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=114 },
-    { .type=0, .delay_ms=8, .channel=0, .note=55, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=45, .velocity=111 },
-    { .type=0, .delay_ms=0, .channel=1, .note=59, .velocity=0 },
-    { .type=0, .delay_ms=45, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=45, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=1, .note=45, .velocity=114 },
-    { .type=1, .delay_ms=133, .channel=0, .note=53, .velocity=118 },
-    { .type=1, .delay_ms=0, .channel=1, .note=56, .velocity=118 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=98 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=110 },
-    { .type=0, .delay_ms=8, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=70, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=2, .note=33, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=0, .note=53, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=45, .velocity=106 },
-    { .type=0, .delay_ms=0, .channel=1, .note=56, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=1, .note=45, .velocity=106 },
-    { .type=0, .delay_ms=37, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=45, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=45, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=119 },
-    { .type=1, .delay_ms=8, .channel=1, .note=45, .velocity=108 },
-    { .type=0, .delay_ms=70, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=51, .velocity=115 },
-    { .type=0, .delay_ms=8, .channel=0, .note=45, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=55, .velocity=115 },
-    { .type=0, .delay_ms=4, .channel=1, .note=45, .velocity=0 },
-    { .type=1, .delay_ms=120, .channel=0, .note=45, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=86 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=110 },
-    { .type=1, .delay_ms=4, .channel=1, .note=45, .velocity=111 },
-    { .type=0, .delay_ms=8, .channel=0, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=55, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=37, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=2, .note=33, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=25, .channel=0, .note=45, .velocity=111 },
-    { .type=1, .delay_ms=8, .channel=1, .note=45, .velocity=111 },
-    { .type=1, .delay_ms=125, .channel=0, .note=52, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=110 },
-    { .type=1, .delay_ms=8, .channel=1, .note=55, .velocity=110 },
-    { .type=0, .delay_ms=75, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=2, .note=33, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=0, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=53, .velocity=111 },
-    { .type=0, .delay_ms=4, .channel=1, .note=55, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=57, .velocity=111 },
-    { .type=0, .delay_ms=70, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=45, .channel=0, .note=53, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=45, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=119 },
-    { .type=0, .delay_ms=8, .channel=1, .note=57, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=45, .velocity=110 },
-    { .type=0, .delay_ms=41, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=25, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=45, .velocity=108 },
-    { .type=1, .delay_ms=8, .channel=1, .note=45, .velocity=108 },
-    { .type=1, .delay_ms=129, .channel=0, .note=57, .velocity=117 },
-    { .type=1, .delay_ms=0, .channel=1, .note=60, .velocity=117 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=83 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=115 },
-    { .type=0, .delay_ms=83, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=45, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=1, .note=45, .velocity=111 },
-    { .type=0, .delay_ms=12, .channel=0, .note=57, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=60, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=45, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=119 },
-    { .type=1, .delay_ms=4, .channel=1, .note=45, .velocity=108 },
-    { .type=0, .delay_ms=62, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=55, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=8, .channel=1, .note=59, .velocity=110 },
-    { .type=0, .delay_ms=29, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=50, .channel=0, .note=55, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=45, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=98 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=120 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=117 },
-    { .type=0, .delay_ms=8, .channel=1, .note=59, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=45, .velocity=114 },
-    { .type=0, .delay_ms=33, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=45, .velocity=115 },
-    { .type=1, .delay_ms=4, .channel=1, .note=45, .velocity=115 },
-    { .type=0, .delay_ms=70, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=1, .delay_ms=45, .channel=0, .note=69, .velocity=112 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=104 },
-    { .type=1, .delay_ms=0, .channel=9, .note=51, .velocity=113 },
-    { .type=1, .delay_ms=8, .channel=1, .note=64, .velocity=112 },
-    { .type=1, .delay_ms=8, .channel=9, .note=40, .velocity=82 },
-    { .type=0, .delay_ms=20, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=0, .note=69, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=65, .velocity=105 },
-    { .type=0, .delay_ms=0, .channel=1, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=62, .velocity=105 },
-    { .type=0, .delay_ms=8, .channel=9, .note=51, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=2, .note=33, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=0, .note=65, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=64, .velocity=112 },
-    { .type=0, .delay_ms=8, .channel=1, .note=62, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=60, .velocity=112 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=79 },
-    { .type=0, .delay_ms=20, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=0, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=69, .velocity=103 },
-    { .type=0, .delay_ms=4, .channel=1, .note=60, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=64, .velocity=103 },
-    { .type=0, .delay_ms=58, .channel=0, .note=69, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=64, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=98 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=93 },
-    { .type=0, .delay_ms=4, .channel=1, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=60, .velocity=111 },
-    { .type=0, .delay_ms=20, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=0, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=60, .velocity=102 },
-    { .type=0, .delay_ms=8, .channel=1, .note=60, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=57, .velocity=102 },
-    { .type=0, .delay_ms=33, .channel=2, .note=33, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=60, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=64, .velocity=113 },
-    { .type=0, .delay_ms=8, .channel=1, .note=57, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=60, .velocity=113 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=88 },
-    { .type=0, .delay_ms=20, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=0, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=69, .velocity=103 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=86 },
-    { .type=0, .delay_ms=8, .channel=1, .note=60, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=64, .velocity=103 },
-    { .type=0, .delay_ms=20, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=0, .note=69, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=72, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=92 },
-    { .type=0, .delay_ms=8, .channel=1, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=69, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=93 },
-    { .type=0, .delay_ms=25, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=37, .channel=0, .note=72, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=69, .velocity=101 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=87 },
-    { .type=0, .delay_ms=4, .channel=1, .note=69, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=64, .velocity=101 },
-    { .type=0, .delay_ms=29, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=2, .note=33, .velocity=0 },
-    { .type=0, .delay_ms=25, .channel=0, .note=69, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=64, .velocity=112 },
-    { .type=0, .delay_ms=0, .channel=1, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=60, .velocity=112 },
-    { .type=1, .delay_ms=8, .channel=9, .note=36, .velocity=86 },
-    { .type=0, .delay_ms=20, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=0, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=69, .velocity=103 },
-    { .type=0, .delay_ms=8, .channel=1, .note=60, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=64, .velocity=103 },
-    { .type=0, .delay_ms=62, .channel=0, .note=69, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=64, .velocity=110 },
-    { .type=0, .delay_ms=0, .channel=1, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=60, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=104 },
-    { .type=1, .delay_ms=8, .channel=9, .note=40, .velocity=93 },
-    { .type=0, .delay_ms=25, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=0, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=69, .velocity=100 },
-    { .type=0, .delay_ms=8, .channel=1, .note=60, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=64, .velocity=100 },
-    { .type=0, .delay_ms=33, .channel=2, .note=33, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=0, .note=69, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=64, .velocity=113 },
-    { .type=0, .delay_ms=4, .channel=1, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=60, .velocity=113 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=93 },
-    { .type=0, .delay_ms=29, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=0, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=60, .velocity=103 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=88 },
-    { .type=0, .delay_ms=4, .channel=1, .note=60, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=57, .velocity=103 },
-    { .type=0, .delay_ms=20, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=0, .note=60, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=86 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=118 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=72 },
-    { .type=0, .delay_ms=8, .channel=1, .note=57, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=108 },
-    { .type=0, .delay_ms=29, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=58, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=125, .channel=0, .note=52, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=118 },
-    { .type=1, .delay_ms=4, .channel=1, .note=55, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=85 },
-    { .type=0, .delay_ms=16, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=66, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=25, .channel=0, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=40, .velocity=110 },
-    { .type=0, .delay_ms=0, .channel=1, .note=55, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=110 },
-    { .type=0, .delay_ms=33, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=86 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=116 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=110 },
-    { .type=1, .delay_ms=4, .channel=9, .note=46, .velocity=81 },
-    { .type=0, .delay_ms=58, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=46, .velocity=0 },
-    { .type=1, .delay_ms=16, .channel=0, .note=50, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=118 },
-    { .type=1, .delay_ms=4, .channel=1, .note=54, .velocity=111 },
-    { .type=0, .delay_ms=16, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=66, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=0, .note=50, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=54, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=0, .note=40, .velocity=104 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=123 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=104 },
-    { .type=1, .delay_ms=12, .channel=9, .note=46, .velocity=81 },
-    { .type=0, .delay_ms=29, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=25, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=46, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=129, .channel=0, .note=48, .velocity=116 },
-    { .type=0, .delay_ms=0, .channel=0, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=51, .velocity=116 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=123 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=75 },
-    { .type=0, .delay_ms=91, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=0, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=108 },
-    { .type=0, .delay_ms=0, .channel=1, .note=51, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=108 },
-    { .type=0, .delay_ms=41, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=117 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=110 },
-    { .type=1, .delay_ms=16, .channel=9, .note=46, .velocity=72 },
-    { .type=0, .delay_ms=62, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=25, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=46, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=46, .velocity=110 },
-    { .type=0, .delay_ms=8, .channel=0, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=50, .velocity=110 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=108, .channel=0, .note=46, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=110 },
-    { .type=0, .delay_ms=0, .channel=1, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=83 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=116 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=75 },
-    { .type=0, .delay_ms=45, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=121 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=79, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=45, .channel=0, .note=47, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=83 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=8, .channel=1, .note=50, .velocity=110 },
-    { .type=1, .delay_ms=8, .channel=9, .note=46, .velocity=78 },
-    { .type=0, .delay_ms=66, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=0, .note=47, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=48, .velocity=117 },
-    { .type=0, .delay_ms=0, .channel=1, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=1, .note=52, .velocity=117 },
-    { .type=0, .delay_ms=83, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=48, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=68 },
-    { .type=0, .delay_ms=20, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=70, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=125, .channel=0, .note=52, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=121 },
-    { .type=1, .delay_ms=8, .channel=1, .note=55, .velocity=114 },
-    { .type=1, .delay_ms=4, .channel=9, .note=46, .velocity=72 },
-    { .type=0, .delay_ms=16, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=58, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=0, .note=52, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=55, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=0, .note=40, .velocity=106 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=106 },
-    { .type=0, .delay_ms=41, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=91, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=116 },
-    { .type=1, .delay_ms=29, .channel=9, .note=46, .velocity=65 },
-    { .type=0, .delay_ms=41, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=46, .velocity=0 },
-    { .type=1, .delay_ms=16, .channel=0, .note=50, .velocity=106 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=117 },
-    { .type=1, .delay_ms=4, .channel=1, .note=54, .velocity=106 },
-    { .type=0, .delay_ms=8, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=54, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=50, .channel=0, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=0, .note=40, .velocity=114 },
-    { .type=0, .delay_ms=0, .channel=1, .note=54, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=83 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=12, .channel=9, .note=46, .velocity=75 },
-    { .type=0, .delay_ms=20, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=106 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=106 },
-    { .type=1, .delay_ms=125, .channel=0, .note=48, .velocity=117 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=75 },
-    { .type=0, .delay_ms=4, .channel=0, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=52, .velocity=117 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=75, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=0, .note=48, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=41, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=75, .channel=0, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=117 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=69 },
-    { .type=0, .delay_ms=83, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=25, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=16, .channel=0, .note=46, .velocity=114 },
-    { .type=1, .delay_ms=4, .channel=1, .note=49, .velocity=114 },
-    { .type=1, .delay_ms=124, .channel=2, .note=40, .velocity=86 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=73 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=121 },
-    { .type=0, .delay_ms=79, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=9, .note=36, .velocity=120 },
-    { .type=0, .delay_ms=91, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=45, .channel=2, .note=40, .velocity=71 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=8, .channel=9, .note=46, .velocity=71 },
-    { .type=0, .delay_ms=70, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=133, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=9, .note=46, .velocity=75 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=77 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=108 },
-    { .type=0, .delay_ms=16, .channel=0, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=37, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=0, .note=40, .velocity=107 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=107 },
-    { .type=1, .delay_ms=116, .channel=9, .note=46, .velocity=69 },
-    { .type=1, .delay_ms=8, .channel=0, .note=52, .velocity=113 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=121 },
-    { .type=1, .delay_ms=8, .channel=1, .note=55, .velocity=113 },
-    { .type=0, .delay_ms=45, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=105 },
-    { .type=0, .delay_ms=0, .channel=1, .note=55, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=105 },
-    { .type=0, .delay_ms=37, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=79 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=70, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=37, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=50, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=115 },
-    { .type=1, .delay_ms=8, .channel=1, .note=54, .velocity=110 },
-    { .type=0, .delay_ms=12, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=54, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=50, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=71 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=123 },
-    { .type=0, .delay_ms=4, .channel=0, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=0, .channel=1, .note=54, .velocity=0 },
-    { .type=0, .delay_ms=50, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=125, .channel=0, .note=48, .velocity=118 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=98 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=8, .channel=1, .note=51, .velocity=118 },
-    { .type=0, .delay_ms=4, .channel=0, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=65 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=75, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=0, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=0, .note=40, .velocity=106 },
-    { .type=0, .delay_ms=0, .channel=1, .note=51, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=106 },
-    { .type=0, .delay_ms=41, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=8, .channel=9, .note=46, .velocity=75 },
-    { .type=0, .delay_ms=83, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=25, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=16, .channel=0, .note=46, .velocity=115 },
-    { .type=0, .delay_ms=4, .channel=0, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=50, .velocity=115 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=116, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=86 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=72 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=8, .channel=0, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=50, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=29, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=125, .channel=0, .note=47, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=4, .channel=1, .note=50, .velocity=110 },
-    { .type=1, .delay_ms=8, .channel=9, .note=46, .velocity=71 },
-    { .type=0, .delay_ms=75, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=0, .note=47, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=48, .velocity=111 },
-    { .type=0, .delay_ms=8, .channel=1, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=52, .velocity=111 },
-    { .type=0, .delay_ms=70, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=50, .channel=0, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=40, .velocity=110 },
-    { .type=0, .delay_ms=0, .channel=1, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=123 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=72 },
-    { .type=0, .delay_ms=41, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=37, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=16, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=120, .channel=9, .note=46, .velocity=73 },
-    { .type=1, .delay_ms=4, .channel=0, .note=52, .velocity=117 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=83 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=123 },
-    { .type=1, .delay_ms=8, .channel=1, .note=55, .velocity=117 },
-    { .type=0, .delay_ms=75, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=12, .channel=0, .note=52, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=55, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=79, .channel=9, .note=46, .velocity=71 },
-    { .type=1, .delay_ms=4, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=0, .delay_ms=70, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=50, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=1, .note=54, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=0, .delay_ms=33, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=50, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=50, .channel=0, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=98 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=120 },
-    { .type=0, .delay_ms=4, .channel=1, .note=54, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=9, .note=46, .velocity=73 },
-    { .type=0, .delay_ms=29, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=9, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=40, .velocity=115 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=115 },
-    { .type=0, .delay_ms=125, .channel=0, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=48, .velocity=117 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=104 },
-    { .type=1, .delay_ms=0, .channel=9, .note=38, .velocity=85 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=92 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=52, .velocity=117 },
-    { .type=0, .delay_ms=4, .channel=9, .note=38, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=95, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=86 },
-    { .type=1, .delay_ms=16, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=0, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=0, .note=48, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=50, .channel=9, .note=38, .velocity=82 },
-    { .type=1, .delay_ms=8, .channel=9, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=4, .channel=0, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=98 },
-    { .type=0, .delay_ms=0, .channel=9, .note=38, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=114 },
-    { .type=0, .delay_ms=0, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=95, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=9, .note=36, .velocity=91 },
-    { .type=1, .delay_ms=8, .channel=0, .note=46, .velocity=114 },
-    { .type=1, .delay_ms=8, .channel=1, .note=49, .velocity=114 },
-    { .type=0, .delay_ms=4, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=120, .channel=2, .note=40, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=38, .velocity=79 },
-    { .type=1, .delay_ms=4, .channel=9, .note=40, .velocity=88 },
-    { .type=0, .delay_ms=8, .channel=9, .note=38, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=33, .channel=9, .note=38, .velocity=79 },
-    { .type=1, .delay_ms=8, .channel=9, .note=40, .velocity=90 },
-    { .type=0, .delay_ms=4, .channel=9, .note=38, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=25, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=9, .note=36, .velocity=93 },
-    { .type=0, .delay_ms=20, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=104, .channel=9, .note=38, .velocity=87 },
-    { .type=1, .delay_ms=8, .channel=2, .note=40, .velocity=104 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=93 },
-    { .type=0, .delay_ms=8, .channel=9, .note=38, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=99, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=9, .note=36, .velocity=93 },
-    { .type=0, .delay_ms=20, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=104, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=0, .note=46, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=49, .velocity=108 },
-    { .type=0, .delay_ms=0, .channel=1, .note=49, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=49, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=37, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=118 },
-    { .type=1, .delay_ms=0, .channel=9, .note=57, .velocity=79 },
-    { .type=0, .delay_ms=33, .channel=0, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=9, .note=57, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=29, .channel=0, .note=49, .velocity=114 },
-    { .type=0, .delay_ms=0, .channel=2, .note=37, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=1, .note=49, .velocity=114 },
-    { .type=1, .delay_ms=120, .channel=9, .note=53, .velocity=123 },
-    { .type=1, .delay_ms=4, .channel=0, .note=61, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=37, .velocity=98 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=118 },
-    { .type=1, .delay_ms=8, .channel=1, .note=67, .velocity=114 },
-    { .type=0, .delay_ms=8, .channel=0, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=62, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=0, .note=61, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=49, .velocity=110 },
-    { .type=0, .delay_ms=0, .channel=1, .note=67, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=1, .note=49, .velocity=110 },
-    { .type=0, .delay_ms=25, .channel=2, .note=37, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=0, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=49, .velocity=0 },
-    { .type=1, .delay_ms=75, .channel=9, .note=53, .velocity=125 },
-    { .type=1, .delay_ms=8, .channel=0, .note=49, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=37, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=116 },
-    { .type=1, .delay_ms=4, .channel=1, .note=49, .velocity=110 },
-    { .type=0, .delay_ms=16, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=45, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=62, .channel=0, .note=59, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=118 },
-    { .type=1, .delay_ms=8, .channel=1, .note=66, .velocity=111 },
-    { .type=0, .delay_ms=12, .channel=0, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=2, .note=37, .velocity=0 },
-    { .type=0, .delay_ms=54, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=0, .note=59, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=66, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=9, .note=53, .velocity=122 },
-    { .type=1, .delay_ms=8, .channel=0, .note=49, .velocity=104 },
-    { .type=1, .delay_ms=0, .channel=2, .note=37, .velocity=104 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=123 },
-    { .type=1, .delay_ms=8, .channel=1, .note=49, .velocity=104 },
-    { .type=0, .delay_ms=12, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=0, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=9, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=50, .channel=0, .note=49, .velocity=111 },
-    { .type=1, .delay_ms=4, .channel=1, .note=49, .velocity=111 },
-    { .type=0, .delay_ms=16, .channel=2, .note=37, .velocity=0 },
-    { .type=1, .delay_ms=108, .channel=0, .note=57, .velocity=116 },
-    { .type=1, .delay_ms=0, .channel=2, .note=37, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=9, .note=53, .velocity=124 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=123 },
-    { .type=0, .delay_ms=8, .channel=0, .note=49, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=64, .velocity=116 },
-    { .type=0, .delay_ms=0, .channel=1, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=75, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=0, .note=57, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=49, .velocity=108 },
-    { .type=0, .delay_ms=0, .channel=1, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=1, .note=49, .velocity=108 },
-    { .type=0, .delay_ms=12, .channel=2, .note=37, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=0, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=49, .velocity=0 },
-    { .type=1, .delay_ms=87, .channel=0, .note=49, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=1, .note=49, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=37, .velocity=104 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=117 },
-    { .type=1, .delay_ms=0, .channel=9, .note=53, .velocity=114 },
-    { .type=0, .delay_ms=29, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=54, .channel=9, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=50, .channel=0, .note=55, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=1, .note=61, .velocity=110 },
-    { .type=0, .delay_ms=8, .channel=0, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=2, .note=37, .velocity=0 },
-    { .type=0, .delay_ms=95, .channel=0, .note=55, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=49, .velocity=110 },
-    { .type=0, .delay_ms=0, .channel=1, .note=61, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=2, .note=37, .velocity=104 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=116 },
-    { .type=1, .delay_ms=0, .channel=9, .note=53, .velocity=120 },
-    { .type=1, .delay_ms=4, .channel=1, .note=49, .velocity=110 },
-    { .type=0, .delay_ms=20, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=0, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=62, .channel=0, .note=49, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=121 },
-    { .type=1, .delay_ms=8, .channel=1, .note=49, .velocity=111 },
-    { .type=0, .delay_ms=29, .channel=2, .note=37, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=45, .channel=9, .note=53, .velocity=124 },
-    { .type=1, .delay_ms=8, .channel=0, .note=56, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=37, .velocity=98 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=8, .channel=1, .note=61, .velocity=110 },
-    { .type=0, .delay_ms=12, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=62, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=0, .note=56, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=57, .velocity=117 },
-    { .type=0, .delay_ms=0, .channel=1, .note=61, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=1, .note=64, .velocity=117 },
-    { .type=0, .delay_ms=20, .channel=2, .note=37, .velocity=0 },
-    { .type=0, .delay_ms=62, .channel=0, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=49, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=57, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=0, .note=47, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=35, .velocity=77 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=49, .velocity=79 },
-    { .type=1, .delay_ms=8, .channel=1, .note=47, .velocity=111 },
-    { .type=0, .delay_ms=20, .channel=0, .note=47, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=47, .velocity=0 },
-    { .type=0, .delay_ms=62, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=49, .velocity=0 },
-    { .type=1, .delay_ms=20, .channel=0, .note=47, .velocity=111 },
-    { .type=1, .delay_ms=8, .channel=1, .note=47, .velocity=111 },
-    { .type=0, .delay_ms=33, .channel=2, .note=35, .velocity=0 },
-    { .type=1, .delay_ms=91, .channel=0, .note=59, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=35, .velocity=92 },
-    { .type=1, .delay_ms=0, .channel=9, .note=53, .velocity=124 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=121 },
-    { .type=1, .delay_ms=4, .channel=1, .note=66, .velocity=114 },
-    { .type=0, .delay_ms=20, .channel=0, .note=47, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=47, .velocity=0 },
-    { .type=0, .delay_ms=54, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=37, .channel=0, .note=59, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=66, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=0, .note=47, .velocity=106 },
-    { .type=1, .delay_ms=8, .channel=1, .note=47, .velocity=106 },
-    { .type=0, .delay_ms=29, .channel=2, .note=35, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=0, .note=47, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=47, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=47, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=35, .velocity=104 },
-    { .type=1, .delay_ms=0, .channel=9, .note=53, .velocity=119 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=116 },
-    { .type=1, .delay_ms=8, .channel=1, .note=47, .velocity=108 },
-    { .type=0, .delay_ms=20, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=66, .channel=0, .note=57, .velocity=106 },
-    { .type=1, .delay_ms=0, .channel=1, .note=64, .velocity=106 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=117 },
-    { .type=0, .delay_ms=16, .channel=0, .note=47, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=47, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=2, .note=35, .velocity=0 },
-    { .type=0, .delay_ms=58, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=41, .channel=9, .note=53, .velocity=124 },
-    { .type=0, .delay_ms=4, .channel=0, .note=57, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=47, .velocity=114 },
-    { .type=0, .delay_ms=0, .channel=1, .note=64, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=47, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=35, .velocity=86 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=0, .delay_ms=12, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=0, .note=47, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=47, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=9, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=50, .channel=0, .note=47, .velocity=106 },
-    { .type=1, .delay_ms=4, .channel=1, .note=47, .velocity=106 },
-    { .type=0, .delay_ms=16, .channel=2, .note=35, .velocity=0 },
-    { .type=1, .delay_ms=104, .channel=9, .note=53, .velocity=125 },
-    { .type=1, .delay_ms=4, .channel=0, .note=55, .velocity=117 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=98 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=123 },
-    { .type=0, .delay_ms=8, .channel=0, .note=47, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=63, .velocity=117 },
-    { .type=0, .delay_ms=8, .channel=1, .note=47, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=75, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=0, .note=55, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=63, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=46, .velocity=111 },
-    { .type=1, .delay_ms=8, .channel=1, .note=46, .velocity=111 },
-    { .type=0, .delay_ms=20, .channel=2, .note=33, .velocity=0 },
-    { .type=0, .delay_ms=25, .channel=1, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=0, .note=46, .velocity=0 },
-    { .type=1, .delay_ms=70, .channel=0, .note=45, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=33, .velocity=98 },
-    { .type=1, .delay_ms=0, .channel=9, .note=53, .velocity=125 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=117 },
-    { .type=1, .delay_ms=4, .channel=1, .note=45, .velocity=114 },
-    { .type=0, .delay_ms=20, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=62, .channel=9, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=41, .channel=0, .note=53, .velocity=114 },
-    { .type=1, .delay_ms=8, .channel=1, .note=59, .velocity=114 },
-    { .type=0, .delay_ms=20, .channel=2, .note=33, .velocity=0 },
-    { .type=1, .delay_ms=104, .channel=2, .note=33, .velocity=86 },
-    { .type=1, .delay_ms=0, .channel=9, .note=53, .velocity=125 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=121 },
-    { .type=0, .delay_ms=29, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=62, .channel=9, .note=36, .velocity=120 },
-    { .type=0, .delay_ms=25, .channel=2, .note=33, .velocity=0 },
-    { .type=0, .delay_ms=62, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=41, .channel=2, .note=33, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=53, .velocity=125 },
-    { .type=0, .delay_ms=37, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=45, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=83, .channel=2, .note=33, .velocity=0 },
-    { .type=0, .delay_ms=83, .channel=0, .note=45, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=45, .velocity=0 },
-    { .type=1, .delay_ms=12, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=80 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=57, .velocity=79 },
-    { .type=0, .delay_ms=20, .channel=0, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=59, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=9, .note=57, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=29, .channel=0, .note=40, .velocity=107 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=107 },
-    { .type=0, .delay_ms=20, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=104, .channel=9, .note=53, .velocity=125 },
-    { .type=1, .delay_ms=8, .channel=0, .note=52, .velocity=113 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=83 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=121 },
-    { .type=1, .delay_ms=4, .channel=1, .note=55, .velocity=113 },
-    { .type=0, .delay_ms=16, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=0, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=4, .channel=0, .note=40, .velocity=105 },
-    { .type=0, .delay_ms=0, .channel=1, .note=55, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=105 },
-    { .type=0, .delay_ms=33, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=83 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=0, .channel=9, .note=53, .velocity=125 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=25, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=37, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=62, .channel=0, .note=50, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=115 },
-    { .type=1, .delay_ms=4, .channel=1, .note=54, .velocity=110 },
-    { .type=0, .delay_ms=16, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=58, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=33, .channel=9, .note=53, .velocity=124 },
-    { .type=1, .delay_ms=12, .channel=0, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=0, .channel=0, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=83 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=123 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=0, .channel=1, .note=54, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=37, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=9, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=54, .channel=0, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=114 },
-    { .type=0, .delay_ms=33, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=83, .channel=9, .note=53, .velocity=124 },
-    { .type=1, .delay_ms=8, .channel=0, .note=48, .velocity=118 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=77 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=4, .channel=1, .note=51, .velocity=118 },
-    { .type=0, .delay_ms=8, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=70, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=33, .channel=0, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=40, .velocity=106 },
-    { .type=0, .delay_ms=8, .channel=1, .note=51, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=106 },
-    { .type=0, .delay_ms=29, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=75, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=74 },
-    { .type=1, .delay_ms=0, .channel=9, .note=53, .velocity=125 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=108 },
-    { .type=0, .delay_ms=20, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=62, .channel=9, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=45, .channel=0, .note=46, .velocity=115 },
-    { .type=1, .delay_ms=0, .channel=1, .note=50, .velocity=115 },
-    { .type=0, .delay_ms=8, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=104, .channel=9, .note=53, .velocity=125 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=0, .delay_ms=12, .channel=0, .note=46, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=50, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=12, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=45, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=37, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=29, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=95, .channel=0, .note=47, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=83 },
-    { .type=1, .delay_ms=0, .channel=9, .note=53, .velocity=119 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=1, .delay_ms=8, .channel=1, .note=50, .velocity=110 },
-    { .type=0, .delay_ms=12, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=70, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=0, .note=47, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=48, .velocity=111 },
-    { .type=0, .delay_ms=8, .channel=1, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=52, .velocity=111 },
-    { .type=0, .delay_ms=25, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=50, .channel=0, .note=48, .velocity=0 },
-    { .type=1, .delay_ms=8, .channel=0, .note=40, .velocity=110 },
-    { .type=0, .delay_ms=0, .channel=1, .note=52, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=86 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=123 },
-    { .type=1, .delay_ms=0, .channel=9, .note=53, .velocity=124 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=110 },
-    { .type=0, .delay_ms=20, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=20, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=50, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=33, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=108 },
-    { .type=0, .delay_ms=12, .channel=2, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=112, .channel=0, .note=52, .velocity=117 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=98 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=123 },
-    { .type=1, .delay_ms=8, .channel=1, .note=55, .velocity=117 },
-    { .type=1, .delay_ms=0, .channel=9, .note=53, .velocity=125 },
-    { .type=0, .delay_ms=25, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=62, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=29, .channel=0, .note=40, .velocity=111 },
-    { .type=1, .delay_ms=4, .channel=1, .note=40, .velocity=111 },
-    { .type=0, .delay_ms=16, .channel=0, .note=52, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=55, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=25, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=75, .channel=0, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=89 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=8, .channel=1, .note=40, .velocity=108 },
-    { .type=1, .delay_ms=0, .channel=9, .note=53, .velocity=124 },
-    { .type=0, .delay_ms=29, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=54, .channel=0, .note=50, .velocity=110 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=122 },
-    { .type=1, .delay_ms=8, .channel=1, .note=54, .velocity=110 },
-    { .type=0, .delay_ms=25, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=50, .channel=9, .note=36, .velocity=0 },
-    { .type=1, .delay_ms=41, .channel=9, .note=53, .velocity=125 },
-    { .type=0, .delay_ms=4, .channel=0, .note=50, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=40, .velocity=114 },
-    { .type=0, .delay_ms=0, .channel=1, .note=54, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=114 },
-    { .type=1, .delay_ms=0, .channel=2, .note=40, .velocity=104 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=120 },
-    { .type=0, .delay_ms=20, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=16, .channel=0, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=41, .channel=9, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=50, .channel=0, .note=40, .velocity=115 },
-    { .type=1, .delay_ms=0, .channel=1, .note=40, .velocity=115 },
-    { .type=0, .delay_ms=54, .channel=2, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=79, .channel=0, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=71, .velocity=112 },
-    { .type=1, .delay_ms=0, .channel=2, .note=28, .velocity=104 },
-    { .type=1, .delay_ms=0, .channel=9, .note=38, .velocity=116 },
-    { .type=1, .delay_ms=0, .channel=9, .note=36, .velocity=99 },
-    { .type=1, .delay_ms=0, .channel=9, .note=53, .velocity=125 },
-    { .type=0, .delay_ms=4, .channel=1, .note=40, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=69, .velocity=112 },
-    { .type=1, .delay_ms=0, .channel=9, .note=40, .velocity=122 },
-    { .type=0, .delay_ms=20, .channel=9, .note=36, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=38, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=9, .note=53, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=9, .note=40, .velocity=0 },
-    { .type=0, .delay_ms=29, .channel=0, .note=71, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=69, .velocity=105 },
-    { .type=0, .delay_ms=4, .channel=1, .note=69, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=66, .velocity=105 },
-    { .type=0, .delay_ms=62, .channel=0, .note=69, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=66, .velocity=112 },
-    { .type=0, .delay_ms=0, .channel=2, .note=28, .velocity=0 },
-    { .type=0, .delay_ms=8, .channel=1, .note=66, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=63, .velocity=112 },
-    { .type=0, .delay_ms=54, .channel=0, .note=66, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=63, .velocity=103 },
-    { .type=0, .delay_ms=8, .channel=1, .note=63, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=59, .velocity=103 },
-    { .type=0, .delay_ms=62, .channel=0, .note=63, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=59, .velocity=111 },
-    { .type=0, .delay_ms=8, .channel=1, .note=59, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=57, .velocity=111 },
-    { .type=0, .delay_ms=54, .channel=0, .note=59, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=57, .velocity=102 },
-    { .type=0, .delay_ms=8, .channel=1, .note=57, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=54, .velocity=102 },
-    { .type=0, .delay_ms=62, .channel=0, .note=57, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=54, .velocity=113 },
-    { .type=0, .delay_ms=4, .channel=1, .note=54, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=51, .velocity=113 },
-    { .type=0, .delay_ms=62, .channel=0, .note=54, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=51, .velocity=103 },
-    { .type=0, .delay_ms=0, .channel=1, .note=51, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=47, .velocity=103 },
-    { .type=0, .delay_ms=62, .channel=0, .note=51, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=75, .velocity=111 },
-    { .type=0, .delay_ms=8, .channel=1, .note=47, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=71, .velocity=111 },
-    { .type=0, .delay_ms=62, .channel=0, .note=75, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=73, .velocity=101 },
-    { .type=0, .delay_ms=0, .channel=1, .note=71, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=69, .velocity=101 },
-    { .type=0, .delay_ms=62, .channel=0, .note=73, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=71, .velocity=112 },
-    { .type=0, .delay_ms=8, .channel=1, .note=69, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=66, .velocity=112 },
-    { .type=0, .delay_ms=62, .channel=0, .note=71, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=69, .velocity=103 },
-    { .type=0, .delay_ms=4, .channel=1, .note=66, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=63, .velocity=103 },
-    { .type=0, .delay_ms=58, .channel=0, .note=69, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=66, .velocity=110 },
-    { .type=0, .delay_ms=4, .channel=1, .note=63, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=59, .velocity=110 },
-    { .type=0, .delay_ms=62, .channel=0, .note=66, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=63, .velocity=100 },
-    { .type=0, .delay_ms=8, .channel=1, .note=59, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=57, .velocity=100 },
-    { .type=0, .delay_ms=54, .channel=0, .note=63, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=59, .velocity=113 },
-    { .type=0, .delay_ms=8, .channel=1, .note=57, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=54, .velocity=113 },
-    { .type=0, .delay_ms=62, .channel=0, .note=59, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=0, .note=57, .velocity=103 },
-    { .type=0, .delay_ms=8, .channel=1, .note=54, .velocity=0 },
-    { .type=1, .delay_ms=0, .channel=1, .note=51, .velocity=103 },
-    { .type=0, .delay_ms=54, .channel=0, .note=57, .velocity=0 },
-    { .type=0, .delay_ms=0, .channel=1, .note=51, .velocity=0 },
-    { .type=2, .delay_ms=0 } // End
+// Converted at 500 PPQ, 120 BPM: one tick is exactly one millisecond
+#define MIDI_SONG_PPQ 500
+
+const TempoChange midi_song_tempo[] = {
+    { .tick=0, .us_per_quarter=500000 },
+};
+
+const SongTickEvent midi_song[] = {
+    { .type=3, .delta_ticks=0, .channel=0, .note=30, .velocity=0 },
+    { .type=3, .delta_ticks=0, .channel=1, .note=29, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=108 },
+    { .type=3, .delta_ticks=0, .channel=2, .note=34, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=120 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=115 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=41, .velocity=120 },
+    { .type=0, .delta_ticks=41, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=45, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=1, .note=40, .velocity=114 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=41, .velocity=0 },
+    { .type=1, .delta_ticks=116, .channel=1, .note=52, .velocity=114 },
+    { .type=0, .delta_ticks=20, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=112, .channel=1, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=110 },
+    { .type=0, .delta_ticks=41, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=91, .channel=1, .note=40, .velocity=110 },
+    { .type=1, .delta_ticks=133, .channel=1, .note=50, .velocity=111 },
+    { .type=0, .delta_ticks=12, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=104, .channel=1, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=1, .note=40, .velocity=104 },
+    { .type=0, .delta_ticks=41, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=91, .channel=1, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=133, .channel=1, .note=48, .velocity=116 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=125, .channel=1, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=108 },
+    { .type=0, .delta_ticks=41, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=91, .channel=1, .note=40, .velocity=110 },
+    { .type=1, .delta_ticks=133, .channel=1, .note=46, .velocity=110 },
+    { .type=0, .delta_ticks=12, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=116, .channel=1, .note=46, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=110 },
+    { .type=0, .delta_ticks=58, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=75, .channel=1, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=137, .channel=1, .note=47, .velocity=110 },
+    { .type=0, .delta_ticks=125, .channel=1, .note=47, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=48, .velocity=117 },
+    { .type=0, .delta_ticks=91, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=25, .channel=1, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=2, .note=40, .velocity=127 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=41, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=123 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=25, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=70, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=41, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=133, .channel=1, .note=52, .velocity=114 },
+    { .type=0, .delta_ticks=29, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=87, .channel=1, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=16, .channel=1, .note=40, .velocity=106 },
+    { .type=0, .delta_ticks=41, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=87, .channel=1, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=133, .channel=1, .note=50, .velocity=106 },
+    { .type=0, .delta_ticks=20, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=112, .channel=1, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=114 },
+    { .type=0, .delta_ticks=41, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=87, .channel=1, .note=40, .velocity=106 },
+    { .type=0, .delta_ticks=133, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=48, .velocity=117 },
+    { .type=0, .delta_ticks=112, .channel=1, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=25, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=50, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=1, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=133, .channel=1, .note=46, .velocity=114 },
+    { .type=0, .delta_ticks=645, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=2, .note=40, .velocity=127 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=41, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=123 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=108 },
+    { .type=0, .delta_ticks=20, .channel=1, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=41, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=1, .note=40, .velocity=107 },
+    { .type=1, .delta_ticks=129, .channel=1, .note=52, .velocity=113 },
+    { .type=0, .delta_ticks=62, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=70, .channel=1, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=105 },
+    { .type=0, .delta_ticks=50, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=87, .channel=1, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=133, .channel=1, .note=50, .velocity=110 },
+    { .type=0, .delta_ticks=20, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=112, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=50, .velocity=0 },
+    { .type=0, .delta_ticks=54, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=75, .channel=1, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=133, .channel=1, .note=48, .velocity=118 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=116, .channel=1, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=106 },
+    { .type=0, .delta_ticks=41, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=87, .channel=1, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=133, .channel=1, .note=46, .velocity=115 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=125, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=20, .channel=1, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=87, .channel=1, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=133, .channel=1, .note=47, .velocity=110 },
+    { .type=0, .delta_ticks=133, .channel=1, .note=47, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=48, .velocity=111 },
+    { .type=0, .delta_ticks=70, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=54, .channel=1, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=127 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=119 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=41, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=119 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=110 },
+    { .type=0, .delta_ticks=41, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=50, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=41, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=9, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=16, .channel=1, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=129, .channel=1, .note=52, .velocity=117 },
+    { .type=0, .delta_ticks=100, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=33, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=12, .channel=1, .note=52, .velocity=0 },
+    { .type=0, .delta_ticks=37, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=1, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=129, .channel=1, .note=50, .velocity=110 },
+    { .type=0, .delta_ticks=37, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=95, .channel=1, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=114 },
+    { .type=0, .delta_ticks=41, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=91, .channel=1, .note=40, .velocity=115 },
+    { .type=0, .delta_ticks=129, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=48, .velocity=117 },
+    { .type=1, .delta_ticks=133, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=50, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=1, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=66, .channel=1, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=133, .channel=1, .note=46, .velocity=114 },
+    { .type=0, .delta_ticks=645, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=41, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=57, .velocity=61 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=49, .velocity=71 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=46, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=108 },
+    { .type=0, .delta_ticks=37, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=57, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=9, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=41, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=62, .channel=9, .note=57, .velocity=23 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=49, .velocity=23 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=57, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=49, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=52, .velocity=114 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=52, .velocity=114 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=104, .channel=0, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=40, .velocity=110 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=110 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=91, .channel=0, .note=40, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=110 },
+    { .type=1, .delta_ticks=133, .channel=0, .note=50, .velocity=111 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=50, .velocity=111 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=95, .channel=0, .note=50, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=40, .velocity=104 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=104 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=48, .velocity=116 },
+    { .type=0, .delta_ticks=0, .channel=0, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=48, .velocity=116 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=120, .channel=0, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=40, .velocity=108 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=108 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=110 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=110 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=46, .velocity=110 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=46, .velocity=110 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=108, .channel=0, .note=46, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=40, .velocity=110 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=46, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=110 },
+    { .type=0, .delta_ticks=50, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=70, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=129, .channel=0, .note=47, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=47, .velocity=110 },
+    { .type=0, .delta_ticks=125, .channel=0, .note=47, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=48, .velocity=117 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=47, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=48, .velocity=117 },
+    { .type=0, .delta_ticks=91, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=25, .channel=0, .note=48, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=16, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=125 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=41, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=57, .velocity=64 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=49, .velocity=70 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=58, .channel=9, .note=57, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=41, .velocity=0 },
+    { .type=1, .delta_ticks=33, .channel=0, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=0, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=54, .channel=9, .note=57, .velocity=23 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=49, .velocity=23 },
+    { .type=0, .delta_ticks=50, .channel=9, .note=57, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=49, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=52, .velocity=114 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=52, .velocity=114 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=83, .channel=0, .note=52, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=106 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=106 },
+    { .type=0, .delta_ticks=37, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=50, .velocity=106 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=50, .velocity=106 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=104, .channel=0, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=40, .velocity=114 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=114 },
+    { .type=0, .delta_ticks=37, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=106 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=106 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=48, .velocity=117 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=48, .velocity=117 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=100, .channel=0, .note=48, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=50, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=133, .channel=0, .note=46, .velocity=114 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=46, .velocity=114 },
+    { .type=0, .delta_ticks=641, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=125 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=121 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=41, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=49, .velocity=74 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=57, .velocity=56 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=108 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=57, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=41, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=9, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=16, .channel=0, .note=40, .velocity=107 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=107 },
+    { .type=0, .delta_ticks=8, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=54, .channel=9, .note=49, .velocity=23 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=57, .velocity=23 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=57, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=52, .velocity=113 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=52, .velocity=113 },
+    { .type=0, .delta_ticks=54, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=40, .velocity=105 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=105 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=133, .channel=0, .note=50, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=50, .velocity=110 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=112, .channel=0, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=0, .channel=0, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=50, .velocity=0 },
+    { .type=0, .delta_ticks=50, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=75, .channel=0, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=48, .velocity=118 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=48, .velocity=118 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=112, .channel=0, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=106 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=106 },
+    { .type=0, .delta_ticks=37, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=46, .velocity=115 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=46, .velocity=115 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=120, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=16, .channel=0, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=47, .velocity=110 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=47, .velocity=110 },
+    { .type=0, .delta_ticks=125, .channel=0, .note=47, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=48, .velocity=111 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=47, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=48, .velocity=111 },
+    { .type=0, .delta_ticks=70, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=45, .channel=0, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=110 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=116 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=41, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=49, .velocity=74 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=57, .velocity=68 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=57, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=41, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=108 },
+    { .type=0, .delta_ticks=41, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=16, .channel=9, .note=49, .velocity=23 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=57, .velocity=23 },
+    { .type=0, .delta_ticks=45, .channel=9, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=57, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=52, .velocity=117 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=52, .velocity=117 },
+    { .type=0, .delta_ticks=91, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=29, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=4, .channel=0, .note=52, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=52, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=79, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=50, .velocity=110 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=50, .velocity=110 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=91, .channel=0, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=40, .velocity=114 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=114 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=115 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=115 },
+    { .type=0, .delta_ticks=79, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=45, .channel=0, .note=63, .velocity=112 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=41, .velocity=91 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=90 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=93 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=66, .velocity=112 },
+    { .type=0, .delta_ticks=54, .channel=9, .note=41, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=63, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=60, .velocity=105 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=66, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=64, .velocity=105 },
+    { .type=0, .delta_ticks=54, .channel=0, .note=60, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=59, .velocity=112 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=85 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=41, .velocity=93 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=81 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=63, .velocity=112 },
+    { .type=0, .delta_ticks=45, .channel=9, .note=41, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=59, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=63, .velocity=103 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=63, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=66, .velocity=103 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=63, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=66, .velocity=111 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=66, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=69, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=88 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=88 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=41, .velocity=90 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=66, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=64, .velocity=102 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=41, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=69, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=67, .velocity=102 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=63, .velocity=113 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=67, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=66, .velocity=113 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=88 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=41, .velocity=91 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=73 },
+    { .type=0, .delta_ticks=54, .channel=9, .note=41, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=63, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=59, .velocity=103 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=66, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=63, .velocity=103 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=59, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=63, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=93 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=41, .velocity=88 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=88 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=63, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=66, .velocity=111 },
+    { .type=0, .delta_ticks=50, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=63, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=64, .velocity=101 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=41, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=66, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=67, .velocity=101 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=66, .velocity=112 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=93 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=82 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=41, .velocity=87 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=67, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=69, .velocity=112 },
+    { .type=0, .delta_ticks=54, .channel=0, .note=66, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=67, .velocity=103 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=41, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=69, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=71, .velocity=103 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=67, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=66, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=91 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=91 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=41, .velocity=93 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=71, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=69, .velocity=110 },
+    { .type=0, .delta_ticks=45, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=66, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=64, .velocity=100 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=41, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=69, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=67, .velocity=100 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=63, .velocity=113 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=93 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=41, .velocity=93 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=90 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=67, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=66, .velocity=113 },
+    { .type=0, .delta_ticks=58, .channel=9, .note=41, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=0, .note=63, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=59, .velocity=103 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=66, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=63, .velocity=103 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=59, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=86 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=118 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=63, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=72 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=58, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=52, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=118 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=52, .velocity=114 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=46, .velocity=85 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=62, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=25, .channel=0, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=40, .velocity=110 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=110 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=86 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=116 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=110 },
+    { .type=1, .delta_ticks=12, .channel=9, .note=46, .velocity=81 },
+    { .type=0, .delta_ticks=54, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=37, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=9, .note=46, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=50, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=50, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=118 },
+    { .type=0, .delta_ticks=16, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=62, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=37, .channel=0, .note=50, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=40, .velocity=104 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=104 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=123 },
+    { .type=1, .delta_ticks=12, .channel=9, .note=46, .velocity=81 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=46, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=48, .velocity=116 },
+    { .type=0, .delta_ticks=0, .channel=0, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=123 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=48, .velocity=116 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=75 },
+    { .type=0, .delta_ticks=95, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=108 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=108 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=117 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=110 },
+    { .type=1, .delta_ticks=16, .channel=9, .note=46, .velocity=72 },
+    { .type=0, .delta_ticks=66, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=46, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=46, .velocity=110 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=46, .velocity=110 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=108, .channel=0, .note=46, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=110 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=46, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=83 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=116 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=110 },
+    { .type=1, .delta_ticks=4, .channel=9, .note=46, .velocity=75 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=121 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=79, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=45, .channel=0, .note=47, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=83 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=47, .velocity=110 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=46, .velocity=78 },
+    { .type=0, .delta_ticks=66, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=47, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=48, .velocity=117 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=47, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=48, .velocity=117 },
+    { .type=0, .delta_ticks=83, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=48, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=46, .velocity=68 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=70, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=133, .channel=0, .note=52, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=121 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=52, .velocity=114 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=46, .velocity=72 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=50, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=52, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=40, .velocity=106 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=106 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=116 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=20, .channel=9, .note=46, .velocity=65 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=46, .velocity=0 },
+    { .type=1, .delta_ticks=16, .channel=0, .note=50, .velocity=106 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=117 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=50, .velocity=106 },
+    { .type=0, .delta_ticks=16, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=62, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=45, .channel=0, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=83 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=12, .channel=9, .note=46, .velocity=75 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=40, .velocity=106 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=106 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=48, .velocity=117 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=75 },
+    { .type=0, .delta_ticks=4, .channel=0, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=48, .velocity=117 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=75, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=48, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=75, .channel=0, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=117 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=69 },
+    { .type=0, .delta_ticks=83, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=25, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=46, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=46, .velocity=114 },
+    { .type=1, .delta_ticks=124, .channel=9, .note=46, .velocity=73 },
+    { .type=1, .delta_ticks=8, .channel=2, .note=40, .velocity=86 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=121 },
+    { .type=0, .delta_ticks=70, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=9, .note=36, .velocity=120 },
+    { .type=0, .delta_ticks=83, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=45, .channel=2, .note=40, .velocity=71 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=46, .velocity=71 },
+    { .type=0, .delta_ticks=75, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=129, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=46, .velocity=75 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=77 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=108 },
+    { .type=0, .delta_ticks=16, .channel=0, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=37, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=40, .velocity=107 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=107 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=52, .velocity=113 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=69 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=121 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=52, .velocity=113 },
+    { .type=0, .delta_ticks=54, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=40, .velocity=105 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=105 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=79 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=70, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=50, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=115 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=50, .velocity=110 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=54, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=50, .channel=9, .note=46, .velocity=71 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=0, .channel=0, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=123 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=50, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=133, .channel=0, .note=48, .velocity=118 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=98 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=0, .delta_ticks=4, .channel=0, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=48, .velocity=118 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=65 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=83, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=0, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=40, .velocity=106 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=106 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=75 },
+    { .type=0, .delta_ticks=83, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=25, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=16, .channel=0, .note=46, .velocity=115 },
+    { .type=0, .delta_ticks=4, .channel=0, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=46, .velocity=115 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=116, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=86 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=72 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=29, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=47, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=47, .velocity=110 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=46, .velocity=71 },
+    { .type=0, .delta_ticks=75, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=0, .note=47, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=48, .velocity=111 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=47, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=48, .velocity=111 },
+    { .type=0, .delta_ticks=70, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=50, .channel=0, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=40, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=123 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=72 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=37, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=125, .channel=9, .note=46, .velocity=73 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=52, .velocity=117 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=52, .velocity=117 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=83 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=123 },
+    { .type=0, .delta_ticks=75, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=52, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=52, .velocity=0 },
+    { .type=0, .delta_ticks=25, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=79, .channel=9, .note=46, .velocity=71 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=108 },
+    { .type=0, .delta_ticks=62, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=50, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=50, .velocity=110 },
+    { .type=0, .delta_ticks=25, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=50, .channel=0, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=98 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=120 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=73 },
+    { .type=0, .delta_ticks=37, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=115 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=115 },
+    { .type=0, .delta_ticks=70, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=50, .channel=0, .note=67, .velocity=112 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=104 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=82 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=71, .velocity=112 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=50, .velocity=91 },
+    { .type=1, .delta_ticks=4, .channel=9, .note=40, .velocity=82 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=9, .note=50, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=0, .note=67, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=64, .velocity=105 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=71, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=67, .velocity=105 },
+    { .type=0, .delta_ticks=41, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=0, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=59, .velocity=112 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=92 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=67, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=64, .velocity=112 },
+    { .type=0, .delta_ticks=37, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=25, .channel=0, .note=59, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=64, .velocity=103 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=67, .velocity=103 },
+    { .type=0, .delta_ticks=54, .channel=0, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=67, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=98 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=92 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=67, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=71, .velocity=111 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=40, .velocity=85 },
+    { .type=1, .delta_ticks=4, .channel=9, .note=47, .velocity=85 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=47, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=67, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=64, .velocity=102 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=71, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=67, .velocity=102 },
+    { .type=0, .delta_ticks=33, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=67, .velocity=113 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=93 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=67, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=71, .velocity=113 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=67, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=71, .velocity=103 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=71, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=76, .velocity=103 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=71, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=67, .velocity=111 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=76, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=71, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=87 },
+    { .type=1, .delta_ticks=20, .channel=9, .note=45, .velocity=93 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=40, .velocity=91 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=67, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=64, .velocity=101 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=71, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=67, .velocity=101 },
+    { .type=0, .delta_ticks=33, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=67, .velocity=112 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=67, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=71, .velocity=112 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=93 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=67, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=64, .velocity=103 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=71, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=67, .velocity=103 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=67, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=104 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=93 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=67, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=71, .velocity=110 },
+    { .type=1, .delta_ticks=16, .channel=9, .note=40, .velocity=90 },
+    { .type=1, .delta_ticks=4, .channel=9, .note=41, .velocity=73 },
+    { .type=0, .delta_ticks=16, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=67, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=71, .velocity=100 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=41, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=71, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=76, .velocity=100 },
+    { .type=0, .delta_ticks=37, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=25, .channel=0, .note=71, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=76, .velocity=113 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=93 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=76, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=79, .velocity=113 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=40, .velocity=91 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=41, .velocity=88 },
+    { .type=0, .delta_ticks=25, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=76, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=79, .velocity=103 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=41, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=79, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=83, .velocity=103 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=79, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=45, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=86 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=118 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=112 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=83, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=45, .velocity=108 },
+    { .type=0, .delta_ticks=25, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=2, .note=33, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=45, .velocity=114 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=45, .velocity=114 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=57, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=118 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=116 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=57, .velocity=114 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=2, .note=33, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=57, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=45, .velocity=110 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=57, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=45, .velocity=110 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=45, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=86 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=116 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=116 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=45, .velocity=110 },
+    { .type=0, .delta_ticks=62, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=25, .channel=0, .note=55, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=118 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=55, .velocity=111 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=62, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=55, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=55, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=45, .velocity=104 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=110 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=45, .velocity=104 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=25, .channel=0, .note=45, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=45, .velocity=111 },
+    { .type=1, .delta_ticks=133, .channel=0, .note=53, .velocity=116 },
+    { .type=0, .delta_ticks=0, .channel=0, .note=45, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=53, .velocity=116 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=117 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=75, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=2, .note=33, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=53, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=45, .velocity=108 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=53, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=45, .velocity=108 },
+    { .type=0, .delta_ticks=37, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=45, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=45, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=117 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=119 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=45, .velocity=110 },
+    { .type=0, .delta_ticks=75, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=51, .velocity=110 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=45, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=51, .velocity=110 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=112, .channel=0, .note=51, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=45, .velocity=110 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=51, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=83 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=116 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=111 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=45, .velocity=110 },
+    { .type=0, .delta_ticks=50, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=45, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=121 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=45, .velocity=111 },
+    { .type=0, .delta_ticks=75, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=50, .channel=0, .note=52, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=83 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=111 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=52, .velocity=110 },
+    { .type=0, .delta_ticks=75, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=25, .channel=2, .note=33, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=0, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=53, .velocity=117 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=53, .velocity=117 },
+    { .type=0, .delta_ticks=83, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=53, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=45, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=108 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=45, .velocity=111 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=45, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=45, .velocity=111 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=45, .velocity=111 },
+    { .type=1, .delta_ticks=129, .channel=0, .note=57, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=57, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=121 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=111 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=50, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=33, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=57, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=57, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=45, .velocity=106 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=45, .velocity=106 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=45, .velocity=0 },
+    { .type=1, .delta_ticks=91, .channel=0, .note=45, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=116 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=101 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=45, .velocity=108 },
+    { .type=0, .delta_ticks=62, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=25, .channel=0, .note=55, .velocity=106 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=117 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=55, .velocity=106 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=58, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=54, .channel=0, .note=55, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=45, .velocity=114 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=55, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=83 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=112 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=45, .velocity=114 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=45, .velocity=106 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=45, .velocity=106 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=53, .velocity=117 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=105 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=45, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=53, .velocity=117 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=66, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=2, .note=33, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=53, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=45, .velocity=111 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=45, .velocity=111 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=45, .velocity=0 },
+    { .type=1, .delta_ticks=79, .channel=0, .note=45, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=117 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=108 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=45, .velocity=114 },
+    { .type=0, .delta_ticks=79, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=51, .velocity=114 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=51, .velocity=114 },
+    { .type=1, .delta_ticks=124, .channel=2, .note=33, .velocity=86 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=121 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=117 },
+    { .type=0, .delta_ticks=75, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=9, .note=36, .velocity=120 },
+    { .type=0, .delta_ticks=83, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=49, .channel=2, .note=33, .velocity=71 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=108 },
+    { .type=0, .delta_ticks=75, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=2, .note=33, .velocity=0 },
+    { .type=0, .delta_ticks=124, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=45, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=77 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=107 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=45, .velocity=108 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=45, .velocity=107 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=45, .velocity=107 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=57, .velocity=113 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=121 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=115 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=57, .velocity=113 },
+    { .type=0, .delta_ticks=50, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=25, .channel=2, .note=33, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=57, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=45, .velocity=105 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=57, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=45, .velocity=105 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=45, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=107 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=45, .velocity=111 },
+    { .type=0, .delta_ticks=66, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=25, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=16, .channel=0, .note=55, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=115 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=55, .velocity=110 },
+    { .type=0, .delta_ticks=16, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=58, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=45, .channel=0, .note=45, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=114 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=55, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=45, .velocity=111 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=55, .velocity=0 },
+    { .type=0, .delta_ticks=50, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=37, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=45, .velocity=114 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=45, .velocity=114 },
+    { .type=1, .delta_ticks=129, .channel=0, .note=53, .velocity=118 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=53, .velocity=118 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=98 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=110 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=66, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=2, .note=33, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=53, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=45, .velocity=106 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=53, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=45, .velocity=106 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=45, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=119 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=45, .velocity=108 },
+    { .type=0, .delta_ticks=70, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=51, .velocity=115 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=45, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=51, .velocity=115 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=1, .delta_ticks=116, .channel=0, .note=45, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=86 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=110 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=45, .velocity=111 },
+    { .type=0, .delta_ticks=4, .channel=0, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=29, .channel=0, .note=45, .velocity=111 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=45, .velocity=111 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=52, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=110 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=52, .velocity=110 },
+    { .type=0, .delta_ticks=75, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=33, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=53, .velocity=111 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=53, .velocity=111 },
+    { .type=0, .delta_ticks=66, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=50, .channel=0, .note=53, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=45, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=119 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=53, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=45, .velocity=110 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=45, .velocity=108 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=45, .velocity=108 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=57, .velocity=117 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=83 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=115 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=57, .velocity=117 },
+    { .type=0, .delta_ticks=75, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=45, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=45, .velocity=111 },
+    { .type=0, .delta_ticks=16, .channel=0, .note=57, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=57, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=45, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=45, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=119 },
+    { .type=0, .delta_ticks=70, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=25, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=16, .channel=0, .note=55, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=55, .velocity=110 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=45, .channel=0, .note=55, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=45, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=98 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=120 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=117 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=55, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=45, .velocity=114 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=45, .velocity=115 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=45, .velocity=115 },
+    { .type=0, .delta_ticks=66, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=1, .delta_ticks=50, .channel=0, .note=69, .velocity=112 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=104 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=113 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=64, .velocity=112 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=40, .velocity=82 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=69, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=65, .velocity=105 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=62, .velocity=105 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=88 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=33, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=65, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=64, .velocity=112 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=62, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=60, .velocity=112 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=79 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=69, .velocity=103 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=60, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=64, .velocity=103 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=69, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=64, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=98 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=93 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=60, .velocity=111 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=60, .velocity=102 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=60, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=57, .velocity=102 },
+    { .type=0, .delta_ticks=37, .channel=2, .note=33, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=60, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=64, .velocity=113 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=57, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=60, .velocity=113 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=88 },
+    { .type=0, .delta_ticks=16, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=45, .channel=0, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=69, .velocity=103 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=86 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=60, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=64, .velocity=103 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=69, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=72, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=92 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=69, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=93 },
+    { .type=0, .delta_ticks=29, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=72, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=69, .velocity=101 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=87 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=69, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=64, .velocity=101 },
+    { .type=0, .delta_ticks=25, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=2, .note=33, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=69, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=64, .velocity=112 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=60, .velocity=112 },
+    { .type=1, .delta_ticks=4, .channel=9, .note=36, .velocity=86 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=37, .channel=0, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=69, .velocity=103 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=60, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=64, .velocity=103 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=93 },
+    { .type=0, .delta_ticks=29, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=69, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=64, .velocity=110 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=60, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=104 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=40, .velocity=93 },
+    { .type=0, .delta_ticks=29, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=25, .channel=0, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=69, .velocity=100 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=60, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=64, .velocity=100 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=40, .velocity=88 },
+    { .type=0, .delta_ticks=25, .channel=2, .note=33, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=69, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=64, .velocity=113 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=60, .velocity=113 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=36, .velocity=93 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=60, .velocity=103 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=60, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=57, .velocity=103 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=60, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=86 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=118 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=72 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=57, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=108 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=54, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=25, .channel=0, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=52, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=118 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=52, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=85 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=70, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=110 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=110 },
+    { .type=0, .delta_ticks=37, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=86 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=116 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=110 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=46, .velocity=81 },
+    { .type=0, .delta_ticks=54, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=46, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=50, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=118 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=50, .velocity=111 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=70, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=25, .channel=0, .note=50, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=104 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=123 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=104 },
+    { .type=1, .delta_ticks=16, .channel=9, .note=46, .velocity=81 },
+    { .type=0, .delta_ticks=25, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=37, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=25, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=46, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=48, .velocity=116 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=123 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=48, .velocity=116 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=9, .note=46, .velocity=75 },
+    { .type=0, .delta_ticks=91, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=0, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=40, .velocity=108 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=108 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=117 },
+    { .type=1, .delta_ticks=12, .channel=9, .note=46, .velocity=72 },
+    { .type=0, .delta_ticks=70, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=46, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=46, .velocity=110 },
+    { .type=0, .delta_ticks=4, .channel=0, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=46, .velocity=110 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=112, .channel=0, .note=46, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=40, .velocity=110 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=46, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=83 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=116 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=75 },
+    { .type=0, .delta_ticks=50, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=121 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=66, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=58, .channel=0, .note=47, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=83 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=47, .velocity=110 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=46, .velocity=78 },
+    { .type=0, .delta_ticks=70, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=47, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=48, .velocity=117 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=47, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=48, .velocity=117 },
+    { .type=0, .delta_ticks=83, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=48, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=68 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=70, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=52, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=121 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=52, .velocity=114 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=46, .velocity=72 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=54, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=0, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=106 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=106 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=87, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=116 },
+    { .type=1, .delta_ticks=29, .channel=9, .note=46, .velocity=65 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=9, .note=46, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=50, .velocity=106 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=50, .velocity=106 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=117 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=54, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=50, .channel=0, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=114 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=83 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=16, .channel=9, .note=46, .velocity=75 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=37, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=106 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=106 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=48, .velocity=117 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=75 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=48, .velocity=117 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=79, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=48, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=16, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=75, .channel=0, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=117 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=69 },
+    { .type=0, .delta_ticks=83, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=46, .velocity=114 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=46, .velocity=114 },
+    { .type=1, .delta_ticks=124, .channel=2, .note=40, .velocity=86 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=73 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=121 },
+    { .type=0, .delta_ticks=66, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=9, .note=36, .velocity=120 },
+    { .type=0, .delta_ticks=91, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=41, .channel=2, .note=40, .velocity=71 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=12, .channel=9, .note=46, .velocity=71 },
+    { .type=0, .delta_ticks=70, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=133, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=9, .note=46, .velocity=75 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=77 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=107 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=107 },
+    { .type=1, .delta_ticks=120, .channel=9, .note=46, .velocity=69 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=52, .velocity=113 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=121 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=52, .velocity=113 },
+    { .type=0, .delta_ticks=50, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=105 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=105 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=79 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=70, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=50, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=115 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=50, .velocity=110 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=54, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=50, .channel=0, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=0, .channel=0, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=71 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=123 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=50, .velocity=0 },
+    { .type=0, .delta_ticks=45, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=48, .velocity=118 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=98 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=48, .velocity=118 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=65 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=79, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=40, .velocity=106 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=106 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=46, .velocity=75 },
+    { .type=0, .delta_ticks=83, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=46, .velocity=115 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=46, .velocity=115 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=86 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=72 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=37, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=25, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=47, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=47, .velocity=110 },
+    { .type=1, .delta_ticks=4, .channel=9, .note=46, .velocity=71 },
+    { .type=0, .delta_ticks=79, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=0, .note=47, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=48, .velocity=111 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=47, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=48, .velocity=111 },
+    { .type=0, .delta_ticks=70, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=45, .channel=0, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=40, .velocity=110 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=123 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=72 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=116, .channel=9, .note=46, .velocity=73 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=52, .velocity=117 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=83 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=123 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=52, .velocity=117 },
+    { .type=0, .delta_ticks=70, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=52, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=52, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=75, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=71 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=108 },
+    { .type=0, .delta_ticks=66, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=50, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=50, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=0, .delta_ticks=37, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=45, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=50, .channel=0, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=40, .velocity=114 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=98 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=120 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=46, .velocity=73 },
+    { .type=0, .delta_ticks=25, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=115 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=115 },
+    { .type=0, .delta_ticks=125, .channel=0, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=48, .velocity=117 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=104 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=38, .velocity=85 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=92 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=48, .velocity=117 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=38, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=100, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=86 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=48, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=45, .channel=9, .note=38, .velocity=82 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=98 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=38, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=114 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=100, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=9, .note=36, .velocity=91 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=46, .velocity=114 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=46, .velocity=114 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=116, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=38, .velocity=79 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=88 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=38, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=33, .channel=9, .note=38, .velocity=79 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=40, .velocity=90 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=38, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=9, .note=36, .velocity=93 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=104, .channel=9, .note=38, .velocity=87 },
+    { .type=1, .delta_ticks=4, .channel=2, .note=40, .velocity=104 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=93 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=38, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=95, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=9, .note=36, .velocity=93 },
+    { .type=0, .delta_ticks=16, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=108, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=46, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=49, .velocity=108 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=46, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=49, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=37, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=118 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=57, .velocity=79 },
+    { .type=0, .delta_ticks=37, .channel=0, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=57, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=29, .channel=0, .note=49, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=49, .velocity=114 },
+    { .type=0, .delta_ticks=0, .channel=2, .note=37, .velocity=0 },
+    { .type=1, .delta_ticks=125, .channel=9, .note=53, .velocity=123 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=61, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=37, .velocity=98 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=118 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=61, .velocity=114 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=62, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=37, .channel=0, .note=61, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=49, .velocity=110 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=61, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=49, .velocity=110 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=37, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=0, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=49, .velocity=0 },
+    { .type=1, .delta_ticks=75, .channel=9, .note=53, .velocity=125 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=49, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=37, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=116 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=49, .velocity=110 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=50, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=62, .channel=0, .note=59, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=118 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=59, .velocity=111 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=2, .note=37, .velocity=0 },
+    { .type=0, .delta_ticks=54, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=59, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=59, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=53, .velocity=122 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=49, .velocity=104 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=37, .velocity=104 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=123 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=49, .velocity=104 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=9, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=50, .channel=0, .note=49, .velocity=111 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=49, .velocity=111 },
+    { .type=0, .delta_ticks=12, .channel=2, .note=37, .velocity=0 },
+    { .type=1, .delta_ticks=112, .channel=0, .note=57, .velocity=116 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=37, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=53, .velocity=124 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=123 },
+    { .type=0, .delta_ticks=4, .channel=0, .note=49, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=57, .velocity=116 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=79, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=25, .channel=0, .note=57, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=49, .velocity=108 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=57, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=49, .velocity=108 },
+    { .type=0, .delta_ticks=12, .channel=2, .note=37, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=49, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=49, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=37, .velocity=104 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=117 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=49, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=53, .velocity=114 },
+    { .type=0, .delta_ticks=25, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=58, .channel=9, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=45, .channel=0, .note=55, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=55, .velocity=110 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=2, .note=37, .velocity=0 },
+    { .type=0, .delta_ticks=95, .channel=0, .note=55, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=49, .velocity=110 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=55, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=49, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=37, .velocity=104 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=116 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=53, .velocity=120 },
+    { .type=0, .delta_ticks=29, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=25, .channel=0, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=62, .channel=0, .note=49, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=121 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=49, .velocity=111 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=37, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=50, .channel=9, .note=53, .velocity=124 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=56, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=37, .velocity=98 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=56, .velocity=110 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=62, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=56, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=57, .velocity=117 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=56, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=57, .velocity=117 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=37, .velocity=0 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=57, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=57, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=47, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=35, .velocity=77 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=49, .velocity=79 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=47, .velocity=111 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=47, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=47, .velocity=0 },
+    { .type=0, .delta_ticks=62, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=49, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=47, .velocity=111 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=47, .velocity=111 },
+    { .type=0, .delta_ticks=33, .channel=2, .note=35, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=9, .note=53, .velocity=124 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=59, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=35, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=121 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=59, .velocity=114 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=47, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=47, .velocity=0 },
+    { .type=0, .delta_ticks=58, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=59, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=59, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=47, .velocity=106 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=47, .velocity=106 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=35, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=47, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=47, .velocity=0 },
+    { .type=1, .delta_ticks=79, .channel=9, .note=53, .velocity=119 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=47, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=35, .velocity=104 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=116 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=47, .velocity=108 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=62, .channel=0, .note=57, .velocity=106 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=117 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=57, .velocity=106 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=47, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=47, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=2, .note=35, .velocity=0 },
+    { .type=0, .delta_ticks=54, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=41, .channel=9, .note=53, .velocity=124 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=57, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=47, .velocity=114 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=57, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=47, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=35, .velocity=86 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=0, .delta_ticks=16, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=25, .channel=0, .note=47, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=47, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=9, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=50, .channel=0, .note=47, .velocity=106 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=47, .velocity=106 },
+    { .type=0, .delta_ticks=12, .channel=2, .note=35, .velocity=0 },
+    { .type=1, .delta_ticks=112, .channel=9, .note=53, .velocity=125 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=55, .velocity=117 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=98 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=123 },
+    { .type=0, .delta_ticks=4, .channel=0, .note=47, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=55, .velocity=117 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=47, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=79, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=0, .note=55, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=55, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=46, .velocity=111 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=46, .velocity=111 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=33, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=1, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=0, .note=46, .velocity=0 },
+    { .type=1, .delta_ticks=70, .channel=0, .note=45, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=98 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=53, .velocity=125 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=117 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=45, .velocity=114 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=54, .channel=9, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=50, .channel=0, .note=53, .velocity=114 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=53, .velocity=114 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=104, .channel=2, .note=33, .velocity=86 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=53, .velocity=125 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=121 },
+    { .type=0, .delta_ticks=29, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=62, .channel=9, .note=36, .velocity=120 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=33, .velocity=0 },
+    { .type=0, .delta_ticks=62, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=41, .channel=2, .note=33, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=53, .velocity=125 },
+    { .type=0, .delta_ticks=33, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=50, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=83, .channel=2, .note=33, .velocity=0 },
+    { .type=0, .delta_ticks=83, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=45, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=80 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=57, .velocity=79 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=108 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=37, .channel=9, .note=57, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=25, .channel=0, .note=40, .velocity=107 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=107 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=104, .channel=9, .note=53, .velocity=125 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=52, .velocity=113 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=52, .velocity=113 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=83 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=121 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=105 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=105 },
+    { .type=0, .delta_ticks=37, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=83 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=53, .velocity=125 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=29, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=62, .channel=0, .note=50, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=115 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=50, .velocity=110 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=54, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=33, .channel=9, .note=53, .velocity=124 },
+    { .type=1, .delta_ticks=16, .channel=0, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=0, .channel=0, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=83 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=123 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=50, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=54, .channel=0, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=114 },
+    { .type=0, .delta_ticks=33, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=9, .note=53, .velocity=124 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=48, .velocity=118 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=77 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=48, .velocity=118 },
+    { .type=0, .delta_ticks=4, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=66, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=37, .channel=0, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=40, .velocity=106 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=106 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=79, .channel=9, .note=53, .velocity=125 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=74 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=108 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=62, .channel=9, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=41, .channel=0, .note=46, .velocity=115 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=46, .velocity=115 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=104, .channel=9, .note=53, .velocity=125 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=0, .delta_ticks=16, .channel=0, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=50, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=33, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=33, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=100, .channel=0, .note=47, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=83 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=53, .velocity=119 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=47, .velocity=110 },
+    { .type=0, .delta_ticks=16, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=66, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=47, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=48, .velocity=111 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=47, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=48, .velocity=111 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=45, .channel=0, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=110 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=86 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=53, .velocity=124 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=110 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=45, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=37, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=108 },
+    { .type=0, .delta_ticks=16, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=108, .channel=0, .note=52, .velocity=117 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=98 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=123 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=52, .velocity=117 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=53, .velocity=125 },
+    { .type=0, .delta_ticks=29, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=29, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=52, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=52, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=79, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=53, .velocity=124 },
+    { .type=0, .delta_ticks=29, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=54, .channel=0, .note=50, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=50, .velocity=110 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=50, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=104 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=53, .velocity=125 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=120 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=114 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=9, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=54, .channel=0, .note=40, .velocity=115 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=115 },
+    { .type=0, .delta_ticks=58, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=75, .channel=0, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=67, .velocity=112 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=64, .velocity=112 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=28, .velocity=104 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=38, .velocity=116 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=99 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=53, .velocity=125 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=38, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=67, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=71, .velocity=105 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=67, .velocity=105 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=71, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=64, .velocity=112 },
+    { .type=0, .delta_ticks=0, .channel=2, .note=28, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=67, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=59, .velocity=112 },
+    { .type=0, .delta_ticks=58, .channel=0, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=59, .velocity=103 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=59, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=55, .velocity=103 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=59, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=67, .velocity=111 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=55, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=64, .velocity=111 },
+    { .type=0, .delta_ticks=54, .channel=0, .note=67, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=64, .velocity=102 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=59, .velocity=102 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=71, .velocity=113 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=59, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=67, .velocity=113 },
+    { .type=0, .delta_ticks=54, .channel=0, .note=71, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=67, .velocity=103 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=67, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=64, .velocity=103 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=67, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=71, .velocity=111 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=67, .velocity=111 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=71, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=67, .velocity=101 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=67, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=64, .velocity=101 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=67, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=64, .velocity=112 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=59, .velocity=112 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=59, .velocity=103 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=59, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=55, .velocity=103 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=59, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=67, .velocity=110 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=55, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=64, .velocity=110 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=67, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=71, .velocity=100 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=67, .velocity=100 },
+    { .type=0, .delta_ticks=58, .channel=0, .note=71, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=76, .velocity=113 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=67, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=71, .velocity=113 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=76, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=79, .velocity=103 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=71, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=76, .velocity=103 },
+    { .type=0, .delta_ticks=54, .channel=0, .note=79, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=41, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=57, .velocity=61 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=49, .velocity=71 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=76, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=108 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=57, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=41, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=62, .channel=9, .note=57, .velocity=23 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=49, .velocity=23 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=57, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=49, .velocity=0 },
+    { .type=1, .delta_ticks=25, .channel=0, .note=52, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=52, .velocity=114 },
+    { .type=0, .delta_ticks=16, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=104, .channel=0, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=110 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=110 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=91, .channel=0, .note=40, .velocity=110 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=110 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=50, .velocity=111 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=50, .velocity=111 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=100, .channel=0, .note=50, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=104 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=104 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=48, .velocity=116 },
+    { .type=0, .delta_ticks=0, .channel=0, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=48, .velocity=116 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=116, .channel=0, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=108 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=108 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=110 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=110 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=46, .velocity=110 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=46, .velocity=110 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=112, .channel=0, .note=46, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=40, .velocity=110 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=46, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=110 },
+    { .type=0, .delta_ticks=45, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=75, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=133, .channel=0, .note=47, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=47, .velocity=110 },
+    { .type=0, .delta_ticks=125, .channel=0, .note=47, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=48, .velocity=117 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=47, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=48, .velocity=117 },
+    { .type=0, .delta_ticks=83, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=48, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=125 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=41, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=57, .velocity=64 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=49, .velocity=70 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=62, .channel=9, .note=57, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=41, .velocity=0 },
+    { .type=1, .delta_ticks=33, .channel=0, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=0, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=54, .channel=9, .note=57, .velocity=23 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=49, .velocity=23 },
+    { .type=0, .delta_ticks=50, .channel=9, .note=57, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=49, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=52, .velocity=114 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=52, .velocity=114 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=83, .channel=0, .note=52, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=40, .velocity=106 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=106 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=50, .velocity=106 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=50, .velocity=106 },
+    { .type=0, .delta_ticks=16, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=104, .channel=0, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=40, .velocity=114 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=114 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=106 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=106 },
+    { .type=1, .delta_ticks=129, .channel=0, .note=48, .velocity=117 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=48, .velocity=117 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=95, .channel=0, .note=48, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=50, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=46, .velocity=114 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=46, .velocity=114 },
+    { .type=0, .delta_ticks=637, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=125 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=121 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=41, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=49, .velocity=74 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=57, .velocity=56 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=108 },
+    { .type=0, .delta_ticks=16, .channel=0, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=57, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=9, .note=41, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=40, .velocity=107 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=107 },
+    { .type=0, .delta_ticks=8, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=54, .channel=9, .note=49, .velocity=23 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=57, .velocity=23 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=57, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=52, .velocity=113 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=52, .velocity=113 },
+    { .type=0, .delta_ticks=54, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=40, .velocity=105 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=105 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=133, .channel=0, .note=50, .velocity=110 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=50, .velocity=110 },
+    { .type=0, .delta_ticks=16, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=104, .channel=0, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=0, .channel=0, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=50, .velocity=0 },
+    { .type=0, .delta_ticks=50, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=75, .channel=0, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=48, .velocity=118 },
+    { .type=0, .delta_ticks=4, .channel=0, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=48, .velocity=118 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=116, .channel=0, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=40, .velocity=106 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=106 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=46, .velocity=115 },
+    { .type=0, .delta_ticks=4, .channel=0, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=46, .velocity=115 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=116, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=129, .channel=0, .note=47, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=47, .velocity=110 },
+    { .type=0, .delta_ticks=125, .channel=0, .note=47, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=48, .velocity=111 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=47, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=48, .velocity=111 },
+    { .type=0, .delta_ticks=70, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=50, .channel=0, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=110 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=116 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=41, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=49, .velocity=74 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=57, .velocity=68 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=110 },
+    { .type=0, .delta_ticks=37, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=9, .note=57, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=9, .note=41, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=9, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=108 },
+    { .type=0, .delta_ticks=41, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=9, .note=49, .velocity=23 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=57, .velocity=23 },
+    { .type=0, .delta_ticks=50, .channel=9, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=57, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=52, .velocity=117 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=52, .velocity=117 },
+    { .type=0, .delta_ticks=87, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=29, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=52, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=52, .velocity=0 },
+    { .type=0, .delta_ticks=25, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=75, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=50, .velocity=110 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=50, .velocity=110 },
+    { .type=0, .delta_ticks=25, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=91, .channel=0, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=40, .velocity=114 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=114 },
+    { .type=0, .delta_ticks=37, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=115 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=115 },
+    { .type=0, .delta_ticks=75, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=41, .channel=0, .note=66, .velocity=112 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=41, .velocity=91 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=90 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=63, .velocity=112 },
+    { .type=0, .delta_ticks=54, .channel=9, .note=41, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=66, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=64, .velocity=105 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=63, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=60, .velocity=105 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=63, .velocity=112 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=60, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=59, .velocity=112 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=93 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=63, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=59, .velocity=103 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=59, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=54, .velocity=103 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=59, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=69, .velocity=111 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=54, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=66, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=88 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=41, .velocity=90 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=69, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=66, .velocity=102 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=41, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=66, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=63, .velocity=102 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=66, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=63, .velocity=113 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=88 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=63, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=59, .velocity=113 },
+    { .type=0, .delta_ticks=58, .channel=0, .note=63, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=59, .velocity=103 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=59, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=57, .velocity=103 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=59, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=71, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=93 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=41, .velocity=88 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=88 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=57, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=69, .velocity=111 },
+    { .type=0, .delta_ticks=50, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=0, .note=71, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=69, .velocity=101 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=41, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=69, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=66, .velocity=101 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=69, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=66, .velocity=112 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=93 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=82 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=41, .velocity=87 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=66, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=63, .velocity=112 },
+    { .type=0, .delta_ticks=54, .channel=0, .note=66, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=63, .velocity=103 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=41, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=63, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=59, .velocity=103 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=63, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=75, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=91 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=91 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=41, .velocity=93 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=59, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=71, .velocity=110 },
+    { .type=0, .delta_ticks=50, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=41, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=0, .note=75, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=73, .velocity=100 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=71, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=69, .velocity=100 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=73, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=71, .velocity=113 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=93 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=41, .velocity=93 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=90 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=69, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=66, .velocity=113 },
+    { .type=0, .delta_ticks=54, .channel=9, .note=41, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=71, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=69, .velocity=103 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=66, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=63, .velocity=103 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=69, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=86 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=118 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=63, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=72 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=54, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=52, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=118 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=55, .velocity=114 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=46, .velocity=85 },
+    { .type=0, .delta_ticks=4, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=62, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=40, .velocity=110 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=55, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=110 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=87, .channel=0, .note=40, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=86 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=116 },
+    { .type=1, .delta_ticks=16, .channel=9, .note=46, .velocity=81 },
+    { .type=0, .delta_ticks=54, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=46, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=50, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=54, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=118 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=62, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=50, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=54, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=104 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=123 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=104 },
+    { .type=1, .delta_ticks=16, .channel=9, .note=46, .velocity=81 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=37, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=9, .note=46, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=48, .velocity=116 },
+    { .type=0, .delta_ticks=0, .channel=0, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=123 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=51, .velocity=116 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=9, .note=46, .velocity=75 },
+    { .type=0, .delta_ticks=91, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=108 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=51, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=108 },
+    { .type=0, .delta_ticks=37, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=117 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=110 },
+    { .type=1, .delta_ticks=12, .channel=9, .note=46, .velocity=72 },
+    { .type=0, .delta_ticks=70, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=46, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=46, .velocity=110 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=50, .velocity=110 },
+    { .type=0, .delta_ticks=4, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=120, .channel=0, .note=46, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=40, .velocity=110 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=83 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=116 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=110 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=46, .velocity=75 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=37, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=121 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=75, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=50, .channel=0, .note=47, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=83 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=50, .velocity=110 },
+    { .type=1, .delta_ticks=4, .channel=9, .note=46, .velocity=78 },
+    { .type=0, .delta_ticks=70, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=0, .note=47, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=48, .velocity=117 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=52, .velocity=117 },
+    { .type=0, .delta_ticks=91, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=48, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=46, .velocity=68 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=66, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=52, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=121 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=55, .velocity=114 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=46, .velocity=72 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=45, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=52, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=55, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=106 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=106 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=116 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=20, .channel=9, .note=46, .velocity=65 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=46, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=50, .velocity=106 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=117 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=54, .velocity=106 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=54, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=50, .channel=0, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=83 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=54, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=12, .channel=9, .note=46, .velocity=75 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=16, .channel=0, .note=40, .velocity=106 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=106 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=48, .velocity=117 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=75 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=52, .velocity=117 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=75, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=48, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=117 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=69 },
+    { .type=0, .delta_ticks=83, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=46, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=49, .velocity=114 },
+    { .type=1, .delta_ticks=133, .channel=2, .note=40, .velocity=86 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=73 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=121 },
+    { .type=0, .delta_ticks=66, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=24, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=9, .note=36, .velocity=120 },
+    { .type=0, .delta_ticks=83, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=49, .channel=2, .note=40, .velocity=71 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=46, .velocity=71 },
+    { .type=0, .delta_ticks=75, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=133, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=77 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=75 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=49, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=108 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=107 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=107 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=52, .velocity=113 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=69 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=121 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=55, .velocity=113 },
+    { .type=0, .delta_ticks=58, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=40, .velocity=105 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=55, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=105 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=75, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=79 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=66, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=25, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=50, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=54, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=115 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=62, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=41, .channel=9, .note=46, .velocity=71 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=0, .channel=0, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=123 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=54, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=48, .velocity=118 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=98 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=51, .velocity=118 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=65 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=83, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=106 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=51, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=106 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=75 },
+    { .type=0, .delta_ticks=83, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=46, .velocity=115 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=50, .velocity=115 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=116, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=86 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=72 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=50, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=47, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=50, .velocity=110 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=46, .velocity=71 },
+    { .type=0, .delta_ticks=83, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=25, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=47, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=48, .velocity=111 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=52, .velocity=111 },
+    { .type=0, .delta_ticks=66, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=50, .channel=0, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=40, .velocity=110 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=72 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=125, .channel=9, .note=46, .velocity=73 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=52, .velocity=117 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=83 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=123 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=55, .velocity=117 },
+    { .type=0, .delta_ticks=70, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=52, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=55, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=71 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=108 },
+    { .type=0, .delta_ticks=62, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=25, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=16, .channel=0, .note=50, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=54, .velocity=110 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=45, .channel=0, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=98 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=120 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=54, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=73 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=115 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=115 },
+    { .type=0, .delta_ticks=75, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=50, .channel=0, .note=79, .velocity=103 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=104 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=82 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=76, .velocity=103 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=50, .velocity=91 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=40, .velocity=82 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=50, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=79, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=76, .velocity=113 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=76, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=71, .velocity=113 },
+    { .type=0, .delta_ticks=41, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=76, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=71, .velocity=100 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=92 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=71, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=67, .velocity=100 },
+    { .type=0, .delta_ticks=33, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=71, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=67, .velocity=110 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=67, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=64, .velocity=110 },
+    { .type=0, .delta_ticks=54, .channel=0, .note=67, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=76, .velocity=103 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=98 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=92 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=71, .velocity=103 },
+    { .type=1, .delta_ticks=4, .channel=9, .note=40, .velocity=85 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=47, .velocity=85 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=47, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=76, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=79, .velocity=112 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=71, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=76, .velocity=112 },
+    { .type=0, .delta_ticks=37, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=25, .channel=0, .note=79, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=76, .velocity=101 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=76, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=71, .velocity=101 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=93 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=76, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=71, .velocity=111 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=71, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=67, .velocity=111 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=71, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=67, .velocity=103 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=67, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=64, .velocity=103 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=87 },
+    { .type=1, .delta_ticks=20, .channel=9, .note=45, .velocity=93 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=40, .velocity=91 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=67, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=71, .velocity=113 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=67, .velocity=113 },
+    { .type=0, .delta_ticks=33, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=71, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=76, .velocity=102 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=93 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=67, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=71, .velocity=102 },
+    { .type=0, .delta_ticks=37, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=76, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=71, .velocity=111 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=71, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=67, .velocity=111 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=71, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=79, .velocity=103 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=104 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=93 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=67, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=76, .velocity=103 },
+    { .type=1, .delta_ticks=12, .channel=9, .note=40, .velocity=90 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=41, .velocity=73 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=0, .note=79, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=76, .velocity=112 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=41, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=76, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=71, .velocity=112 },
+    { .type=0, .delta_ticks=41, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=76, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=71, .velocity=105 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=93 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=71, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=67, .velocity=105 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=71, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=67, .velocity=112 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=67, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=64, .velocity=112 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=67, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=45, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=86 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=118 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=112 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=45, .velocity=108 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=2, .note=33, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=45, .velocity=114 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=45, .velocity=114 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=57, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=118 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=116 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=60, .velocity=114 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=45, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=2, .note=33, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=57, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=45, .velocity=110 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=60, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=45, .velocity=110 },
+    { .type=0, .delta_ticks=37, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=45, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=45, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=86 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=116 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=116 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=45, .velocity=110 },
+    { .type=0, .delta_ticks=70, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=55, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=118 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=59, .velocity=111 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=62, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=55, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=59, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=45, .velocity=104 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=45, .velocity=104 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=110 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=29, .channel=0, .note=45, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=45, .velocity=111 },
+    { .type=1, .delta_ticks=133, .channel=0, .note=53, .velocity=116 },
+    { .type=0, .delta_ticks=0, .channel=0, .note=45, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=117 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=56, .velocity=116 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=79, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=2, .note=33, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=0, .note=53, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=45, .velocity=108 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=56, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=45, .velocity=108 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=45, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=117 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=119 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=45, .velocity=110 },
+    { .type=0, .delta_ticks=75, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=51, .velocity=110 },
+    { .type=0, .delta_ticks=4, .channel=0, .note=45, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=55, .velocity=110 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=112, .channel=0, .note=51, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=45, .velocity=110 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=55, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=83 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=116 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=111 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=45, .velocity=110 },
+    { .type=0, .delta_ticks=50, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=45, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=121 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=45, .velocity=111 },
+    { .type=0, .delta_ticks=75, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=50, .channel=0, .note=52, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=83 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=111 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=55, .velocity=110 },
+    { .type=0, .delta_ticks=79, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=33, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=53, .velocity=117 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=55, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=57, .velocity=117 },
+    { .type=0, .delta_ticks=83, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=57, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=45, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=108 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=45, .velocity=111 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=50, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=45, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=45, .velocity=111 },
+    { .type=1, .delta_ticks=133, .channel=0, .note=57, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=60, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=121 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=111 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=45, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=33, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=0, .note=57, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=60, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=45, .velocity=106 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=45, .velocity=106 },
+    { .type=0, .delta_ticks=37, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=45, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=45, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=116 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=101 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=45, .velocity=108 },
+    { .type=0, .delta_ticks=62, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=29, .channel=0, .note=55, .velocity=106 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=117 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=59, .velocity=106 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=54, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=58, .channel=0, .note=55, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=45, .velocity=114 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=59, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=83 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=112 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=45, .velocity=114 },
+    { .type=0, .delta_ticks=37, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=37, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=45, .velocity=106 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=45, .velocity=106 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=53, .velocity=117 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=105 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=45, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=57, .velocity=117 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=70, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=2, .note=33, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=57, .velocity=0 },
+    { .type=1, .delta_ticks=16, .channel=0, .note=45, .velocity=111 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=45, .velocity=111 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=1, .delta_ticks=75, .channel=0, .note=45, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=117 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=108 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=45, .velocity=114 },
+    { .type=0, .delta_ticks=75, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=51, .velocity=114 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=55, .velocity=114 },
+    { .type=1, .delta_ticks=129, .channel=2, .note=33, .velocity=86 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=121 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=117 },
+    { .type=0, .delta_ticks=70, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=9, .note=36, .velocity=120 },
+    { .type=0, .delta_ticks=83, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=49, .channel=2, .note=33, .velocity=71 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=108 },
+    { .type=0, .delta_ticks=83, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=2, .note=33, .velocity=0 },
+    { .type=0, .delta_ticks=133, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=45, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=45, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=77 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=107 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=45, .velocity=108 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=55, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=45, .velocity=107 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=45, .velocity=107 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=57, .velocity=113 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=121 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=115 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=60, .velocity=113 },
+    { .type=0, .delta_ticks=50, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=33, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=57, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=45, .velocity=105 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=60, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=45, .velocity=105 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=45, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=45, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=107 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=45, .velocity=111 },
+    { .type=0, .delta_ticks=70, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=55, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=115 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=59, .velocity=110 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=54, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=50, .channel=0, .note=45, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=114 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=55, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=45, .velocity=111 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=59, .velocity=0 },
+    { .type=0, .delta_ticks=45, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=45, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=45, .velocity=114 },
+    { .type=1, .delta_ticks=133, .channel=0, .note=53, .velocity=118 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=56, .velocity=118 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=98 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=110 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=70, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=2, .note=33, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=53, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=45, .velocity=106 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=56, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=45, .velocity=106 },
+    { .type=0, .delta_ticks=37, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=45, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=45, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=119 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=45, .velocity=108 },
+    { .type=0, .delta_ticks=70, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=51, .velocity=115 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=45, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=55, .velocity=115 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=45, .velocity=0 },
+    { .type=1, .delta_ticks=120, .channel=0, .note=45, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=86 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=110 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=45, .velocity=111 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=55, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=37, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=33, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=25, .channel=0, .note=45, .velocity=111 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=45, .velocity=111 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=52, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=110 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=55, .velocity=110 },
+    { .type=0, .delta_ticks=75, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=2, .note=33, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=53, .velocity=111 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=55, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=57, .velocity=111 },
+    { .type=0, .delta_ticks=70, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=45, .channel=0, .note=53, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=45, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=119 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=57, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=45, .velocity=110 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=25, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=45, .velocity=108 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=45, .velocity=108 },
+    { .type=1, .delta_ticks=129, .channel=0, .note=57, .velocity=117 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=60, .velocity=117 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=83 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=115 },
+    { .type=0, .delta_ticks=83, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=45, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=45, .velocity=111 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=57, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=60, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=45, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=119 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=45, .velocity=108 },
+    { .type=0, .delta_ticks=62, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=55, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=59, .velocity=110 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=50, .channel=0, .note=55, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=45, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=98 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=120 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=117 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=59, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=45, .velocity=114 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=45, .velocity=115 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=45, .velocity=115 },
+    { .type=0, .delta_ticks=70, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=1, .delta_ticks=45, .channel=0, .note=69, .velocity=112 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=104 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=51, .velocity=113 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=64, .velocity=112 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=40, .velocity=82 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=69, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=65, .velocity=105 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=62, .velocity=105 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=51, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=2, .note=33, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=65, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=64, .velocity=112 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=62, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=60, .velocity=112 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=79 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=69, .velocity=103 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=60, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=64, .velocity=103 },
+    { .type=0, .delta_ticks=58, .channel=0, .note=69, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=64, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=98 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=93 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=60, .velocity=111 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=60, .velocity=102 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=60, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=57, .velocity=102 },
+    { .type=0, .delta_ticks=33, .channel=2, .note=33, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=60, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=64, .velocity=113 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=57, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=60, .velocity=113 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=88 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=69, .velocity=103 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=86 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=60, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=64, .velocity=103 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=69, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=72, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=92 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=69, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=93 },
+    { .type=0, .delta_ticks=25, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=37, .channel=0, .note=72, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=69, .velocity=101 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=87 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=69, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=64, .velocity=101 },
+    { .type=0, .delta_ticks=29, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=2, .note=33, .velocity=0 },
+    { .type=0, .delta_ticks=25, .channel=0, .note=69, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=64, .velocity=112 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=60, .velocity=112 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=36, .velocity=86 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=69, .velocity=103 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=60, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=64, .velocity=103 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=69, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=64, .velocity=110 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=60, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=104 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=40, .velocity=93 },
+    { .type=0, .delta_ticks=25, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=69, .velocity=100 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=60, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=64, .velocity=100 },
+    { .type=0, .delta_ticks=33, .channel=2, .note=33, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=69, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=64, .velocity=113 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=60, .velocity=113 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=93 },
+    { .type=0, .delta_ticks=29, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=60, .velocity=103 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=88 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=60, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=57, .velocity=103 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=60, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=86 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=118 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=72 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=57, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=108 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=58, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=52, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=118 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=55, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=85 },
+    { .type=0, .delta_ticks=16, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=66, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=25, .channel=0, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=40, .velocity=110 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=55, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=110 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=86 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=116 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=110 },
+    { .type=1, .delta_ticks=4, .channel=9, .note=46, .velocity=81 },
+    { .type=0, .delta_ticks=58, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=46, .velocity=0 },
+    { .type=1, .delta_ticks=16, .channel=0, .note=50, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=118 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=54, .velocity=111 },
+    { .type=0, .delta_ticks=16, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=66, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=50, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=54, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=40, .velocity=104 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=123 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=104 },
+    { .type=1, .delta_ticks=12, .channel=9, .note=46, .velocity=81 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=25, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=46, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=129, .channel=0, .note=48, .velocity=116 },
+    { .type=0, .delta_ticks=0, .channel=0, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=51, .velocity=116 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=123 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=75 },
+    { .type=0, .delta_ticks=91, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=108 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=51, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=108 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=117 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=110 },
+    { .type=1, .delta_ticks=16, .channel=9, .note=46, .velocity=72 },
+    { .type=0, .delta_ticks=62, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=25, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=46, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=46, .velocity=110 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=50, .velocity=110 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=108, .channel=0, .note=46, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=110 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=83 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=116 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=75 },
+    { .type=0, .delta_ticks=45, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=121 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=79, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=45, .channel=0, .note=47, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=83 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=50, .velocity=110 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=46, .velocity=78 },
+    { .type=0, .delta_ticks=66, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=0, .note=47, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=48, .velocity=117 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=52, .velocity=117 },
+    { .type=0, .delta_ticks=83, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=48, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=68 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=70, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=52, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=121 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=55, .velocity=114 },
+    { .type=1, .delta_ticks=4, .channel=9, .note=46, .velocity=72 },
+    { .type=0, .delta_ticks=16, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=58, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=52, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=55, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=40, .velocity=106 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=106 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=91, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=116 },
+    { .type=1, .delta_ticks=29, .channel=9, .note=46, .velocity=65 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=46, .velocity=0 },
+    { .type=1, .delta_ticks=16, .channel=0, .note=50, .velocity=106 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=117 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=54, .velocity=106 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=54, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=50, .channel=0, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=40, .velocity=114 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=54, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=83 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=12, .channel=9, .note=46, .velocity=75 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=106 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=106 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=48, .velocity=117 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=75 },
+    { .type=0, .delta_ticks=4, .channel=0, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=52, .velocity=117 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=75, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=0, .note=48, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=75, .channel=0, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=117 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=69 },
+    { .type=0, .delta_ticks=83, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=25, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=16, .channel=0, .note=46, .velocity=114 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=49, .velocity=114 },
+    { .type=1, .delta_ticks=124, .channel=2, .note=40, .velocity=86 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=73 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=121 },
+    { .type=0, .delta_ticks=79, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=9, .note=36, .velocity=120 },
+    { .type=0, .delta_ticks=91, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=45, .channel=2, .note=40, .velocity=71 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=46, .velocity=71 },
+    { .type=0, .delta_ticks=70, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=133, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=46, .velocity=75 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=77 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=108 },
+    { .type=0, .delta_ticks=16, .channel=0, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=37, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=40, .velocity=107 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=107 },
+    { .type=1, .delta_ticks=116, .channel=9, .note=46, .velocity=69 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=52, .velocity=113 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=121 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=55, .velocity=113 },
+    { .type=0, .delta_ticks=45, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=105 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=55, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=105 },
+    { .type=0, .delta_ticks=37, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=79 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=70, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=37, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=50, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=115 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=54, .velocity=110 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=54, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=50, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=71 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=123 },
+    { .type=0, .delta_ticks=4, .channel=0, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=54, .velocity=0 },
+    { .type=0, .delta_ticks=50, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=48, .velocity=118 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=98 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=51, .velocity=118 },
+    { .type=0, .delta_ticks=4, .channel=0, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=65 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=75, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=0, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=40, .velocity=106 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=51, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=106 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=46, .velocity=75 },
+    { .type=0, .delta_ticks=83, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=25, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=16, .channel=0, .note=46, .velocity=115 },
+    { .type=0, .delta_ticks=4, .channel=0, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=50, .velocity=115 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=116, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=86 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=72 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=50, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=29, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=125, .channel=0, .note=47, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=50, .velocity=110 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=46, .velocity=71 },
+    { .type=0, .delta_ticks=75, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=47, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=48, .velocity=111 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=52, .velocity=111 },
+    { .type=0, .delta_ticks=70, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=50, .channel=0, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=40, .velocity=110 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=123 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=72 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=37, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=16, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=120, .channel=9, .note=46, .velocity=73 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=52, .velocity=117 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=83 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=123 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=55, .velocity=117 },
+    { .type=0, .delta_ticks=75, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=52, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=55, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=79, .channel=9, .note=46, .velocity=71 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=0, .delta_ticks=70, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=50, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=54, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=50, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=50, .channel=0, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=98 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=120 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=54, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=46, .velocity=73 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=9, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=40, .velocity=115 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=115 },
+    { .type=0, .delta_ticks=125, .channel=0, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=48, .velocity=117 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=104 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=38, .velocity=85 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=92 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=52, .velocity=117 },
+    { .type=0, .delta_ticks=4, .channel=9, .note=38, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=95, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=86 },
+    { .type=1, .delta_ticks=16, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=48, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=50, .channel=9, .note=38, .velocity=82 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=98 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=38, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=114 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=95, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=9, .note=36, .velocity=91 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=46, .velocity=114 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=49, .velocity=114 },
+    { .type=0, .delta_ticks=4, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=120, .channel=2, .note=40, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=38, .velocity=79 },
+    { .type=1, .delta_ticks=4, .channel=9, .note=40, .velocity=88 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=38, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=33, .channel=9, .note=38, .velocity=79 },
+    { .type=1, .delta_ticks=8, .channel=9, .note=40, .velocity=90 },
+    { .type=0, .delta_ticks=4, .channel=9, .note=38, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=25, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=9, .note=36, .velocity=93 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=104, .channel=9, .note=38, .velocity=87 },
+    { .type=1, .delta_ticks=8, .channel=2, .note=40, .velocity=104 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=93 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=38, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=99, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=9, .note=36, .velocity=93 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=104, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=46, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=49, .velocity=108 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=49, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=49, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=37, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=118 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=57, .velocity=79 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=57, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=29, .channel=0, .note=49, .velocity=114 },
+    { .type=0, .delta_ticks=0, .channel=2, .note=37, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=49, .velocity=114 },
+    { .type=1, .delta_ticks=120, .channel=9, .note=53, .velocity=123 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=61, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=37, .velocity=98 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=118 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=67, .velocity=114 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=62, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=61, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=49, .velocity=110 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=67, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=49, .velocity=110 },
+    { .type=0, .delta_ticks=25, .channel=2, .note=37, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=49, .velocity=0 },
+    { .type=1, .delta_ticks=75, .channel=9, .note=53, .velocity=125 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=49, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=37, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=116 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=49, .velocity=110 },
+    { .type=0, .delta_ticks=16, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=45, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=62, .channel=0, .note=59, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=118 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=66, .velocity=111 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=2, .note=37, .velocity=0 },
+    { .type=0, .delta_ticks=54, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=59, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=66, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=53, .velocity=122 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=49, .velocity=104 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=37, .velocity=104 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=123 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=49, .velocity=104 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=9, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=50, .channel=0, .note=49, .velocity=111 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=49, .velocity=111 },
+    { .type=0, .delta_ticks=16, .channel=2, .note=37, .velocity=0 },
+    { .type=1, .delta_ticks=108, .channel=0, .note=57, .velocity=116 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=37, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=53, .velocity=124 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=123 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=49, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=64, .velocity=116 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=75, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=57, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=49, .velocity=108 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=49, .velocity=108 },
+    { .type=0, .delta_ticks=12, .channel=2, .note=37, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=49, .velocity=0 },
+    { .type=1, .delta_ticks=87, .channel=0, .note=49, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=49, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=37, .velocity=104 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=117 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=53, .velocity=114 },
+    { .type=0, .delta_ticks=29, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=54, .channel=9, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=50, .channel=0, .note=55, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=61, .velocity=110 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=2, .note=37, .velocity=0 },
+    { .type=0, .delta_ticks=95, .channel=0, .note=55, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=49, .velocity=110 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=61, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=37, .velocity=104 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=116 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=53, .velocity=120 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=49, .velocity=110 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=62, .channel=0, .note=49, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=121 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=49, .velocity=111 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=37, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=45, .channel=9, .note=53, .velocity=124 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=56, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=37, .velocity=98 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=61, .velocity=110 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=62, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=56, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=57, .velocity=117 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=61, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=64, .velocity=117 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=37, .velocity=0 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=49, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=57, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=47, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=35, .velocity=77 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=49, .velocity=79 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=47, .velocity=111 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=47, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=47, .velocity=0 },
+    { .type=0, .delta_ticks=62, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=49, .velocity=0 },
+    { .type=1, .delta_ticks=20, .channel=0, .note=47, .velocity=111 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=47, .velocity=111 },
+    { .type=0, .delta_ticks=33, .channel=2, .note=35, .velocity=0 },
+    { .type=1, .delta_ticks=91, .channel=0, .note=59, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=35, .velocity=92 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=53, .velocity=124 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=121 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=66, .velocity=114 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=47, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=47, .velocity=0 },
+    { .type=0, .delta_ticks=54, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=37, .channel=0, .note=59, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=66, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=47, .velocity=106 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=47, .velocity=106 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=35, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=0, .note=47, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=47, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=47, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=35, .velocity=104 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=53, .velocity=119 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=116 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=47, .velocity=108 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=66, .channel=0, .note=57, .velocity=106 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=64, .velocity=106 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=117 },
+    { .type=0, .delta_ticks=16, .channel=0, .note=47, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=47, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=2, .note=35, .velocity=0 },
+    { .type=0, .delta_ticks=58, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=41, .channel=9, .note=53, .velocity=124 },
+    { .type=0, .delta_ticks=4, .channel=0, .note=57, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=47, .velocity=114 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=64, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=47, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=35, .velocity=86 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=47, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=47, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=9, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=50, .channel=0, .note=47, .velocity=106 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=47, .velocity=106 },
+    { .type=0, .delta_ticks=16, .channel=2, .note=35, .velocity=0 },
+    { .type=1, .delta_ticks=104, .channel=9, .note=53, .velocity=125 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=55, .velocity=117 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=98 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=123 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=47, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=63, .velocity=117 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=47, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=75, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=55, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=63, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=46, .velocity=111 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=46, .velocity=111 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=33, .velocity=0 },
+    { .type=0, .delta_ticks=25, .channel=1, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=46, .velocity=0 },
+    { .type=1, .delta_ticks=70, .channel=0, .note=45, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=33, .velocity=98 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=53, .velocity=125 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=117 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=45, .velocity=114 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=62, .channel=9, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=41, .channel=0, .note=53, .velocity=114 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=59, .velocity=114 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=33, .velocity=0 },
+    { .type=1, .delta_ticks=104, .channel=2, .note=33, .velocity=86 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=53, .velocity=125 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=121 },
+    { .type=0, .delta_ticks=29, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=62, .channel=9, .note=36, .velocity=120 },
+    { .type=0, .delta_ticks=25, .channel=2, .note=33, .velocity=0 },
+    { .type=0, .delta_ticks=62, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=41, .channel=2, .note=33, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=53, .velocity=125 },
+    { .type=0, .delta_ticks=37, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=45, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=83, .channel=2, .note=33, .velocity=0 },
+    { .type=0, .delta_ticks=83, .channel=0, .note=45, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=45, .velocity=0 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=80 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=57, .velocity=79 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=59, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=9, .note=57, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=29, .channel=0, .note=40, .velocity=107 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=107 },
+    { .type=0, .delta_ticks=20, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=104, .channel=9, .note=53, .velocity=125 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=52, .velocity=113 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=83 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=121 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=55, .velocity=113 },
+    { .type=0, .delta_ticks=16, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=4, .channel=0, .note=40, .velocity=105 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=55, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=105 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=83 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=53, .velocity=125 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=25, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=37, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=62, .channel=0, .note=50, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=115 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=54, .velocity=110 },
+    { .type=0, .delta_ticks=16, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=58, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=33, .channel=9, .note=53, .velocity=124 },
+    { .type=1, .delta_ticks=12, .channel=0, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=0, .channel=0, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=83 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=123 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=54, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=37, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=9, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=54, .channel=0, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=114 },
+    { .type=0, .delta_ticks=33, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=83, .channel=9, .note=53, .velocity=124 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=48, .velocity=118 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=77 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=51, .velocity=118 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=70, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=33, .channel=0, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=40, .velocity=106 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=51, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=106 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=75, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=74 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=53, .velocity=125 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=108 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=62, .channel=9, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=45, .channel=0, .note=46, .velocity=115 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=50, .velocity=115 },
+    { .type=0, .delta_ticks=8, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=104, .channel=9, .note=53, .velocity=125 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=46, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=50, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=12, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=45, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=37, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=29, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=95, .channel=0, .note=47, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=83 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=53, .velocity=119 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=50, .velocity=110 },
+    { .type=0, .delta_ticks=12, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=70, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=47, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=48, .velocity=111 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=52, .velocity=111 },
+    { .type=0, .delta_ticks=25, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=50, .channel=0, .note=48, .velocity=0 },
+    { .type=1, .delta_ticks=8, .channel=0, .note=40, .velocity=110 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=52, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=86 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=123 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=53, .velocity=124 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=110 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=20, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=50, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=33, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=108 },
+    { .type=0, .delta_ticks=12, .channel=2, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=112, .channel=0, .note=52, .velocity=117 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=98 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=123 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=55, .velocity=117 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=53, .velocity=125 },
+    { .type=0, .delta_ticks=25, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=29, .channel=0, .note=40, .velocity=111 },
+    { .type=1, .delta_ticks=4, .channel=1, .note=40, .velocity=111 },
+    { .type=0, .delta_ticks=16, .channel=0, .note=52, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=55, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=25, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=75, .channel=0, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=89 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=40, .velocity=108 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=53, .velocity=124 },
+    { .type=0, .delta_ticks=29, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=54, .channel=0, .note=50, .velocity=110 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=122 },
+    { .type=1, .delta_ticks=8, .channel=1, .note=54, .velocity=110 },
+    { .type=0, .delta_ticks=25, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=50, .channel=9, .note=36, .velocity=0 },
+    { .type=1, .delta_ticks=41, .channel=9, .note=53, .velocity=125 },
+    { .type=0, .delta_ticks=4, .channel=0, .note=50, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=40, .velocity=114 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=54, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=114 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=40, .velocity=104 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=120 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=16, .channel=0, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=41, .channel=9, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=50, .channel=0, .note=40, .velocity=115 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=40, .velocity=115 },
+    { .type=0, .delta_ticks=54, .channel=2, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=79, .channel=0, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=71, .velocity=112 },
+    { .type=1, .delta_ticks=0, .channel=2, .note=28, .velocity=104 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=38, .velocity=116 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=36, .velocity=99 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=53, .velocity=125 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=40, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=69, .velocity=112 },
+    { .type=1, .delta_ticks=0, .channel=9, .note=40, .velocity=122 },
+    { .type=0, .delta_ticks=20, .channel=9, .note=36, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=38, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=9, .note=53, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=9, .note=40, .velocity=0 },
+    { .type=0, .delta_ticks=29, .channel=0, .note=71, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=69, .velocity=105 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=69, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=66, .velocity=105 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=69, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=66, .velocity=112 },
+    { .type=0, .delta_ticks=0, .channel=2, .note=28, .velocity=0 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=66, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=63, .velocity=112 },
+    { .type=0, .delta_ticks=54, .channel=0, .note=66, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=63, .velocity=103 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=63, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=59, .velocity=103 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=63, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=59, .velocity=111 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=59, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=57, .velocity=111 },
+    { .type=0, .delta_ticks=54, .channel=0, .note=59, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=57, .velocity=102 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=57, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=54, .velocity=102 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=57, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=54, .velocity=113 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=54, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=51, .velocity=113 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=54, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=51, .velocity=103 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=51, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=47, .velocity=103 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=51, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=75, .velocity=111 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=47, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=71, .velocity=111 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=75, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=73, .velocity=101 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=71, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=69, .velocity=101 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=73, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=71, .velocity=112 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=69, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=66, .velocity=112 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=71, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=69, .velocity=103 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=66, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=63, .velocity=103 },
+    { .type=0, .delta_ticks=58, .channel=0, .note=69, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=66, .velocity=110 },
+    { .type=0, .delta_ticks=4, .channel=1, .note=63, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=59, .velocity=110 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=66, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=63, .velocity=100 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=59, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=57, .velocity=100 },
+    { .type=0, .delta_ticks=54, .channel=0, .note=63, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=59, .velocity=113 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=57, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=54, .velocity=113 },
+    { .type=0, .delta_ticks=62, .channel=0, .note=59, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=0, .note=57, .velocity=103 },
+    { .type=0, .delta_ticks=8, .channel=1, .note=54, .velocity=0 },
+    { .type=1, .delta_ticks=0, .channel=1, .note=51, .velocity=103 },
+    { .type=0, .delta_ticks=54, .channel=0, .note=57, .velocity=0 },
+    { .type=0, .delta_ticks=0, .channel=1, .note=51, .velocity=0 },
+    { .type=2, .delta_ticks=0 } // End
 };
 
 #endif
@@ -0,0 +1,25 @@
+#ifndef SONG_FORMAT_H
+#define SONG_FORMAT_H
+
+#include <stdint.h>
+
+// --- Song Data Format ---
+// Generated by midi2c.py, read by the song player.
+// Times are kept in MIDI ticks so nothing is rounded at conversion time;
+// the player turns ticks into microsecond deadlines using the tempo map.
+
+typedef struct {
+    uint8_t type;          // Same types as SongEvent, plus 255=Wait (carries time only)
+    uint8_t voice;         // VOICE_HINT_* from midi2c.py --prealloc (see queue.h), else 0
+    uint16_t delta_ticks;  // Ticks since the previous event
+    uint8_t channel;       // MIDI Channel (0-15)
+    uint8_t note;          // MIDI Note (0-127), Program Number or Controller Number
+    uint8_t velocity;      // 0-127 or Controller Value
+} SongTickEvent;
+
+typedef struct {
+    uint32_t tick;            // Absolute tick where this tempo takes effect
+    uint32_t us_per_quarter;  // MIDI tempo (500000 = 120 BPM)
+} TempoChange;
+
+#endif // SONG_FORMAT_H
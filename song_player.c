@@ -3,32 +3,432 @@
  * 
  * Internal Song Player Implementation
  * Feeds song data from song_data.h to the audio engine
+ *
+ * Events are released on Core 0 at their deadline in "song time" and reach
+ * Core 1 with no delay. Song data is stored in MIDI ticks with a tempo map;
+ * the song position normally follows the system clock through the tempo map
+ * (scaled by the live tempo factor), or in clock-sync mode follows incoming
+ * MIDI clock (24 PPQN) so the song stretches with the master's tempo.
+ *
+ * Positions are fixed-point ticks (Q8). The clock is only re-anchored at a
+ * tempo change or a tempo-scale change, and every position is computed from
+ * the anchor with exact integer math, so rounding never accumulates.
+ *
+ * A lookahead cursor runs PREFETCH_LOOKAHEAD_US ahead of playback and sends
+ * Prefetch (type 7) hints for upcoming melodic notes, so Core 1 can load
+ * their patches onto idle voices before the notes are due.
+ *
+ * If songc/ has compiled the song into song_stream.h, the player can play
+ * that register stream instead: Core 0 times each run of writes between
+ * waits and Core 1 just replays it (StreamRun, type 8). Streams carry no
+ * beats, so MIDI clock sync always plays the event list.
+ *
+ * Doom MUS lumps found in flash (see mus_player.h) are a third source:
+ * their events are decoded as they fall due at 140 Hz and go to Core 1
+ * like the event list's, through the voice manager. MUS has no beats
+ * either, so it too follows the internal clock only.
+ *
+ * Tracker modules (tracker_player.h) keep their own time: the tracker's
+ * timer runs while one is the source and the song is playing, and the
+ * player only starts, stops and rewinds it.
  */
 
 #include "song_player.h"
 #include "pico/stdlib.h"
+#include "hardware/sync.h"
 #include "audio_engine.h"
-#include "instruments.h"
+#include "midi_input.h"
 #include "queue.h"
 #include "song_data.h"
-#include "opl2.h"
+#include "opl2_stream.h"
+#include "mus_player.h"
+#include "tracker_player.h"
+#include "modulation.h"
 #include <stdio.h>
 
+#if __has_include("song_stream.h")
+#include "song_stream.h"
+#define SONG_STREAM_AVAILABLE 1
+#else
+#define SONG_STREAM_AVAILABLE 0
+static const uint8_t song_stream[] = { STREAM_OP_END };
+#endif
+
+#define TICK_SHIFT        8        // Song positions are ticks in Q8
+#define CLOCK_MAX_GAP_US  100000   // Slower than ~25 BPM: treat as a restart of the clock
+#define CLOCK_SMOOTHING   8        // Moving-average weight (1/8 per pulse)
+
+#define TEMPO_SCALE_MIN   25       // Percent of the song's own tempo
+#define TEMPO_SCALE_MAX   400
+#define FADE_MS_DEFAULT   200      // Pause, resume and stop ramps
+#define FADE_MS_MAX       10000
+
+#define PREFETCH_LOOKAHEAD_US 100000  // How far ahead patches are preloaded
+
+#define SONG_LEN   (sizeof(midi_song) / sizeof(midi_song[0]))
+#define TEMPO_LEN  (sizeof(midi_song_tempo) / sizeof(midi_song_tempo[0]))
+
 // Player state
 static bool playing = false;
 static uint32_t song_index = 0;
 static uint32_t song_restart_time = 0;
 static bool waiting_to_restart = false;
-static uint32_t next_event_time_ms = 0;
+static uint32_t event_tick = 0;           // Absolute tick of the last released event
+static uint64_t paused_tick_q8 = 0;
+
+// Internal clock: at system time anchor_us the song was at anchor_tick_q8,
+// running at us_per_quarter scaled by tempo_percent
+static uint64_t anchor_us = 0;
+static uint64_t anchor_tick_q8 = 0;
+static uint32_t tempo_index = 0;          // Tempo map entry in effect at the anchor
+static uint32_t us_per_quarter = 500000;
+static uint16_t tempo_percent = 100;
+
+// The register stream and MUS count time in fixed units (stream units or
+// MUS ticks); positions are units (Q8), anchored like the tick clock
+static song_source_t source = SONG_STREAM_AVAILABLE ? SONG_SOURCE_STREAM : SONG_SOURCE_EVENTS;
+static uint64_t paused_unit_q8 = 0;       // Unit position at the last pause
+static uint64_t unit_anchor_us = 0;
+static uint64_t unit_anchor_q8 = 0;
+
+// Register stream playback: stream_run_pos is the next run, due at stream_run_due
+static uint32_t stream_run_pos = 0;
+static uint32_t stream_run_due = 0;
+
+// MUS playback: the next event is read from mus, due at mus_due
+static uint8_t mus_index = 0;
+static MusReader mus;
+static uint32_t mus_due = 0;
+
+// Tracker module played by SONG_SOURCE_TRACKER
+static uint8_t tracker_index = 0;
+
+// Lookahead cursor, and the program each channel will have there
+static uint32_t lookahead_index = 0;
+static uint32_t lookahead_tick = 0;
+static uint8_t lookahead_program[16];
+static uint16_t hinted_program[16];       // Last program hinted per channel (PATCH_NONE = none)
+static uint32_t hinted_tick[16];
+
+// Transport requests raised by the MIDI input interrupt
+typedef enum {
+    TRANSPORT_NONE,
+    TRANSPORT_START,
+    TRANSPORT_STOP,
+    TRANSPORT_CONTINUE,
+    TRANSPORT_SEEK
+} transport_t;
+
+// MIDI clock state (written from the MIDI input interrupt)
+static bool clock_sync = false;
+static volatile bool clock_running = false;
+static volatile uint32_t clock_base = 0;         // Song position (pulses) of the first clock after start
+static volatile uint32_t clock_pulses = 0;       // Clocks received since Start/Continue
+static volatile uint64_t clock_last_us = 0;
+static volatile uint32_t clock_period_q4 = 0;    // Smoothed pulse period in 1/16 us (0 = unknown)
+static volatile transport_t transport_request = TRANSPORT_NONE;
+
+static void send_reset(void) {
+    SongEvent reset = { .type = 2, .delay_ms = 0 };
+    audio_engine_add_event(&reset);
+}
+
+// Master fade on Core 1 (pause, resume, stop)
+static uint16_t fade_ms = FADE_MS_DEFAULT;
+
+static void send_fade(uint8_t fade) {
+    SongEvent e = { .type = 11, .delay_ms = 0, .note = fade,
+                    .channel = (uint8_t)(fade_ms >> 8), .velocity = (uint8_t)(fade_ms & 0xFF) };
+    audio_engine_add_event(&e);
+}
+
+// x * num / den without overflowing the intermediate product
+// (exact as long as num * den fits in 64 bits)
+static uint64_t muldiv(uint64_t x, uint64_t num, uint64_t den) {
+    return (x / den) * num + (x % den) * num / den;
+}
+
+// Ticks per us is (PPQ * percent) / (us_per_quarter * 100)
+static uint64_t tick_rate_num(void) {
+    return ((uint64_t)MIDI_SONG_PPQ * tempo_percent) << TICK_SHIFT;
+}
+
+static uint64_t tick_rate_den(void) {
+    return (uint64_t)us_per_quarter * 100;
+}
+
+// Pin the internal clock: song position tick_q8 is reached at system time now_us
+static void set_anchor(uint64_t tick_q8, uint64_t now_us) {
+    tempo_index = 0;
+    while (tempo_index + 1 < TEMPO_LEN &&
+           ((uint64_t)midi_song_tempo[tempo_index + 1].tick << TICK_SHIFT) <= tick_q8) {
+        tempo_index++;
+    }
+    us_per_quarter = midi_song_tempo[tempo_index].us_per_quarter;
+    anchor_tick_q8 = tick_q8;
+    anchor_us = now_us;
+}
+
+// Current position in song ticks (Q8)
+static uint64_t song_position_q8(void) {
+    uint64_t now = time_us_64();
+
+    if (!clock_sync) {
+        // Step through any tempo changes passed since the anchor; each one
+        // becomes the new anchor at its exact deadline
+        while (tempo_index + 1 < TEMPO_LEN) {
+            uint64_t change_q8 = (uint64_t)midi_song_tempo[tempo_index + 1].tick << TICK_SHIFT;
+            uint64_t change_us = anchor_us + muldiv(change_q8 - anchor_tick_q8, tick_rate_den(), tick_rate_num());
+            if (now < change_us) break;
+
+            tempo_index++;
+            us_per_quarter = midi_song_tempo[tempo_index].us_per_quarter;
+            anchor_tick_q8 = change_q8;
+            anchor_us = change_us;
+        }
+        return anchor_tick_q8 + muldiv(now - anchor_us, tick_rate_num(), tick_rate_den());
+    }
+
+    // Snapshot the ISR-owned clock state consistently
+    uint32_t irq_state = save_and_disable_interrupts();
+    uint32_t pulses = clock_pulses;
+    uint32_t base = clock_base;
+    uint64_t last_us = clock_last_us;
+    uint32_t period_q4 = clock_period_q4;
+    restore_interrupts(irq_state);
+
+    // One MIDI clock pulse is PPQ / 24 song ticks
+    if (pulses == 0) return ((uint64_t)base * MIDI_SONG_PPQ << TICK_SHIFT) / 24;
+
+    // Each pulse pins the position; between pulses interpolate with the
+    // smoothed period, but never run past the next pulse
+    uint64_t pulse_q8 = (uint64_t)(base + pulses - 1) << TICK_SHIFT;
+    if (period_q4 != 0) {
+        uint64_t since_q4 = (now - last_us) << 4;
+        if (since_q4 > period_q4) since_q4 = period_q4;
+        pulse_q8 += (since_q4 << TICK_SHIFT) / period_q4;
+    }
+    return pulse_q8 * MIDI_SONG_PPQ / 24;
+}
+
+// --- UNIT CLOCK (register stream, MUS) ---
+
+// The event list plays under MIDI clock sync whatever the source
+static bool unit_clock_active(void) {
+    return (source == SONG_SOURCE_STREAM || source == SONG_SOURCE_MUS) && !clock_sync;
+}
+
+static bool tracker_active(void) {
+    return source == SONG_SOURCE_TRACKER && !clock_sync;
+}
+
+static uint64_t unit_position_q8(void) {
+    uint64_t elapsed = time_us_64() - unit_anchor_us;
+    if (source == SONG_SOURCE_MUS) {
+        return unit_anchor_q8 + muldiv(elapsed, ((uint64_t)tempo_percent * MUS_TICK_HZ) << TICK_SHIFT, 100000000);
+    }
+    return unit_anchor_q8 + muldiv(elapsed, (uint64_t)tempo_percent << TICK_SHIFT, 100 * STREAM_TICK_US);
+}
+
+static void unit_rewind(void) {
+    paused_unit_q8 = 0;
+    unit_anchor_q8 = 0;
+    unit_anchor_us = time_us_64();
+
+    stream_run_pos = 0;
+    stream_run_due = 0;
+
+    mus_due = 0;
+    if (source == SONG_SOURCE_MUS) mus_open(&mus, mus_index);
+
+    if (source == SONG_SOURCE_TRACKER) {
+        tracker_open(tracker_index);
+    } else {
+        tracker_pause();
+    }
+}
+
+// --- REGISTER STREAM ---
+
+// Send every run that is due; false once the stream has ended
+static bool stream_update(void) {
+    uint64_t position = unit_position_q8();
+
+    while (((uint64_t)stream_run_due << TICK_SHIFT) <= position) {
+        uint32_t run = stream_run_pos;
+        uint32_t units;
+        bool more = opl2_stream_next(song_stream, &stream_run_pos, &units);
+
+        // Core 1 plays the writes up to the next wait (none if it starts on one)
+        if (song_stream[run] < STREAM_OP_WAIT) {
+            SongEvent e = { .type = 8, .delay_ms = 0, .channel = (uint8_t)(run >> 16),
+                            .note = (uint8_t)(run >> 8), .velocity = (uint8_t)run };
+            audio_engine_add_event(&e);
+        }
+        if (!more) return false;
+        stream_run_due += units;
+    }
+    return true;
+}
+
+// --- MUS ---
+
+// Send every MUS event that is due; false once the score has ended
+static bool mus_update(void) {
+    uint64_t position = unit_position_q8();
+
+    while (((uint64_t)mus_due << TICK_SHIFT) <= position) {
+        SongEvent e;
+        uint32_t delay;
+        mus_result_t result = mus_read(&mus, &e, &delay);
+        if (result == MUS_END) return false;
+
+        if (result == MUS_EVENT) audio_engine_add_event(&e);
+        mus_due += delay;
+    }
+    return true;
+}
+
+// Restart the lookahead from the top of the song
+static void reset_lookahead(void) {
+    lookahead_index = 0;
+    lookahead_tick = 0;
+    for (int ch = 0; ch < 16; ch++) {
+        lookahead_program[ch] = 0;
+        hinted_program[ch] = PATCH_NONE;
+        hinted_tick[ch] = 0;
+    }
+}
+
+// Hint the patches of melodic notes due before position + the lookahead.
+// Events already released only update the program table, and a channel is
+// not hinted the same program twice within one lookahead window.
+static void prefetch_upcoming(uint64_t position_q8) {
+    uint32_t window = (uint32_t)(muldiv(PREFETCH_LOOKAHEAD_US, tick_rate_num(), tick_rate_den()) >> TICK_SHIFT);
+    uint64_t horizon_q8 = position_q8 + ((uint64_t)window << TICK_SHIFT);
+
+    while (lookahead_index < SONG_LEN) {
+        const SongTickEvent *e = &midi_song[lookahead_index];
+        uint32_t due = lookahead_tick + e->delta_ticks;
+        if (e->type == 2 || ((uint64_t)due << TICK_SHIFT) > horizon_q8) break;
+
+        bool released = lookahead_index < song_index;
+        lookahead_index++;
+        lookahead_tick = due;
+
+        uint8_t ch = e->channel & 0x0F;
+        if (e->type == 3) {
+            lookahead_program[ch] = e->note;
+        } else if (e->type == 1 && ch != 9 && !released) {
+            // The converter's pre-pass knows this patch is already in place
+            if (e->voice & VOICE_HINT_LOADED) continue;
+
+            uint8_t program = lookahead_program[ch];
+            if (!(e->voice & VOICE_HINT_ASSIGNED)) {
+                if (hinted_program[ch] == program && due - hinted_tick[ch] < window) continue;
+                hinted_program[ch] = program;
+                hinted_tick[ch] = due;
+            }
+            SongEvent hint = { .type = 7, .voice = e->voice, .delay_ms = 0, .channel = ch, .note = program };
+            audio_engine_add_event(&hint);
+        }
+    }
+}
+
+// Jump to a song position, replaying program changes and controllers
+// on the way so the instruments are right when notes resume
+static void seek_to(uint32_t tick) {
+    send_reset();
+    song_index = 0;
+    event_tick = 0;
+    reset_lookahead();
+
+    while (song_index < SONG_LEN) {
+        const SongTickEvent *e = &midi_song[song_index];
+        uint32_t due = event_tick + e->delta_ticks;
+        if (e->type == 2 || due >= tick) break;
+
+        if (e->type == 3 || e->type == 4) {
+            SongEvent chase = { .type = e->type, .delay_ms = 0, .channel = e->channel,
+                                .note = e->note, .velocity = e->velocity };
+            audio_engine_add_event(&chase);
+        }
+        event_tick = due;
+        song_index++;
+    }
+    set_anchor((uint64_t)tick << TICK_SHIFT, time_us_64());
+}
+
+static void handle_transport(void) {
+    uint32_t irq_state = save_and_disable_interrupts();
+    transport_t request = transport_request;
+    transport_request = TRANSPORT_NONE;
+    restore_interrupts(irq_state);
+
+    switch (request) {
+        case TRANSPORT_START:
+            printf("Song player: MIDI Start\n");
+            seek_to(0);
+            waiting_to_restart = false;
+            playing = true;
+            break;
+
+        case TRANSPORT_CONTINUE:
+            printf("Song player: MIDI Continue\n");
+            playing = true;
+            send_fade(FADE_IN);
+            break;
+
+        case TRANSPORT_STOP:
+            printf("Song player: MIDI Stop\n");
+            song_player_pause();
+            break;
+
+        case TRANSPORT_SEEK:
+            // 24 clocks per quarter note
+            seek_to((uint32_t)((uint64_t)clock_base * MIDI_SONG_PPQ / 24));
+            break;
+
+        case TRANSPORT_NONE:
+            break;
+    }
+}
+
+// End of song: the internal clock loops after a pause, MIDI clock waits
+// for the master
+static void finish_song(uint led_pin) {
+    send_reset();
+    gpio_put(led_pin, 0);
+
+    if (clock_sync) {
+        // The master decides when to go again
+        printf("Song done. Waiting for MIDI Start...\n");
+        playing = false;
+    } else {
+        // End of song marker - schedule restart
+        printf("Song done. Restarting in 2s...\n");
+        waiting_to_restart = true;
+        song_restart_time = to_ms_since_boot(get_absolute_time()) + 2000;
+    }
+}
 
 void song_player_init(void) {
     playing = false;
     song_index = 0;
     waiting_to_restart = false;
-    next_event_time_ms = 0;
+    event_tick = 0;
+    paused_tick_q8 = 0;
+    reset_lookahead();
+    set_anchor(0, time_us_64());
+    opl2_stream_select(song_stream);
+    unit_rewind();
 }
 
 void song_player_update(uint led_pin) {
+    if (clock_sync && transport_request != TRANSPORT_NONE) {
+        handle_transport();
+    }
+
     if (!playing) {
         gpio_put(led_pin, 0);
         return;
@@ -40,36 +440,61 @@ void song_player_update(uint led_pin) {
             printf("Song restarting...\n");
             song_index = 0;
             waiting_to_restart = false;
-            load_drum_patch(8, 36);  // Reload defaults
-            next_event_time_ms = to_ms_since_boot(get_absolute_time());
+            audio_engine_load_drum_patch(36);  // Reload defaults
+            event_tick = 0;
+            reset_lookahead();
+            set_anchor(0, time_us_64());
+            unit_rewind();
         }
         return;
     }
+
+    if (unit_clock_active()) {
+        gpio_put(led_pin, 1);
+        bool more = source == SONG_SOURCE_MUS ? mus_update() : stream_update();
+        if (!more) finish_song(led_pin);
+        return;
+    }
+
+    if (tracker_active()) {
+        gpio_put(led_pin, 1);
+        if (tracker_is_finished()) {
+            finish_song(led_pin);
+        } else if (!tracker_is_running()) {
+            tracker_resume();
+        }
+        return;
+    }
+
+    // Slaved to MIDI clock: nothing moves until the master's first pulse
+    if (clock_sync && (!clock_running || clock_pulses == 0)) {
+        return;
+    }
     
-    // Feed events based on their scheduled times (prevents slow-motion playback)
+    // Feed events based on their scheduled song time (prevents slow-motion playback)
     gpio_put(led_pin, 1);
-    uint32_t now_ms = to_ms_since_boot(get_absolute_time());
-    size_t song_len = sizeof(midi_song) / sizeof(midi_song[0]);
-
-    while (song_index < song_len && now_ms >= next_event_time_ms) {
-        SongEvent e = midi_song[song_index++];
-
-        if (e.type == 2) {
-            // End of song marker - schedule restart
-            printf("Song done. Restarting in 2s...\n");
-            SongEvent reset = { .type=2, .delay_ms=0 };
-            audio_engine_add_event(&reset);
-            waiting_to_restart = true;
-            song_restart_time = now_ms + 2000;
-            gpio_put(led_pin, 0);
+    uint64_t position = song_position_q8();
+    prefetch_upcoming(position);
+
+    while (song_index < SONG_LEN) {
+        const SongTickEvent *next = &midi_song[song_index];
+        uint32_t due = event_tick + next->delta_ticks;
+        if (position < ((uint64_t)due << TICK_SHIFT)) break;
+
+        song_index++;
+        event_tick = due;
+
+        if (next->type == 255) continue;  // Wait: only carries time
+
+        if (next->type == 2) {
+            finish_song(led_pin);
             return;
         }
 
+        // Core 0 already waited for this event's slot
+        SongEvent e = { .type = next->type, .voice = next->voice, .delay_ms = 0, .channel = next->channel,
+                        .note = next->note, .velocity = next->velocity };
         audio_engine_add_event(&e);
-        next_event_time_ms += e.delay_ms;
-
-        // Update now_ms to allow multiple zero-delay events in this call
-        now_ms = to_ms_since_boot(get_absolute_time());
     }
 }
 
@@ -81,28 +506,218 @@ void song_player_play(void) {
     if (!playing) {
         printf("Song player: Play\n");
         playing = true;
-        next_event_time_ms = to_ms_since_boot(get_absolute_time());
+        set_anchor(paused_tick_q8, time_us_64());
+        unit_anchor_q8 = paused_unit_q8;
+        unit_anchor_us = time_us_64();
+        send_fade(FADE_IN);
     }
 }
 
+// Stop releasing events, keeping the position for the next play
+// (where the clocks are now, not the last event, so a pause in a long
+// note or rest doesn't replay the time already played)
+static void halt(void) {
+    if (!waiting_to_restart) {
+        paused_tick_q8 = song_position_q8();
+        paused_unit_q8 = unit_position_q8();
+    }
+    playing = false;
+    tracker_pause();
+}
+
 void song_player_pause(void) {
     if (playing) {
         printf("Song player: Pause\n");
-        playing = false;
-        audio_engine_flush();  // Clear queued events
-        sleep_ms(10);  // Give audio engine time to finish current event
-        
-        // Send a reset event to clear voice states and silence all notes
-        SongEvent reset = { .type = 2, .delay_ms = 0 };
-        audio_engine_add_event(&reset);
-        sleep_ms(10);  // Give time for reset to process
+        halt();
+
+        // Core 1 fades out and holds the sounding notes for the resume;
+        // events already released still play during the fade
+        send_fade(FADE_PAUSE);
     }
 }
 
+void song_player_stop(void) {
+    if (playing) {
+        printf("Song player: Stop\n");
+        halt();
+    }
+
+    // Also after a pause, to let go of the held notes. Nothing is flushed:
+    // what is already queued (patch updates, bank selects, the last song
+    // events) plays into the fade, and the reset at its end silences it
+    send_fade(FADE_STOP);
+}
+
+void song_player_set_fade_time(uint16_t ms) {
+    fade_ms = ms > FADE_MS_MAX ? FADE_MS_MAX : ms;
+}
+
+uint16_t song_player_get_fade_time(void) {
+    return fade_ms;
+}
+
 void song_player_skip(void) {
     printf("Song player: Skip (restart)\n");
     song_index = 0;
     waiting_to_restart = false;
-    next_event_time_ms = to_ms_since_boot(get_absolute_time());
-    load_drum_patch(8, 36);
+    event_tick = 0;
+    paused_tick_q8 = 0;
+    reset_lookahead();
+    set_anchor(0, time_us_64());
+    unit_rewind();
+    audio_engine_load_drum_patch(36);
+}
+
+// --- SONG SOURCE ---
+
+// Switch source (and MUS lump or tracker module) and start it from the top
+static void change_source(song_source_t new_source, uint8_t new_index) {
+    bool was_playing = playing;
+    song_player_stop();
+    source = new_source;
+    if (new_source == SONG_SOURCE_MUS) mus_index = new_index;
+    if (new_source == SONG_SOURCE_TRACKER) tracker_index = new_index;
+    song_player_skip();
+    if (was_playing) song_player_play();
+}
+
+void song_player_set_source(song_source_t new_source) {
+    if (new_source == SONG_SOURCE_STREAM && !SONG_STREAM_AVAILABLE) return;
+    if (new_source == SONG_SOURCE_MUS && mus_get_count() == 0) return;
+    if (new_source == SONG_SOURCE_TRACKER && tracker_get_count() == 0) return;
+    if (new_source == source) return;
+
+    change_source(new_source, 0);
+}
+
+void song_player_next_source(void) {
+    if (source == SONG_SOURCE_EVENTS && SONG_STREAM_AVAILABLE) {
+        change_source(SONG_SOURCE_STREAM, 0);
+    } else if (source < SONG_SOURCE_MUS && mus_get_count() > 0) {
+        change_source(SONG_SOURCE_MUS, 0);
+    } else if (source == SONG_SOURCE_MUS && mus_index + 1 < mus_get_count()) {
+        change_source(SONG_SOURCE_MUS, mus_index + 1);
+    } else if (source < SONG_SOURCE_TRACKER && tracker_get_count() > 0) {
+        change_source(SONG_SOURCE_TRACKER, 0);
+    } else if (source == SONG_SOURCE_TRACKER && tracker_index + 1 < tracker_get_count()) {
+        change_source(SONG_SOURCE_TRACKER, tracker_index + 1);
+    } else if (source != SONG_SOURCE_EVENTS) {
+        change_source(SONG_SOURCE_EVENTS, 0);
+    }
+}
+
+song_source_t song_player_get_source(void) {
+    return source;
+}
+
+uint8_t song_player_get_mus(void) {
+    return mus_index;
+}
+
+uint8_t song_player_get_tracker(void) {
+    return tracker_index;
+}
+
+// --- TEMPO SCALE ---
+
+void song_player_set_tempo_scale(uint16_t percent) {
+    if (percent < TEMPO_SCALE_MIN) percent = TEMPO_SCALE_MIN;
+    if (percent > TEMPO_SCALE_MAX) percent = TEMPO_SCALE_MAX;
+    if (percent == tempo_percent) return;
+
+    // Re-anchor at the current position so the song carries on from here
+    // at the new rate (a paused song picks it up on resume)
+    uint64_t now = time_us_64();
+    if (playing && !clock_sync && !waiting_to_restart) {
+        uint64_t position = song_position_q8();
+        uint64_t unit_position = unit_position_q8();
+        tempo_percent = percent;
+        anchor_tick_q8 = position;
+        anchor_us = now;
+        unit_anchor_q8 = unit_position;
+        unit_anchor_us = now;
+    } else {
+        tempo_percent = percent;
+    }
+    tracker_set_tempo_scale(percent);
+}
+
+uint16_t song_player_get_tempo_scale(void) {
+    return tempo_percent;
+}
+
+// --- MIDI CLOCK SYNC ---
+
+void song_player_set_clock_sync(bool enabled) {
+    if (enabled == clock_sync) return;
+
+    song_player_stop();
+    clock_running = false;
+    clock_pulses = 0;
+    clock_base = 0;
+    clock_period_q4 = 0;
+    clock_sync = enabled;
+    midi_input_set_clock_sync(enabled);
+    printf("Song player: %s clock\n", enabled ? "External MIDI" : "Internal");
+}
+
+bool song_player_get_clock_sync(void) {
+    return clock_sync;
+}
+
+uint16_t song_player_get_clock_bpm(void) {
+    uint32_t period_q4 = clock_period_q4;
+    if (period_q4 == 0) return 0;
+    // BPM = 60 s / (24 pulses * period)
+    return (uint16_t)((2500000ULL * 16 + period_q4 / 2) / period_q4);
+}
+
+void song_player_midi_clock(void) {
+    uint64_t now = time_us_64();
+    uint64_t interval = now - clock_last_us;
+    clock_last_us = now;
+
+    // Moving average of the pulse period for a jitter-free tempo estimate
+    if (interval < CLOCK_MAX_GAP_US) {
+        uint32_t interval_q4 = (uint32_t)interval << 4;
+        if (clock_period_q4 == 0) {
+            clock_period_q4 = interval_q4;
+        } else {
+            int32_t error = (int32_t)interval_q4 - (int32_t)clock_period_q4;
+            clock_period_q4 += error / CLOCK_SMOOTHING;
+        }
+    } else {
+        clock_period_q4 = 0;
+    }
+
+    if (clock_running) clock_pulses++;
+}
+
+void song_player_midi_start(void) {
+    clock_base = 0;
+    clock_pulses = 0;
+    clock_running = true;
+    transport_request = TRANSPORT_START;
+}
+
+void song_player_midi_continue(void) {
+    clock_pulses = 0;
+    clock_running = true;
+    transport_request = TRANSPORT_CONTINUE;
+}
+
+void song_player_midi_stop(void) {
+    // Resume point for a later Continue
+    clock_base += clock_pulses;
+    clock_pulses = 0;
+    clock_running = false;
+    transport_request = TRANSPORT_STOP;
+}
+
+void song_player_midi_song_position(uint16_t sixteenths) {
+    // Only meaningful while stopped; one MIDI beat (16th note) = 6 clocks
+    if (clock_running) return;
+    clock_base = (uint32_t)sixteenths * 6;
+    clock_pulses = 0;
+    transport_request = TRANSPORT_SEEK;
 }
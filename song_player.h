@@ -9,8 +9,17 @@
 #define SONG_PLAYER_H
 
 #include "pico/types.h"
+#include <stdint.h>
 #include <stdbool.h>
 
+// What the player plays
+typedef enum {
+    SONG_SOURCE_EVENTS,   // Event list (song_data.h), run through the voice manager
+    SONG_SOURCE_STREAM,   // Register stream compiled by songc/ (song_stream.h)
+    SONG_SOURCE_MUS,      // Doom MUS lump from flash (mus_player.h)
+    SONG_SOURCE_TRACKER   // Tracker module from flash (tracker_player.h)
+} song_source_t;
+
 /**
  * Initialize song player
  */
@@ -38,12 +47,114 @@ void song_player_play(void);
 
 /**
  * Pause playback
+ * The music fades out and the sounding notes are held, so a play fades
+ * them back in and carries on from the same point
  */
 void song_player_pause(void);
 
+/**
+ * Stop playback: fade out, then silence and reset the engine
+ * The song keeps its position; use before handing the chip to MIDI input
+ */
+void song_player_stop(void);
+
+/**
+ * Set the time the pause, resume and stop fades take
+ *
+ * @param ms Ramp time in milliseconds (0 = cut, at most 10 s)
+ */
+void song_player_set_fade_time(uint16_t ms);
+
+/**
+ * Get the pause, resume and stop fade time in milliseconds
+ */
+uint16_t song_player_get_fade_time(void);
+
 /**
  * Skip to next song (restart for now)
  */
 void song_player_skip(void);
 
+/**
+ * Choose what the player plays, restarting the song
+ * The stream is the default when song_stream.h was built in
+ * 
+ * @param source SONG_SOURCE_STREAM is ignored if no stream was built in,
+ *               SONG_SOURCE_MUS (first lump) if there are no MUS lumps,
+ *               SONG_SOURCE_TRACKER (first module) if there are no modules
+ */
+void song_player_set_source(song_source_t source);
+
+/**
+ * Step to the next song: event list, stream, then each MUS lump and
+ * tracker module in turn
+ */
+void song_player_next_source(void);
+
+/**
+ * Get the current song source
+ */
+song_source_t song_player_get_source(void);
+
+/**
+ * Get the MUS lump played by SONG_SOURCE_MUS
+ * 
+ * @return Lump number (see mus_get_name())
+ */
+uint8_t song_player_get_mus(void);
+
+/**
+ * Get the tracker module played by SONG_SOURCE_TRACKER
+ * 
+ * @return Module number (see tracker_get_name())
+ */
+uint8_t song_player_get_tracker(void);
+
+/**
+ * Scale playback speed relative to the song's own tempo map
+ * Takes effect immediately without re-converting the song; ignored
+ * while slaved to MIDI clock (the master sets the tempo)
+ * 
+ * @param percent Tempo in percent of the original (25-400, 100 = as written)
+ */
+void song_player_set_tempo_scale(uint16_t percent);
+
+/**
+ * Get the current tempo scale
+ * 
+ * @return Tempo in percent of the original
+ */
+uint16_t song_player_get_tempo_scale(void);
+
+/**
+ * Slave song tempo and transport to incoming MIDI clock
+ * When enabled the song only moves while the master sends clock, and
+ * Start/Stop/Continue/Song Position Pointer drive playback
+ * 
+ * @param enabled true for external MIDI clock, false for the internal clock
+ */
+void song_player_set_clock_sync(bool enabled);
+
+/**
+ * Check whether the song follows external MIDI clock
+ * 
+ * @return true if slaved to MIDI clock
+ */
+bool song_player_get_clock_sync(void);
+
+/**
+ * Smoothed tempo of the incoming MIDI clock
+ * 
+ * @return Beats per minute, or 0 if no clock is being received
+ */
+uint16_t song_player_get_clock_bpm(void);
+
+// --- MIDI real-time handlers (called from the MIDI input interrupt) ---
+
+void song_player_midi_clock(void);                          // 0xF8 Timing Clock
+void song_player_midi_start(void);                          // 0xFA Start
+void song_player_midi_continue(void);                       // 0xFB Continue
+void song_player_midi_stop(void);                           // 0xFC Stop
+void song_player_midi_song_position(uint16_t sixteenths);   // 0xF2 Song Position Pointer
+
 #endif // SONG_PLAYER_H
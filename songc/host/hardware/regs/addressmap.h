@@ -0,0 +1,14 @@
+/**
+ * Host stand-in: "XIP flash" is a RAM image that songc can load a bank into
+ */
+
+#ifndef HOST_ADDRESSMAP_H
+#define HOST_ADDRESSMAP_H
+
+#include <stdint.h>
+
+extern uint8_t host_flash[];
+
+#define XIP_BASE ((uintptr_t)host_flash)
+
+#endif // HOST_ADDRESSMAP_H
@@ -0,0 +1,10 @@
+/**
+ * Host stand-in: songc drives the engine directly, Core 1 never starts
+ */
+
+#ifndef HOST_PICO_MULTICORE_H
+#define HOST_PICO_MULTICORE_H
+
+void multicore_launch_core1(void (*entry)(void));
+
+#endif // HOST_PICO_MULTICORE_H
@@ -0,0 +1,34 @@
+/**
+ * Host stand-in for the Pico SDK, just enough for the engine sources:
+ * time is the tool's simulated clock and GPIO does nothing
+ */
+
+#ifndef HOST_PICO_STDLIB_H
+#define HOST_PICO_STDLIB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef unsigned int uint;
+
+uint32_t time_us_32(void);
+uint64_t time_us_64(void);
+
+typedef uint64_t absolute_time_t;
+static inline absolute_time_t make_timeout_time_us(uint64_t us) { return time_us_64() + us; }
+static inline absolute_time_t delayed_by_us(absolute_time_t t, uint64_t us) { return t + us; }
+static inline bool time_reached(absolute_time_t t) { return time_us_64() >= t; }
+static inline void update_us_since_boot(absolute_time_t *t, uint64_t us) { *t = us; }
+
+// Sleep: songc never sleeps (Core 1's control tick doesn't run on the
+// host), sched_jitter moves its clock on to the wake-up time
+bool best_effort_wfe_or_timeout(absolute_time_t t);
+
+static inline void sleep_us(uint64_t us) { (void)us; }
+static inline void sleep_ms(uint32_t ms) { (void)ms; }
+
+static inline void gpio_put(uint gpio, bool value) { (void)gpio; (void)value; }
+static inline void gpio_put_masked(uint32_t mask, uint32_t value) { (void)mask; (void)value; }
+
+#endif // HOST_PICO_STDLIB_H
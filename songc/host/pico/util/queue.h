@@ -0,0 +1,21 @@
+/**
+ * Host stand-in: songc calls audio_engine_process_event(), so the event
+ * queues are never filled
+ */
+
+#ifndef HOST_PICO_QUEUE_H
+#define HOST_PICO_QUEUE_H
+
+#include "pico/stdlib.h"
+
+typedef struct {
+    uint element_size;
+} queue_t;
+
+void queue_init(queue_t *q, uint element_size, uint element_count);
+bool queue_try_add(queue_t *q, const void *data);
+bool queue_try_remove(queue_t *q, void *data);
+void queue_remove_blocking(queue_t *q, void *data);
+uint queue_get_level(queue_t *q);
+
+#endif // HOST_PICO_QUEUE_H
@@ -0,0 +1,57 @@
+/**
+ * host_pico.c
+ *
+ * Host implementations behind songc/host/ - simulated time, flash image
+ */
+
+#include "pico/stdlib.h"
+#include "pico/multicore.h"
+#include "pico/util/queue.h"
+#include "hardware/regs/addressmap.h"
+#include "bank.h"
+
+// Song time of the event being compiled (set by songc)
+uint64_t host_time_us = 0;
+
+uint8_t host_flash[BANK_FLASH_OFFSET + BANK_FLASH_SLOTS * BANK_SLOT_SIZE];
+
+uint32_t time_us_32(void) {
+    return (uint32_t)host_time_us;
+}
+
+uint64_t time_us_64(void) {
+    return host_time_us;
+}
+
+bool best_effort_wfe_or_timeout(absolute_time_t t) {
+    (void)t;
+    return true;
+}
+
+void multicore_launch_core1(void (*entry)(void)) {
+    (void)entry;
+}
+
+void queue_init(queue_t *q, uint element_size, uint element_count) {
+    (void)element_count;
+    q->element_size = element_size;
+}
+
+bool queue_try_add(queue_t *q, const void *data) {
+    (void)q; (void)data;
+    return false;
+}
+
+bool queue_try_remove(queue_t *q, void *data) {
+    (void)q; (void)data;
+    return false;
+}
+
+void queue_remove_blocking(queue_t *q, void *data) {
+    (void)q; (void)data;
+}
+
+uint queue_get_level(queue_t *q) {
+    (void)q;
+    return 0;
+}
@@ -0,0 +1,149 @@
+/**
+ * midi_parser_test.c
+ *
+ * MIDI Parser Check (host test)
+ * Feeds midi_parser.c byte streams and USB-MIDI packets and compares
+ * what it reports with what the MIDI and USB-MIDI specs say it should.
+ *
+ *   midi_parser_test
+ *
+ * Exit status 1 if any check fails.
+ */
+
+#include <stdio.h>
+#include "midi_parser.h"
+
+static int failures = 0;
+
+#define CHECK(condition) do { \
+    if (!(condition)) { \
+        printf("FAIL line %d: %s\n", __LINE__, #condition); \
+        failures++; \
+    } \
+} while (0)
+
+// Everything one stream produced, in order
+typedef struct {
+    midi_parse_result_t result;
+    MidiMessage msg;
+} Parsed;
+
+static int parse(MidiParser *parser, const uint8_t *bytes, int count, Parsed *out, int max) {
+    int n = 0;
+    for (int i = 0; i < count; i++) {
+        MidiMessage msg = {0};
+        midi_parse_result_t result = midi_parse_byte(parser, bytes[i], &msg);
+        if (result == MIDI_PARSE_NONE) continue;
+        if (n < max) out[n] = (Parsed){ result, msg };
+        n++;
+
+        // An interrupted SysEx leaves its status byte to be fed again
+        if (result == MIDI_PARSE_SYSEX_END && bytes[i] != 0xF7) i--;
+    }
+    return n;
+}
+
+static void test_running_status(void) {
+    MidiParser parser;
+    midi_parser_init(&parser);
+    Parsed out[8];
+
+    // Note On, then two more notes and a note-off (velocity 0) on running status
+    static const uint8_t bytes[] = { 0x92, 60, 100, 64, 90, 67, 0 };
+    int n = parse(&parser, bytes, sizeof(bytes), out, 8);
+    CHECK(n == 3);
+    for (int i = 0; i < 3; i++) {
+        CHECK(out[i].result == MIDI_PARSE_CHANNEL);
+        CHECK(out[i].msg.status == 0x92);
+    }
+    CHECK(out[1].msg.data[0] == 64 && out[1].msg.data[1] == 90);
+    CHECK(out[2].msg.data[0] == 67 && out[2].msg.data[1] == 0);
+
+    SongEvent event;
+    CHECK(midi_message_to_event(&out[2].msg, MIDI_SOURCE_DIN, &event));
+    CHECK(event.type == 0 && event.channel == 2 && event.note == 67);
+
+    // One-byte messages run on too
+    static const uint8_t programs[] = { 0xC5, 10, 11 };
+    n = parse(&parser, programs, sizeof(programs), out, 8);
+    CHECK(n == 2);
+    CHECK(out[0].msg.status == 0xC5 && out[0].msg.data[0] == 10);
+    CHECK(out[1].msg.status == 0xC5 && out[1].msg.data[0] == 11);
+
+    // System common cancels running status: the data bytes after it are stray
+    static const uint8_t position[] = { 0xF2, 0x10, 0x02, 0x40, 0x40 };
+    n = parse(&parser, position, sizeof(position), out, 8);
+    CHECK(n == 1);
+    CHECK(out[0].result == MIDI_PARSE_SONG_POSITION);
+    CHECK(out[0].msg.data[0] == 0x10 && out[0].msg.data[1] == 0x02);
+}
+
+static void test_sysex_interrupted(void) {
+    MidiParser parser;
+    midi_parser_init(&parser);
+    Parsed out[8];
+
+    // SysEx cut short by a Note On: the SysEx ends, then the note parses
+    static const uint8_t bytes[] = { 0xF0, 0x7D, 0x01, 0x90, 60, 100 };
+    int n = parse(&parser, bytes, sizeof(bytes), out, 8);
+    CHECK(n == 5);
+    CHECK(out[0].result == MIDI_PARSE_SYSEX_BEGIN);
+    CHECK(out[1].result == MIDI_PARSE_SYSEX_DATA && out[1].msg.data[0] == 0x7D);
+    CHECK(out[2].result == MIDI_PARSE_SYSEX_DATA && out[2].msg.data[0] == 0x01);
+    CHECK(out[3].result == MIDI_PARSE_SYSEX_END);
+    CHECK(out[4].result == MIDI_PARSE_CHANNEL);
+    CHECK(out[4].msg.status == 0x90 && out[4].msg.data[0] == 60 && out[4].msg.data[1] == 100);
+
+    // SysEx clears running status: data after a normal F7 is stray
+    static const uint8_t ended[] = { 0x90, 60, 100, 0xF0, 0x01, 0xF7, 62, 100 };
+    n = parse(&parser, ended, sizeof(ended), out, 8);
+    CHECK(n == 4);
+    CHECK(out[3].result == MIDI_PARSE_SYSEX_END);
+}
+
+static void test_realtime_inside(void) {
+    MidiParser parser;
+    midi_parser_init(&parser);
+    Parsed out[8];
+
+    // Clock between status and data, and between the two data bytes
+    static const uint8_t bytes[] = { 0xB1, 0xF8, 7, 0xFE, 100 };
+    int n = parse(&parser, bytes, sizeof(bytes), out, 8);
+    CHECK(n == 3);
+    CHECK(out[0].result == MIDI_PARSE_REALTIME && out[0].msg.status == 0xF8);
+    CHECK(out[1].result == MIDI_PARSE_REALTIME && out[1].msg.status == 0xFE);
+    CHECK(out[2].result == MIDI_PARSE_CHANNEL);
+    CHECK(out[2].msg.status == 0xB1 && out[2].msg.data[0] == 7 && out[2].msg.data[1] == 100);
+
+    // Inside SysEx the message carries on after the real-time byte
+    static const uint8_t sysex[] = { 0xF0, 0x7D, 0xFA, 0x02, 0xF7 };
+    n = parse(&parser, sysex, sizeof(sysex), out, 8);
+    CHECK(n == 5);
+    CHECK(out[2].result == MIDI_PARSE_REALTIME && out[2].msg.status == 0xFA);
+    CHECK(out[3].result == MIDI_PARSE_SYSEX_DATA && out[3].msg.data[0] == 0x02);
+    CHECK(out[4].result == MIDI_PARSE_SYSEX_END);
+}
+
+static void test_usb_lengths(void) {
+    // MIDI bytes per Code Index Number (USB MIDI 1.0, table 4-1)
+    static const uint8_t expected[16] = { 0, 0, 2, 3, 3, 1, 2, 3, 3, 3, 3, 3, 2, 2, 3, 1 };
+    for (uint8_t cin = 0; cin < 16; cin++) {
+        // The cable number in the high nibble must not matter
+        uint8_t packet[4] = { (uint8_t)(0x30 | cin), 0, 0, 0 };
+        CHECK(midi_usb_packet_length(packet) == expected[cin]);
+    }
+}
+
+int main(void) {
+    test_running_status();
+    test_sysex_interrupted();
+    test_realtime_inside();
+    test_usb_lengths();
+
+    if (failures) {
+        printf("%d checks failed\n", failures);
+        return 1;
+    }
+    printf("midi_parser: all checks passed\n");
+    return 0;
+}
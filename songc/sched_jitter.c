@@ -0,0 +1,158 @@
+/**
+ * sched_jitter.c
+ *
+ * Core 0 Scheduler Jitter Check (host test)
+ * Runs the real scheduler.c with the task set of PicoOPL2.c (periods and
+ * budgets from scheduler.h) on a simulated clock and measures how late
+ * song events are released.
+ *
+ *   sched_jitter [task=us ...]
+ *
+ * Every run of a task moves the clock on by a pseudo-random time up to
+ * the task's budget, so the test covers whatever the budgets allow, in
+ * every phase against the song task. Song events fall due at
+ * pseudo-random times, and the song task releases all that are due, like
+ * song_player_update(). The release jitter of an event is the time from
+ * its due time to the run that releases it.
+ *
+ * A task=us argument replaces a task's budget with the worst run measured
+ * on hardware (console "stats", e.g. sched_jitter ui=140 con=95), to see
+ * whether the firmware as it runs still meets the limit.
+ *
+ * Exit status 1 if the worst jitter reaches SCHED_JITTER_LIMIT_US.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "scheduler.h"
+
+#define RUN_US            (10 * 1000000)   // Simulated time
+#define EVENT_GAP_MAX_US  2000             // Between song events
+#define EVENT_US          3                // Song task: one event into the queue
+
+// Simulated clock: tasks advance it, sleeping jumps it to the wake-up time
+static uint64_t sim_time_us = 0;
+
+uint32_t time_us_32(void) {
+    return (uint32_t)sim_time_us;
+}
+
+uint64_t time_us_64(void) {
+    return sim_time_us;
+}
+
+bool best_effort_wfe_or_timeout(absolute_time_t t) {
+    if (t > sim_time_us) sim_time_us = t;
+    return true;
+}
+
+// xorshift32: the same costs and event times on every run
+static uint32_t random_state = 0x2545F491;
+
+static uint32_t random_us(uint32_t min, uint32_t max) {
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return min + random_state % (max - min + 1);
+}
+
+// --- TASKS ---
+
+// Longest run of each task: its budget, or a measured worst case
+static uint32_t song_max_us = SCHED_SONG_BUDGET_US;
+static uint32_t usb_max_us = SCHED_USB_BUDGET_US;
+static uint32_t ui_max_us = SCHED_UI_BUDGET_US;
+static uint32_t con_max_us = SCHED_CON_BUDGET_US;
+
+static uint64_t next_due_us = 0;
+static uint32_t released = 0;
+static uint64_t jitter_max_us = 0;
+static uint64_t jitter_total_us = 0;
+
+// Reads the song position once, releases what is due, then does the rest
+// of its work (lookahead, prefetch)
+static void song_task(void) {
+    uint64_t start = sim_time_us;
+    uint32_t cost = random_us(1, song_max_us);
+
+    while (next_due_us <= start) {
+        uint64_t jitter = sim_time_us - next_due_us;
+        if (jitter > jitter_max_us) jitter_max_us = jitter;
+        jitter_total_us += jitter;
+        released++;
+
+        sim_time_us += EVENT_US;
+        next_due_us += random_us(0, EVENT_GAP_MAX_US);
+    }
+    if (sim_time_us < start + cost) sim_time_us = start + cost;
+}
+
+static void usb_task(void) {
+    sim_time_us += random_us(1, usb_max_us);
+}
+
+static void ui_task(void) {
+    sim_time_us += random_us(1, ui_max_us);
+}
+
+static void console_task(void) {
+    sim_time_us += random_us(1, con_max_us);
+}
+
+// task=us from the command line
+static bool set_cost(const char *arg) {
+    static const struct { const char *name; uint32_t *max_us; } costs[] = {
+        { "song", &song_max_us }, { "usb", &usb_max_us }, { "ui", &ui_max_us }, { "con", &con_max_us }
+    };
+    const char *equals = strchr(arg, '=');
+    if (!equals) return false;
+
+    for (size_t i = 0; i < sizeof(costs) / sizeof(costs[0]); i++) {
+        if (strlen(costs[i].name) == (size_t)(equals - arg) &&
+            strncmp(arg, costs[i].name, (size_t)(equals - arg)) == 0) {
+            int us = atoi(equals + 1);
+            if (us <= 0) return false;
+            *costs[i].max_us = (uint32_t)us;
+            return true;
+        }
+    }
+    return false;
+}
+
+int main(int argc, char **argv) {
+    for (int i = 1; i < argc; i++) {
+        if (!set_cost(argv[i])) {
+            fprintf(stderr, "usage: sched_jitter [song|usb|ui|con=us ...]\n");
+            return 2;
+        }
+    }
+
+    // Same order, periods and budgets as PicoOPL2.c
+    scheduler_add("song", song_task, SCHED_SONG_PERIOD_US, SCHED_SONG_BUDGET_US);
+    scheduler_add("usb", usb_task, SCHED_USB_PERIOD_US, SCHED_USB_BUDGET_US);
+    scheduler_add("ui", ui_task, SCHED_UI_PERIOD_US, SCHED_UI_BUDGET_US);
+    scheduler_add("con", console_task, SCHED_CON_PERIOD_US, SCHED_CON_BUDGET_US);
+
+    while (sim_time_us < RUN_US) {
+        scheduler_run_once();
+    }
+
+    printf("%u song events, release jitter %llu us average, %llu us worst (limit %u us)\n",
+           (unsigned)released, (unsigned long long)(released ? jitter_total_us / released : 0),
+           (unsigned long long)jitter_max_us, SCHED_JITTER_LIMIT_US);
+
+    SchedStats stats;
+    for (uint8_t i = 0; scheduler_get_stats(i, &stats); i++) {
+        printf("%-5s %5u us period, %4u us budget, %4u us worst, %u overruns\n", stats.name,
+               (unsigned)stats.period_us, (unsigned)stats.budget_us, (unsigned)stats.max_us,
+               (unsigned)stats.overruns);
+    }
+
+    if (jitter_max_us >= SCHED_JITTER_LIMIT_US) {
+        printf("FAIL: worst release jitter %llu us\n", (unsigned long long)jitter_max_us);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,226 @@
+/**
+ * songc.c
+ *
+ * Register-Stream Song Compiler (host tool)
+ * Plays song_data.h through the real audio engine, voice manager and
+ * instrument code with the OPL2 register trace attached, and writes what
+ * the chip would have received as a register stream (see opl2_stream.h).
+ *
+ *   songc <song_stream.h> [bank file]
+ *
+ * With a bank file (any format bank.h reads) the song is compiled against
+ * that bank as flash bank 1 instead of the built-in one.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "audio_engine.h"
+#include "bank.h"
+#include "midi_state.h"
+#include "voice_manager.h"
+#include "opl2.h"
+#include "opl2_stream.h"
+#include "perf.h"
+#include "song_data.h"
+
+// A register stream drives one chip (opl2_stream.h)
+#if OPL2_CHIPS != 1
+#error "songc builds for one chip: configure it without -DOPL2_CHIPS"
+#endif
+
+#define SONG_LEN   (sizeof(midi_song) / sizeof(midi_song[0]))
+#define TEMPO_LEN  (sizeof(midi_song_tempo) / sizeof(midi_song_tempo[0]))
+
+extern uint64_t host_time_us;
+extern uint8_t host_flash[];
+
+// Stream being built
+static uint8_t *stream = NULL;
+static size_t stream_len = 0;
+static size_t stream_cap = 0;
+static uint32_t stream_units = 0;   // Time reached by the waits written so far
+static uint32_t now_units = 0;      // Time of the event being compiled
+static uint32_t write_count = 0;
+
+// A0/B0 writes still to come from a traced key-on/key-off (kept symbolic)
+static uint8_t pitch_writes_pending[9];
+
+static void emit(uint8_t byte) {
+    if (stream_len == stream_cap) {
+        stream_cap = stream_cap ? stream_cap * 2 : 4096;
+        stream = realloc(stream, stream_cap);
+        if (stream == NULL) {
+            fprintf(stderr, "songc: out of memory\n");
+            exit(1);
+        }
+    }
+    stream[stream_len++] = byte;
+}
+
+// Catch the stream up to the current event's time
+static void emit_wait(void) {
+    while (stream_units < now_units) {
+        uint32_t units = now_units - stream_units;
+        if (units <= 0xFF) {
+            emit(STREAM_OP_WAIT);
+            emit((uint8_t)units);
+        } else {
+            if (units > 0xFFFF) units = 0xFFFF;
+            emit(STREAM_OP_WAIT16);
+            emit(units & 0xFF);
+            emit(units >> 8);
+        }
+        stream_units += units;
+    }
+}
+
+// --- REGISTER TRACE ---
+
+// Streams are for one chip (OPL2_CHIPS is 1, checked above), so chip is 0
+static void trace_write(uint8_t chip, uint8_t reg, uint8_t data) {
+    (void)chip;
+    if ((reg >= 0xA0 && reg <= 0xA8) || (reg >= 0xB0 && reg <= 0xB8)) {
+        uint8_t ch = reg & 0x0F;
+        if (pitch_writes_pending[ch] > 0) {
+            pitch_writes_pending[ch]--;
+            return;
+        }
+    }
+    emit_wait();
+    emit(reg);
+    emit(data);
+    write_count++;
+}
+
+static void trace_note_on(uint8_t channel, uint8_t midi_note, int16_t fine) {
+    if (fine < -128) fine = -128;
+    if (fine > 127) fine = 127;
+
+    emit_wait();
+    emit(STREAM_OP_NOTE_ON);
+    emit(channel);
+    emit(midi_note);
+    emit((uint8_t)(int8_t)fine);
+    pitch_writes_pending[channel] = 2;  // A0, B0
+    write_count += 2;
+}
+
+static void trace_note_off(uint8_t channel) {
+    emit_wait();
+    emit(STREAM_OP_NOTE_OFF);
+    emit(channel);
+    pitch_writes_pending[channel] = 1;  // B0
+    write_count++;
+}
+
+static const OPL2Trace recorder = {
+    .write = trace_write,
+    .note_on = trace_note_on,
+    .note_off = trace_note_off
+};
+
+// --- SONG CLOCK ---
+
+// Microseconds from the start of the song to a tick, through the tempo map
+static uint64_t tick_to_us(uint32_t tick) {
+    uint64_t us = 0;
+    uint32_t i = 0;
+    while (i + 1 < TEMPO_LEN && midi_song_tempo[i + 1].tick <= tick) {
+        uint32_t span = midi_song_tempo[i + 1].tick - midi_song_tempo[i].tick;
+        us += (uint64_t)span * midi_song_tempo[i].us_per_quarter / MIDI_SONG_PPQ;
+        i++;
+    }
+    return us + (uint64_t)(tick - midi_song_tempo[i].tick) * midi_song_tempo[i].us_per_quarter / MIDI_SONG_PPQ;
+}
+
+static bool load_bank(const char *path) {
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) return false;
+    size_t n = fread(host_flash + BANK_FLASH_OFFSET, 1, BANK_SLOT_SIZE, f);
+    fclose(f);
+    return n > 0;
+}
+
+static bool write_header(const char *path) {
+    FILE *f = fopen(path, "w");
+    if (f == NULL) return false;
+
+    fprintf(f, "#ifndef SONG_STREAM_H\n#define SONG_STREAM_H\n\n");
+    fprintf(f, "// Generated by songc from song_data.h - see opl2_stream.h\n");
+    fprintf(f, "// %u register writes, %.1f s\n\n", write_count,
+            stream_units * (double)STREAM_TICK_US / 1e6);
+    fprintf(f, "#include <stdint.h>\n\n");
+    fprintf(f, "const uint8_t song_stream[%zu] = {", stream_len);
+    for (size_t i = 0; i < stream_len; i++) {
+        fprintf(f, "%s0x%02X,", (i % 16) ? " " : "\n    ", stream[i]);
+    }
+    fprintf(f, "\n};\n\n#endif\n");
+    fclose(f);
+    return true;
+}
+
+// Counters from a PERF build (host: nanoseconds)
+static void print_perf(void) {
+    const PerfCounter *counters = perf_counters(0);
+    if (!counters) return;
+    for (int id = 0; id < PERF_COUNT; id++) {
+        const PerfCounter *c = &counters[id];
+        if (c->calls == 0) continue;
+        printf("  %-12s %8u calls, %6llu ns average, %6u ns worst\n", perf_name((perf_id_t)id), c->calls,
+               (unsigned long long)(c->total / c->calls), c->max);
+    }
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: songc <song_stream.h> [bank file]\n");
+        return 1;
+    }
+
+    // Empty flash, plus the bank to compile against in slot 0 (bank 1)
+    memset(host_flash, 0xFF, BANK_FLASH_OFFSET + BANK_FLASH_SLOTS * BANK_SLOT_SIZE);
+    if (argc > 2 && !load_bank(argv[2])) {
+        fprintf(stderr, "songc: can't read bank %s\n", argv[2]);
+        return 1;
+    }
+    bank_init();
+    if (argc > 2 && !bank_select(1)) {
+        fprintf(stderr, "songc: %s is not a bank file\n", argv[2]);
+        return 1;
+    }
+
+    midi_state_init();
+    invalidate_channel_programs();  // No channel holds a patch yet
+    init_voices();
+    opl2_set_trace(&recorder);
+
+    // Same defaults the player sets up before a song
+    load_drum_patch(DRUM_VOICE, 36);
+
+    uint32_t tick = 0;
+    uint32_t events = 0;
+    for (uint32_t i = 0; i < SONG_LEN; i++) {
+        const SongTickEvent *e = &midi_song[i];
+        tick += e->delta_ticks;
+        if (e->type == 2) break;
+        if (e->type == 255) continue;
+
+        host_time_us = tick_to_us(tick);
+        now_units = (uint32_t)((host_time_us + STREAM_TICK_US / 2) / STREAM_TICK_US);
+
+        SongEvent event = { .type = e->type, .voice = e->voice, .delay_ms = 0, .channel = e->channel,
+                            .note = e->note, .velocity = e->velocity };
+        audio_engine_process_event(&event);
+        events++;
+    }
+    emit(STREAM_OP_END);
+
+    if (!write_header(argv[1])) {
+        fprintf(stderr, "songc: can't write %s\n", argv[1]);
+        return 1;
+    }
+    printf("songc: %u events -> %u register writes, %zu bytes\n", events, write_count, stream_len);
+    print_perf();
+    return 0;
+}
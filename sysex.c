@@ -0,0 +1,127 @@
+/**
+ * sysex.c
+ * 
+ * SysEx Patch Upload Implementation
+ * Byte-at-a-time decoder for the protocol described in sysex.h
+ */
+
+#include "sysex.h"
+#include "audio_engine.h"
+#include "instruments.h"
+
+#define RECORD_NIBBLES 22
+
+// Decoder state
+static bool active = false;        // Message is ours and still in sync
+static uint16_t header_pos = 0;    // Bytes seen after F0 while parsing the header
+static uint8_t command = 0;
+static uint16_t program = 0;       // Program the current record loads
+static uint8_t record[11];
+static uint8_t nibble_count = 0;
+static uint8_t checksum = 0;
+static bool record_seen = false;   // Single-patch messages carry exactly one record
+
+// Statistics
+static volatile uint32_t patch_count = 0;
+static volatile uint32_t error_count = 0;
+static volatile uint32_t failed_programs[256 / 32];  // Bit per program: last record rejected
+
+// Count a rejected record, and remember its program if it has one
+static void reject_record(void) {
+    error_count++;
+    if (program <= 255) failed_programs[program >> 5] |= 1u << (program & 31);
+}
+
+static void finish_record(uint8_t cs_byte) {
+    checksum += cs_byte;
+    if ((checksum & 0x7F) != 0 || program > 255 || (command == SYSEX_CMD_PATCH && record_seen)) {
+        reject_record();
+    } else {
+        // Bytes land in OPL_Patch field order
+        OPL_Patch patch = {
+            .m_ave = record[0], .m_ksl = record[1], .m_atdec = record[2],
+            .m_susrel = record[3], .m_wave = record[4],
+            .c_ave = record[5], .c_ksl = record[6], .c_atdec = record[7],
+            .c_susrel = record[8], .c_wave = record[9],
+            .feedback = record[10]
+        };
+        if (audio_engine_update_patch((uint8_t)program, &patch)) {
+            patch_count++;
+            failed_programs[program >> 5] &= ~(1u << (program & 31));
+        } else {
+            reject_record();
+        }
+    }
+
+    record_seen = true;
+    program++;
+    nibble_count = 0;
+    checksum = (program >> 4) + (program & 0x0F);
+}
+
+void sysex_begin(void) {
+    active = true;
+    header_pos = 0;
+    nibble_count = 0;
+    record_seen = false;
+}
+
+void sysex_byte(uint8_t byte) {
+    if (!active) return;
+
+    // Header: ID, command, program hi/lo
+    if (header_pos < 4) {
+        switch (header_pos) {
+            case 0:
+                if (byte != SYSEX_MANUFACTURER_ID) active = false;  // Not for us
+                break;
+            case 1:
+                command = byte;
+                if (command != SYSEX_CMD_PATCH && command != SYSEX_CMD_BANK) active = false;
+                break;
+            case 2:
+                program = (byte & 0x0F) << 4;
+                break;
+            case 3:
+                program |= byte & 0x0F;
+                checksum = (program >> 4) + (program & 0x0F);
+                break;
+        }
+        header_pos++;
+        return;
+    }
+
+    // Record body
+    if (nibble_count < RECORD_NIBBLES) {
+        uint8_t nibble = byte & 0x0F;
+        if (nibble_count & 1) {
+            record[nibble_count >> 1] |= nibble;
+        } else {
+            record[nibble_count >> 1] = nibble << 4;
+        }
+        checksum += byte;  // Sum the raw byte so stray high bits fail the check
+        nibble_count++;
+    } else {
+        finish_record(byte);
+    }
+}
+
+void sysex_end(void) {
+    // A partial record at the end means the dump was cut short
+    if (active && header_pos >= 4 && nibble_count > 0) {
+        reject_record();
+    }
+    active = false;
+}
+
+uint32_t sysex_get_patch_count(void) {
+    return patch_count;
+}
+
+uint32_t sysex_get_error_count(void) {
+    return error_count;
+}
+
+bool sysex_program_failed(uint8_t program) {
+    return (failed_programs[program >> 5] >> (program & 31)) & 1;
+}
@@ -0,0 +1,84 @@
+/**
+ * sysex.h
+ * 
+ * SysEx Patch Upload
+ * Streams OPL2 patches into the current bank at runtime over MIDI System Exclusive
+ *
+ * PROTOCOL
+ * --------
+ *   Single patch:  F0 7D 01 <p_hi> <p_lo> <record> F7
+ *   Bank dump:     F0 7D 02 <p_hi> <p_lo> <record> <record> ... F7
+ *
+ *   7D            Manufacturer ID reserved for non-commercial use
+ *   p_hi, p_lo    First program number (0-255) as two nibbles: p >> 4, p & 0x0F
+ *   <record>      One patch: 22 data nibbles + 1 checksum byte (23 bytes)
+ *
+ * A bank dump carries 1-256 records for consecutive programs starting at p,
+ * so a full bank is F0 7D 02 00 00 followed by 256 records (5894 bytes,
+ * about 1.9 s at 31250 baud).
+ *
+ * Record data is the 11 OPL_Patch bytes in struct order
+ *   m_ave, m_ksl, m_atdec, m_susrel, m_wave,
+ *   c_ave, c_ksl, c_atdec, c_susrel, c_wave, feedback
+ * each sent high nibble first.
+ *
+ * Checksum (Roland style): the low 7 bits of
+ *   (program >> 4) + (program & 0x0F) + all 22 data nibbles + checksum
+ * must be zero, where program is the program this record loads. Including
+ * the program catches records that slipped out of alignment.
+ *
+ * Each record is checked and applied as soon as it completes, so a bank
+ * dump never needs buffering and patches change while the song plays.
+ * A record with a bad checksum is dropped; the rest of the dump continues.
+ * The engine's patch queue holds a full bank dump, so records are only
+ * lost to a queue still full from an earlier dump. Every program whose
+ * record was dropped is remembered until one loads it (console "sysex").
+ */
+
+#ifndef SYSEX_H
+#define SYSEX_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SYSEX_MANUFACTURER_ID 0x7D
+#define SYSEX_CMD_PATCH       0x01
+#define SYSEX_CMD_BANK        0x02
+
+/**
+ * Start of a SysEx message (0xF0 received)
+ */
+void sysex_begin(void);
+
+/**
+ * Feed one SysEx data byte (0x00-0x7F)
+ * Safe to call from the UART interrupt - decoded patches are queued to Core 1
+ * 
+ * @param byte Data byte following 0xF0
+ */
+void sysex_byte(uint8_t byte);
+
+/**
+ * End of a SysEx message (0xF7 received, or aborted by another status byte)
+ */
+void sysex_end(void);
+
+/**
+ * Number of patch records accepted since boot
+ */
+uint32_t sysex_get_patch_count(void);
+
+/**
+ * Number of patch records rejected (bad checksum, truncated, queue full)
+ */
+uint32_t sysex_get_error_count(void);
+
+/**
+ * Check whether the last record sent for a program was rejected
+ *
+ * @param program Program number (0-255)
+ * @return true until a later record loads the program
+ */
+bool sysex_program_failed(uint8_t program);
+
+#endif // SYSEX_H
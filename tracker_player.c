@@ -0,0 +1,724 @@
+/**
+ * tracker_player.c
+ *
+ * AdLib Tracker Module Player Implementation
+ *
+ * RAD v1 (version 0x10) module layout:
+ *   "RAD by REALiTY!!", version 0x10, flags (bit 7 description follows,
+ *   bit 6 slow timer, bits 0-4 initial speed), description text ending 0,
+ *   instruments (number 1-31 then 11 register bytes, number 0 ends),
+ *   order list (length, then pattern numbers; bit 7 = jump to order n),
+ *   32 pattern offsets, then the patterns.
+ *
+ * A pattern is 64 lines; only lines with notes or effects are stored:
+ *   line byte     bits 0-5 line, bit 7 last line of the pattern
+ *   channel byte  bits 0-3 channel, bit 7 last channel of the line
+ *   note byte     bits 0-3 note (1-12 = C# to C, 15 = key off),
+ *                 bits 4-6 octave, bit 7 instrument bit 4
+ *   effect byte   bits 4-7 instrument bits 0-3, bits 0-3 effect
+ *   parameter     only if the effect is not 0
+ *
+ * RAD v2 (version 0x21) module layout:
+ *   "RAD by REALiTY!!", version 0x21, flags (bit 6 slow timer, bit 5 BPM
+ *   follows, bits 0-4 initial speed), BPM (2 bytes, if flagged),
+ *   description text ending 0,
+ *   instruments (number 1-127, name length and name, algorithm byte -
+ *   bits 0-2 algorithm, 7 = MIDI, bit 7 riff follows - then feedback,
+ *   detune/riff speed, volume and 4 operators of 5 register bytes
+ *   (operator 0 is the carrier of a 2-op instrument), or 6 bytes of MIDI
+ *   data; then the riff as a 2-byte length and data; number 0 ends),
+ *   order list as in v1, then the patterns (number 0-99, 2-byte length,
+ *   data; a number past 99 ends) and the riffs, which are not played.
+ *
+ * v2 lines start like v1 (bits 0-6 line); each channel entry is
+ *   channel byte  bits 0-3 channel, bit 4 effect follows, bit 5 instrument
+ *                 follows, bit 6 note follows, bit 7 last channel
+ *   note byte     as v1, but bit 7 = play the channel's last instrument
+ *   instrument    1-127
+ *   effect        effect (0-31), then its parameter (0-99)
+ *
+ * Both formats share effects 1-F. RAD has no vibrato or arpeggio, so the
+ * player takes ProTracker's free numbers for them: 4xy vibrato (speed x,
+ * depth y) and, in v2 where effect 0 can carry a parameter, 0xy arpeggio.
+ * Parameters are decimal as everywhere in RAD (xy = 10x + y). The v2-only
+ * effects (riffs, transpose, multiplier, feedback, operator volume) are
+ * ignored, OPL3 4-op instruments play their first operator pair and MIDI
+ * instruments stay silent.
+ */
+
+#include "tracker_player.h"
+#include "pico/stdlib.h"
+#include "hardware/regs/addressmap.h"
+#include "audio_engine.h"
+#include "modulation.h"
+#include "queue.h"
+#include <stdio.h>
+#include <string.h>
+
+#define RAD_V1            0x10
+#define RAD_V2            0x21
+#define RAD_INSTRUMENTS   127     // v1 has 31
+#define RAD_PATTERNS      100     // v1 has 32
+#define RAD_V1_PATTERNS   32
+#define RAD_LINES         64
+#define RAD_ALG_MIDI      7
+#define RAD_INST_LAST     0xFF    // v2 entry: the channel's last instrument
+
+#define RAD_NOTE_OFF      15
+
+#define RATE_FAST_US      20000   // 50 Hz
+#define RATE_SLOW_US      54945   // 18.2 Hz (PC timer default)
+
+// Frequency numbers for C# to C; an octave spans FNUM_LOW to FNUM_HIGH
+#define FNUM_LOW          0x156
+#define FNUM_HIGH         0x2AE
+static const uint16_t note_fnum[12] = {
+    0x16B, 0x181, 0x198, 0x1B0, 0x1CA, 0x1E5, 0x202, 0x220, 0x241, 0x263, 0x287, 0x2AE
+};
+
+// v1 instrument bytes as stored in the file
+enum {
+    INS_CAR_20, INS_MOD_20, INS_CAR_40, INS_MOD_40, INS_CAR_60, INS_MOD_60,
+    INS_CAR_80, INS_MOD_80, INS_C0, INS_CAR_E0, INS_MOD_E0, INS_SIZE
+};
+
+// v2 instrument: algorithm, feedback, detune/riff speed, volume, 4 operators
+#define INS2_SIZE         24
+#define INS2_MIDI_SIZE    7
+
+// An instrument decoded from either format; operator bytes in register
+// order (0x20, 0x40, 0x60, 0x80, 0xE0)
+enum { OP_20, OP_40, OP_60, OP_80, OP_E0, OP_SIZE };
+
+typedef struct {
+    uint8_t mod[OP_SIZE];
+    uint8_t car[OP_SIZE];
+    uint8_t c0;                 // Feedback and connection
+    uint8_t volume;             // Instrument volume, 0-64 (64 in v1)
+} TrackerInstrument;
+
+// One channel entry of a line, from either format
+typedef struct {
+    uint8_t channel;
+    uint8_t note;               // Bits 0-3 note, bits 4-6 octave (0 = none)
+    uint8_t inst;               // 0 = none, RAD_INST_LAST
+    uint8_t effect;
+    uint8_t param;
+} TrackerEntry;
+
+static const uint8_t op_offsets[9] = {0, 1, 2, 8, 9, 10, 16, 17, 18};
+
+// Slots holding a valid module
+static uint8_t module_slots[TRACKER_FLASH_SLOTS];
+static uint8_t module_count = 0;
+
+// Current module, parsed in place
+static const uint8_t *module = NULL;
+static uint8_t version = RAD_V1;
+static const uint8_t *instruments[RAD_INSTRUMENTS];
+static const uint8_t *order_list = NULL;
+static uint8_t order_length = 0;
+static const uint8_t *patterns[RAD_PATTERNS];
+static uint32_t tick_us = RATE_FAST_US;
+
+typedef struct {
+    TrackerInstrument instrument;
+    bool has_instrument;
+    uint8_t last_instrument;    // v2: the one a "last instrument" note plays
+    uint8_t volume;             // 0-64
+    uint16_t fnum;
+    uint8_t block;
+    bool key_on;
+    bool retrigger;             // Key must go off and on again this tick
+
+    uint8_t effect;             // Running effect for this line
+    uint8_t param;
+    uint16_t slide_fnum;        // Tone slide target
+    uint8_t slide_block;
+    uint8_t slide_speed;
+    uint8_t vibrato;            // Last vibrato parameter (4xy with xy = 0 reuses it)
+
+    uint8_t pitch_fx;           // CHANNEL_FX_* and parameter Core 1 was last sent
+    uint8_t pitch_param;
+} TrackerChannel;
+
+// Position
+static TrackerChannel channels[9];
+static uint8_t speed = 6;                 // Ticks per line
+static uint8_t tick_count = 0;
+static uint8_t order_pos = 0;
+static uint8_t line = 0;
+static const uint8_t *line_ptr = NULL;    // Next stored line of the pattern (NULL = none)
+static int8_t break_line = -1;            // Pattern break: line to start the next pattern at
+static volatile bool finished = false;
+
+// Register image the tracker wants, and what Core 1 was last sent
+static uint8_t regs[256];
+static uint8_t sent[256];
+#define RESYNC_ALL 0x1FF
+static uint16_t resync = RESYNC_ALL;      // Channels to send in full, not just the changes
+static bool dropped = false;              // An event of this channel didn't fit in the queue
+
+// Timer
+static repeating_timer_t timer;
+static volatile bool running = false;
+static volatile uint32_t period_us = RATE_FAST_US;
+static uint16_t tempo_percent = 100;
+
+// --- MODULE ---
+
+static const uint8_t* slot_address(uint8_t slot) {
+    return (const uint8_t*)(uintptr_t)(XIP_BASE + TRACKER_FLASH_OFFSET + (uint32_t)slot * TRACKER_SLOT_SIZE);
+}
+
+static uint16_t read16(const uint8_t *p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+// v1: instruments, order list and the pattern offset table
+static bool parse_v1(const uint8_t *data) {
+    uint8_t flags = data[17];
+    uint32_t pos = 18;
+    if (flags & 0x80) {
+        while (pos < TRACKER_SLOT_SIZE && data[pos] != 0) pos++;
+        pos++;
+    }
+
+    while (pos < TRACKER_SLOT_SIZE && data[pos] != 0) {
+        uint8_t number = data[pos++];
+        if (number > 31 || pos + INS_SIZE > TRACKER_SLOT_SIZE) return false;
+        instruments[number - 1] = data + pos;
+        pos += INS_SIZE;
+    }
+    pos++;
+
+    if (pos >= TRACKER_SLOT_SIZE) return false;
+    order_length = data[pos++];
+    order_list = data + pos;
+    pos += order_length;
+
+    if (pos + RAD_V1_PATTERNS * 2 > TRACKER_SLOT_SIZE) return false;
+    for (uint8_t i = 0; i < RAD_V1_PATTERNS; i++) {
+        uint16_t offset = read16(data + pos + i * 2);
+        if (offset != 0 && offset < TRACKER_SLOT_SIZE) patterns[i] = data + offset;
+    }
+
+    speed = (flags & 0x1F) ? (flags & 0x1F) : 6;
+    tick_us = (flags & 0x40) ? RATE_SLOW_US : RATE_FAST_US;
+    return true;
+}
+
+// v2: instruments (with names and riffs), order list and the patterns,
+// which follow each other with their lengths
+static bool parse_v2(const uint8_t *data) {
+    uint8_t flags = data[17];
+    uint32_t pos = 18;
+    uint16_t bpm = 0;
+    if (flags & 0x20) {
+        bpm = read16(data + pos);
+        pos += 2;
+    }
+    while (pos < TRACKER_SLOT_SIZE && data[pos] != 0) pos++;
+    pos++;
+
+    while (pos < TRACKER_SLOT_SIZE && data[pos] != 0) {
+        uint8_t number = data[pos++];
+        if (number > RAD_INSTRUMENTS || pos >= TRACKER_SLOT_SIZE) return false;
+        pos += 1 + data[pos];  // Name
+        if (pos >= TRACKER_SLOT_SIZE) return false;
+
+        uint8_t algorithm = data[pos];
+        uint32_t size = (algorithm & 0x07) == RAD_ALG_MIDI ? INS2_MIDI_SIZE : INS2_SIZE;
+        if (pos + size + 2 > TRACKER_SLOT_SIZE) return false;
+        instruments[number - 1] = data + pos;
+        pos += size;
+        if (algorithm & 0x80) pos += 2 + read16(data + pos);  // Riff
+    }
+    pos++;
+
+    if (pos >= TRACKER_SLOT_SIZE) return false;
+    order_length = data[pos++];
+    order_list = data + pos;
+    pos += order_length;
+
+    while (pos + 3 <= TRACKER_SLOT_SIZE && data[pos] < RAD_PATTERNS) {
+        uint8_t number = data[pos];
+        uint16_t length = read16(data + pos + 1);
+        pos += 3;
+        if (pos + length > TRACKER_SLOT_SIZE) return false;
+        patterns[number] = data + pos;
+        pos += length;
+    }
+    if (pos >= TRACKER_SLOT_SIZE) return false;
+
+    speed = (flags & 0x1F) ? (flags & 0x1F) : 6;
+    if (flags & 0x40) tick_us = RATE_SLOW_US;
+    else if (bpm > 0) tick_us = 2500000 / bpm;  // 125 BPM = 50 Hz
+    else tick_us = RATE_FAST_US;
+    return true;
+}
+
+// Locate the instruments, order list and patterns; false if the file
+// doesn't hold together or is a version this player doesn't read
+static bool parse_module(const uint8_t *data) {
+    if (memcmp(data, "RAD by REALiTY!!", 16) != 0) return false;
+    if (data[16] != RAD_V1 && data[16] != RAD_V2) return false;
+
+    memset(instruments, 0, sizeof(instruments));
+    memset(patterns, 0, sizeof(patterns));
+    version = data[16];
+    if (!(version == RAD_V1 ? parse_v1(data) : parse_v2(data))) return false;
+
+    module = data;
+    return true;
+}
+
+static const uint8_t* pattern_start(uint8_t pattern) {
+    return pattern < RAD_PATTERNS ? patterns[pattern] : NULL;
+}
+
+// Decode the channel entry at p; returns what follows it, last set on the
+// line's last channel
+static const uint8_t* read_entry(const uint8_t *p, TrackerEntry *e, bool *last) {
+    uint8_t c = *p++;
+    *last = c & 0x80;
+    e->channel = c & 0x0F;
+
+    if (version == RAD_V1) {
+        uint8_t note_byte = *p++;
+        uint8_t fx = *p++;
+        e->note = note_byte & 0x7F;
+        e->inst = ((note_byte & 0x80) >> 3) | (fx >> 4);
+        e->effect = fx & 0x0F;
+        e->param = e->effect ? *p++ : 0;
+        return p;
+    }
+
+    e->note = 0;
+    e->inst = 0;
+    e->effect = 0;
+    e->param = 0;
+    if (c & 0x40) {
+        uint8_t note_byte = *p++;
+        e->note = note_byte & 0x7F;
+        if (note_byte & 0x80) e->inst = RAD_INST_LAST;
+    }
+    if (c & 0x20) e->inst = *p++;
+    if (c & 0x10) {
+        e->effect = *p++;
+        e->param = *p++;
+    }
+    return p;
+}
+
+// Step over one stored line (its channel entries) and return what follows it
+static const uint8_t* skip_line(const uint8_t *p) {
+    bool last_line = *p++ & 0x80;
+    bool last;
+    TrackerEntry e;
+    do {
+        p = read_entry(p, &e, &last);
+    } while (!last);
+    return last_line ? NULL : p;
+}
+
+// Enter an order, following jumps, at a line of its pattern
+static void enter_order(uint8_t pos, uint8_t start_line) {
+    // Jumps can only chain through the order list once
+    for (uint8_t hops = 0; pos < order_length && (order_list[pos] & 0x80) && hops < order_length; hops++) {
+        pos = order_list[pos] & 0x7F;
+    }
+    order_pos = pos;
+    line = start_line;
+    if (pos >= order_length || (order_list[pos] & 0x80)) {
+        finished = true;
+        line_ptr = NULL;
+        return;
+    }
+
+    line_ptr = pattern_start(order_list[pos]);
+    while (line_ptr != NULL && (*line_ptr & 0x7F) < start_line) {
+        line_ptr = skip_line(line_ptr);
+    }
+}
+
+// --- REGISTER IMAGE ---
+
+static void set_pitch(uint8_t ch) {
+    TrackerChannel *c = &channels[ch];
+    regs[0xA0 + ch] = c->fnum & 0xFF;
+    regs[0xB0 + ch] = (c->key_on ? 0x20 : 0) | (c->block << 2) | ((c->fnum >> 8) & 0x03);
+}
+
+// Level of an operator at the channel volume times the instrument's
+static uint8_t scaled_level(uint8_t tl, const TrackerChannel *c) {
+    uint8_t level = 63 - (uint8_t)((uint32_t)(63 - (tl & 0x3F)) * c->volume * c->instrument.volume / (64 * 64));
+    return (tl & 0xC0) | level;
+}
+
+// Carrier level (and the modulator's, for additive instruments) follows the channel volume
+static void set_volume(uint8_t ch) {
+    TrackerChannel *c = &channels[ch];
+    if (!c->has_instrument) return;
+
+    const TrackerInstrument *inst = &c->instrument;
+    regs[0x43 + op_offsets[ch]] = scaled_level(inst->car[OP_40], c);
+    regs[0x40 + op_offsets[ch]] = (inst->c0 & 0x01) ? scaled_level(inst->mod[OP_40], c) : inst->mod[OP_40];
+}
+
+// Decode an instrument as stored in the module; false for one that can't
+// play on OPL2 (v2 MIDI instruments)
+static bool decode_instrument(const uint8_t *p, TrackerInstrument *out) {
+    if (version == RAD_V1) {
+        const uint8_t mod[OP_SIZE] = { p[INS_MOD_20], p[INS_MOD_40], p[INS_MOD_60], p[INS_MOD_80], p[INS_MOD_E0] };
+        const uint8_t car[OP_SIZE] = { p[INS_CAR_20], p[INS_CAR_40], p[INS_CAR_60], p[INS_CAR_80], p[INS_CAR_E0] };
+        memcpy(out->mod, mod, OP_SIZE);
+        memcpy(out->car, car, OP_SIZE);
+        out->c0 = p[INS_C0] & 0x0F;
+        out->volume = 64;
+    } else {
+        uint8_t algorithm = p[0] & 0x07;
+        if (algorithm == RAD_ALG_MIDI) return false;
+        memcpy(out->car, p + 4, OP_SIZE);
+        memcpy(out->mod, p + 4 + OP_SIZE, OP_SIZE);
+        out->c0 = ((p[1] & 0x07) << 1) | (algorithm == 1 ? 1 : 0);
+        out->volume = p[3] > 64 ? 64 : p[3];
+    }
+    out->mod[OP_E0] &= 0x03;  // OPL2 has waveforms 0-3
+    out->car[OP_E0] &= 0x03;
+    return true;
+}
+
+static void set_instrument(uint8_t ch, const uint8_t *data) {
+    TrackerChannel *c = &channels[ch];
+    if (!decode_instrument(data, &c->instrument)) return;
+    c->has_instrument = true;
+    c->volume = 64;
+
+    const TrackerInstrument *inst = &c->instrument;
+    uint8_t op = op_offsets[ch];
+    regs[0x20 + op] = inst->mod[OP_20];
+    regs[0x23 + op] = inst->car[OP_20];
+    regs[0x60 + op] = inst->mod[OP_60];
+    regs[0x63 + op] = inst->car[OP_60];
+    regs[0x80 + op] = inst->mod[OP_80];
+    regs[0x83 + op] = inst->car[OP_80];
+    regs[0xE0 + op] = inst->mod[OP_E0];
+    regs[0xE3 + op] = inst->car[OP_E0];
+    regs[0xC0 + ch] = inst->c0;
+    set_volume(ch);
+}
+
+// Send the registers that differ from the shadow, channel by channel so
+// each instrument is in place before its key goes on
+static void send_reg(uint8_t reg, bool full) {
+    if (!full && regs[reg] == sent[reg]) return;
+    SongEvent e = { .type = 9, .delay_ms = 0, .note = reg, .velocity = regs[reg] };
+    if (!audio_engine_add_event(&e)) {
+        dropped = true;
+        return;
+    }
+    sent[reg] = regs[reg];
+}
+
+// The line's pitch effect, sent to Core 1 when it changes
+static void send_pitch_effect(uint8_t ch, bool full) {
+    TrackerChannel *c = &channels[ch];
+    uint8_t fx = CHANNEL_FX_NONE;
+    uint8_t param = 0;
+    if (c->effect == 0x0 && c->param != 0) {
+        fx = CHANNEL_FX_ARPEGGIO;
+        param = c->param;
+    } else if (c->effect == 0x4) {
+        fx = CHANNEL_FX_VIBRATO;
+        param = c->vibrato;
+    }
+
+    if (!full && fx == c->pitch_fx && param == c->pitch_param) return;
+    SongEvent e = { .type = 14, .delay_ms = 0, .channel = ch, .note = fx, .velocity = param };
+    if (!audio_engine_add_event(&e)) {
+        dropped = true;
+        return;
+    }
+    c->pitch_fx = fx;
+    c->pitch_param = param;
+}
+
+static void flush_registers(void) {
+    static const uint8_t op_regs[5] = {0x20, 0x40, 0x60, 0x80, 0xE0};
+
+    for (uint8_t ch = 0; ch < 9; ch++) {
+        bool full = resync & (1 << ch);
+        dropped = false;
+
+        uint8_t op = op_offsets[ch];
+        for (int i = 0; i < 5; i++) {
+            send_reg(op_regs[i] + op, full);
+            send_reg(op_regs[i] + op + 3, full);
+        }
+        send_reg(0xC0 + ch, full);
+
+        // A retriggered note needs a key-off the diff alone wouldn't see
+        if (channels[ch].retrigger && (sent[0xB0 + ch] & 0x20)) {
+            SongEvent off = { .type = 9, .delay_ms = 0, .note = 0xB0 + ch, .velocity = sent[0xB0 + ch] & ~0x20 };
+            if (audio_engine_add_event(&off)) {
+                sent[0xB0 + ch] = off.velocity;
+            } else {
+                dropped = true;
+            }
+        }
+        channels[ch].retrigger = false;
+
+        // Vibrato and arpeggio run on Core 1's control tick, on top of the
+        // pitch below (see modulation.h)
+        send_pitch_effect(ch, full);
+
+        send_reg(0xA0 + ch, full);
+        send_reg(0xB0 + ch, full);
+
+        // The queue had no room for part of it: send the whole channel again
+        // on the next tick (the shadow only holds what went out)
+        if (dropped) {
+            resync |= 1 << ch;
+        } else {
+            resync &= ~(1 << ch);
+        }
+    }
+}
+
+// --- EFFECTS ---
+
+// Slide the pitch, carrying into the next octave at either end of the range
+// (a tone slide stops at its target)
+static void portamento(uint8_t ch, int16_t amount, bool tone_slide) {
+    TrackerChannel *c = &channels[ch];
+    int16_t fnum = (int16_t)c->fnum + amount;
+    uint8_t block = c->block;
+
+    if (fnum < FNUM_LOW) {
+        if (block > 0) {
+            block--;
+            fnum += FNUM_HIGH - FNUM_LOW;
+        } else {
+            fnum = FNUM_LOW;
+        }
+    } else if (fnum > FNUM_HIGH) {
+        if (block < 7) {
+            block++;
+            fnum -= FNUM_HIGH - FNUM_LOW;
+        } else {
+            fnum = FNUM_HIGH;
+        }
+    }
+
+    if (tone_slide) {
+        uint32_t now = ((uint32_t)block << 10) | (uint16_t)fnum;
+        uint32_t target = ((uint32_t)c->slide_block << 10) | c->slide_fnum;
+        if ((amount > 0 && now >= target) || (amount < 0 && now <= target)) {
+            fnum = c->slide_fnum;
+            block = c->slide_block;
+        }
+    }
+
+    c->fnum = (uint16_t)fnum;
+    c->block = block;
+    set_pitch(ch);
+}
+
+static void tone_slide(uint8_t ch) {
+    TrackerChannel *c = &channels[ch];
+    if (c->fnum == c->slide_fnum && c->block == c->slide_block) return;
+
+    uint32_t now = ((uint32_t)c->block << 10) | c->fnum;
+    uint32_t target = ((uint32_t)c->slide_block << 10) | c->slide_fnum;
+    portamento(ch, now < target ? c->slide_speed : -(int16_t)c->slide_speed, true);
+}
+
+// 1-49 slides down, 51-99 slides up (by the parameter less 50)
+static void volume_slide(uint8_t ch, uint8_t param) {
+    TrackerChannel *c = &channels[ch];
+    int16_t volume = c->volume;
+    volume += param > 50 ? param - 50 : -(int16_t)param;
+    if (volume < 0) volume = 0;
+    if (volume > 64) volume = 64;
+    c->volume = (uint8_t)volume;
+    set_volume(ch);
+}
+
+// Effects that run on the ticks after a line
+static void update_effects(void) {
+    for (uint8_t ch = 0; ch < 9; ch++) {
+        TrackerChannel *c = &channels[ch];
+        switch (c->effect) {
+            case 0x1: portamento(ch, c->param, false); break;              // Portamento up
+            case 0x2: portamento(ch, -(int16_t)c->param, false); break;    // Portamento down
+            case 0x3: tone_slide(ch); break;                               // Tone slide
+            case 0x5: tone_slide(ch); volume_slide(ch, c->param); break;   // Tone slide + volume slide
+            case 0xA: volume_slide(ch, c->param); break;                   // Volume slide
+        }
+    }
+}
+
+// --- LINES ---
+
+static void play_entry(uint8_t ch, const TrackerEntry *e) {
+    TrackerChannel *c = &channels[ch];
+    uint8_t note = e->note & 0x0F;
+    uint8_t octave = (e->note >> 4) & 0x07;
+    uint8_t effect = e->effect;
+    uint8_t param = e->param;
+
+    uint8_t inst = e->inst;
+    if (inst == RAD_INST_LAST) inst = c->last_instrument;
+    else if (inst > 0) c->last_instrument = inst;
+    if (inst > 0 && inst <= RAD_INSTRUMENTS && instruments[inst - 1] != NULL) {
+        set_instrument(ch, instruments[inst - 1]);
+    }
+
+    c->effect = effect;
+    c->param = param;
+
+    if ((effect == 0x3 || effect == 0x5) && note >= 1 && note <= 12) {
+        // The note is where the tone slide goes, not a new note
+        c->slide_fnum = note_fnum[note - 1];
+        c->slide_block = octave;
+    } else if (note == RAD_NOTE_OFF) {
+        c->key_on = false;
+        set_pitch(ch);
+    } else if (note >= 1 && note <= 12) {
+        c->fnum = note_fnum[note - 1];
+        c->block = octave;
+        c->retrigger = c->key_on;
+        c->key_on = true;
+        set_pitch(ch);
+    }
+
+    switch (effect) {
+        case 0x3: if (param) c->slide_speed = param; break;                     // Tone slide speed
+        case 0x4: if (param) c->vibrato = param; break;                         // Vibrato (Core 1)
+        case 0xC: c->volume = param > 64 ? 64 : param; set_volume(ch); break;  // Set volume
+        case 0xD: break_line = param < RAD_LINES ? param : 0; break;           // Pattern break
+        case 0xF: if (param) speed = param; break;                              // Set speed
+    }
+}
+
+static void play_line(void) {
+    for (uint8_t ch = 0; ch < 9; ch++) {
+        channels[ch].effect = 0;
+        channels[ch].param = 0;
+    }
+
+    if (line_ptr != NULL && (*line_ptr & 0x7F) == line) {
+        const uint8_t *p = line_ptr;
+        bool last_line = *p++ & 0x80;
+        bool last;
+        TrackerEntry e;
+        do {
+            p = read_entry(p, &e, &last);
+            if (e.channel < 9) play_entry(e.channel, &e);
+        } while (!last);
+        line_ptr = last_line ? NULL : p;
+    }
+
+    // Move on to the next line, or the next order at the end of the pattern
+    if (break_line >= 0) {
+        enter_order(order_pos + 1, (uint8_t)break_line);
+        break_line = -1;
+    } else if (++line >= RAD_LINES) {
+        enter_order(order_pos + 1, 0);
+    }
+}
+
+// --- TIMER ---
+
+static bool tracker_tick(repeating_timer_t *rt) {
+    if (tick_count == 0) {
+        play_line();
+    } else {
+        update_effects();
+    }
+    if (++tick_count >= speed) tick_count = 0;
+
+    flush_registers();
+
+    rt->delay_us = -(int64_t)period_us;
+    if (finished) {
+        running = false;
+        return false;
+    }
+    return true;
+}
+
+static void update_period(void) {
+    period_us = (uint32_t)((uint64_t)tick_us * 100 / tempo_percent);
+}
+
+// --- PUBLIC ---
+
+void tracker_init(void) {
+    module_count = 0;
+    for (uint8_t slot = 0; slot < TRACKER_FLASH_SLOTS; slot++) {
+        const uint8_t *data = slot_address(slot);
+        if (parse_module(data)) {
+            module_slots[module_count++] = slot;
+            printf("Tracker: RAD v%u module in slot %u\n", version >> 4, slot);
+        } else if (memcmp(data, "RAD by REALiTY!!", 16) == 0) {
+            printf("Tracker: slot %u: RAD version %X.%X not supported\n", slot, data[16] >> 4, data[16] & 0x0F);
+        }
+    }
+    module = NULL;
+}
+
+uint8_t tracker_get_count(void) {
+    return module_count;
+}
+
+void tracker_get_name(uint8_t index, char *out, uint8_t size) {
+    snprintf(out, size, "RAD %u", index < module_count ? module_slots[index] + 1 : 0);
+}
+
+bool tracker_open(uint8_t index) {
+    tracker_pause();
+    if (index >= module_count || !parse_module(slot_address(module_slots[index]))) {
+        module = NULL;
+        return false;
+    }
+
+    memset(channels, 0, sizeof(channels));
+    memset(regs, 0, sizeof(regs));
+    tick_count = 0;
+    break_line = -1;
+    finished = false;
+    resync = RESYNC_ALL;
+    enter_order(0, 0);
+    update_period();
+    return true;
+}
+
+void tracker_resume(void) {
+    if (running || module == NULL || finished) return;
+
+    // The chip may have been reset (or the queue flushed) since the last tick
+    resync = RESYNC_ALL;
+    update_period();
+    running = add_repeating_timer_us(-(int64_t)period_us, tracker_tick, NULL, &timer);
+}
+
+void tracker_pause(void) {
+    if (!running) return;
+    cancel_repeating_timer(&timer);
+    running = false;
+}
+
+bool tracker_is_running(void) {
+    return running;
+}
+
+bool tracker_is_finished(void) {
+    return finished;
+}
+
+void tracker_set_tempo_scale(uint16_t percent) {
+    tempo_percent = percent ? percent : 100;
+    update_period();  // The timer picks it up on its next tick
+}
@@ -0,0 +1,93 @@
+/**
+ * tracker_player.h
+ *
+ * AdLib Tracker Module Player
+ * Plays Reality AdLib Tracker (RAD v1 and v2) modules straight from flash
+ *
+ * FLASH LAYOUT
+ * ------------
+ * TRACKER_FLASH_SLOTS slots of TRACKER_SLOT_SIZE bytes follow the MUS
+ * slots (see mus_player.h). Each slot holds one unmodified .RAD file, e.g.
+ *   picotool load -t bin tune.rad -o 0x101C0000    (slot 0)
+ *   picotool load -t bin demo.rad -o 0x101C8000    (slot 1)
+ *
+ * PLAYBACK
+ * --------
+ * A repeating timer on Core 0 runs the tracker at the module's rate
+ * (50 Hz, 18.2 Hz for slow-timer modules, or a v2 module's BPM): each tick
+ * reads a line on the first tick of the line and steps the running effects
+ * (portamento, tone slide, volume slide) on the rest. The tracker builds
+ * the register image it wants and compares it with a shadow of what was
+ * last sent; only registers that differ go to Core 1, as Register Write
+ * events (type 9). Tracker notes bypass the voice manager entirely.
+ *
+ * Vibrato and arpeggio need more than one step per tracker tick, so the
+ * tracker only tells Core 1 which one a channel runs (Tracker Effect
+ * event, type 14) and the control tick moves the pitch (see modulation.h).
+ */
+
+#ifndef TRACKER_PLAYER_H
+#define TRACKER_PLAYER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mus_player.h"
+
+#define TRACKER_FLASH_OFFSET (MUS_FLASH_OFFSET + MUS_FLASH_SLOTS * MUS_SLOT_SIZE)
+#define TRACKER_SLOT_SIZE    (32 * 1024)
+#define TRACKER_FLASH_SLOTS  8
+
+/**
+ * Scan the flash slots for tracker modules
+ * Call once at boot
+ */
+void tracker_init(void);
+
+/**
+ * Number of modules found in flash
+ */
+uint8_t tracker_get_count(void);
+
+/**
+ * Short name of a module for display ("RAD 1" ...)
+ */
+void tracker_get_name(uint8_t index, char *out, uint8_t size);
+
+/**
+ * Load a module and rewind it to the first order (stops the timer)
+ *
+ * @param index Module number (0 to tracker_get_count() - 1)
+ * @return false if there is no such module
+ */
+bool tracker_open(uint8_t index);
+
+/**
+ * Start (or continue) the tick timer
+ * Every register is sent again on the first tick, as a pause silences the chip
+ */
+void tracker_resume(void);
+
+/**
+ * Stop the tick timer; the module keeps its position
+ */
+void tracker_pause(void);
+
+/**
+ * Check whether the tick timer is running
+ */
+bool tracker_is_running(void);
+
+/**
+ * Check whether the module has played its last order
+ * (modules that jump back in their order list never finish)
+ */
+bool tracker_is_finished(void);
+
+/**
+ * Scale the tick rate
+ *
+ * @param percent Tempo in percent of the module's own rate
+ */
+void tracker_set_tempo_scale(uint16_t percent);
+
+#endif // TRACKER_PLAYER_H
@@ -0,0 +1,44 @@
+/**
+ * tusb_config.h
+ * 
+ * TinyUSB Configuration
+ * Composite device: CDC (serial console) + MIDI
+ */
+
+#ifndef TUSB_CONFIG_H
+#define TUSB_CONFIG_H
+
+// --- Common ---
+#ifndef CFG_TUSB_MCU
+#define CFG_TUSB_MCU OPT_MCU_RP2040
+#endif
+
+#define CFG_TUSB_RHPORT0_MODE   (OPT_MODE_DEVICE)
+#define CFG_TUSB_OS             OPT_OS_PICO
+
+#ifndef CFG_TUSB_MEM_SECTION
+#define CFG_TUSB_MEM_SECTION
+#endif
+
+#ifndef CFG_TUSB_MEM_ALIGN
+#define CFG_TUSB_MEM_ALIGN      __attribute__ ((aligned(4)))
+#endif
+
+// --- Device ---
+#define CFG_TUD_ENDPOINT0_SIZE  64
+
+#define CFG_TUD_CDC             1   // The console, printf included (console.h)
+#define CFG_TUD_MSC             0
+#define CFG_TUD_HID             0
+#define CFG_TUD_MIDI            1
+#define CFG_TUD_VENDOR          0
+
+// CDC FIFO sizes
+#define CFG_TUD_CDC_RX_BUFSIZE  64
+#define CFG_TUD_CDC_TX_BUFSIZE  64
+
+// MIDI FIFO sizes - room for a burst of dense sequencer output
+#define CFG_TUD_MIDI_RX_BUFSIZE 256
+#define CFG_TUD_MIDI_TX_BUFSIZE 64
+
+#endif // TUSB_CONFIG_H
@@ -0,0 +1,120 @@
+/**
+ * usb_descriptors.c
+ * 
+ * USB Descriptors for the composite CDC + MIDI device
+ * Supplied by the application because TinyUSB is linked directly
+ * (the CDC interface carries the console, see console.h)
+ */
+
+#include "tusb.h"
+#include "pico/unique_id.h"
+
+#define USB_VID   0x2E8A  // Raspberry Pi
+#define USB_PID   0x10C8  // PicoOPL2 CDC + MIDI
+#define USB_BCD   0x0200
+
+// --- Device Descriptor ---
+
+static const tusb_desc_device_t desc_device = {
+    .bLength            = sizeof(tusb_desc_device_t),
+    .bDescriptorType    = TUSB_DESC_DEVICE,
+    .bcdUSB             = USB_BCD,
+
+    // IAD is required for a composite device with CDC
+    .bDeviceClass       = TUSB_CLASS_MISC,
+    .bDeviceSubClass    = MISC_SUBCLASS_COMMON,
+    .bDeviceProtocol    = MISC_PROTOCOL_IAD,
+    .bMaxPacketSize0    = CFG_TUD_ENDPOINT0_SIZE,
+
+    .idVendor           = USB_VID,
+    .idProduct          = USB_PID,
+    .bcdDevice          = 0x0100,
+
+    .iManufacturer      = 0x01,
+    .iProduct           = 0x02,
+    .iSerialNumber      = 0x03,
+
+    .bNumConfigurations = 0x01
+};
+
+const uint8_t *tud_descriptor_device_cb(void) {
+    return (const uint8_t *)&desc_device;
+}
+
+// --- Configuration Descriptor ---
+
+enum {
+    ITF_NUM_CDC = 0,
+    ITF_NUM_CDC_DATA,
+    ITF_NUM_MIDI,
+    ITF_NUM_MIDI_STREAMING,
+    ITF_NUM_TOTAL
+};
+
+#define EPNUM_CDC_NOTIF  0x81
+#define EPNUM_CDC_OUT    0x02
+#define EPNUM_CDC_IN     0x82
+#define EPNUM_MIDI_OUT   0x03
+#define EPNUM_MIDI_IN    0x83
+
+#define CONFIG_TOTAL_LEN (TUD_CONFIG_DESC_LEN + TUD_CDC_DESC_LEN + TUD_MIDI_DESC_LEN)
+
+static const uint8_t desc_configuration[] = {
+    // Config number, interface count, string index, total length, attribute, power in mA
+    TUD_CONFIG_DESCRIPTOR(1, ITF_NUM_TOTAL, 0, CONFIG_TOTAL_LEN, 0x00, 100),
+
+    // Interface number, string index, EP notification address and size, EP data address (out, in) and size
+    TUD_CDC_DESCRIPTOR(ITF_NUM_CDC, 4, EPNUM_CDC_NOTIF, 8, EPNUM_CDC_OUT, EPNUM_CDC_IN, 64),
+
+    // Interface number, string index, EP Out & EP In address, EP size
+    TUD_MIDI_DESCRIPTOR(ITF_NUM_MIDI, 5, EPNUM_MIDI_OUT, EPNUM_MIDI_IN, 64),
+};
+
+const uint8_t *tud_descriptor_configuration_cb(uint8_t index) {
+    (void)index;
+    return desc_configuration;
+}
+
+// --- String Descriptors ---
+
+static const char *const string_desc[] = {
+    NULL,               // 0: Language (handled below)
+    "PicoOPL2",         // 1: Manufacturer
+    "PicoOPL2 Synth",   // 2: Product
+    NULL,               // 3: Serial (board unique ID)
+    "PicoOPL2 Console", // 4: CDC interface
+    "PicoOPL2 MIDI",    // 5: MIDI interface
+};
+
+static uint16_t desc_str[32];
+
+const uint16_t *tud_descriptor_string_cb(uint8_t index, uint16_t langid) {
+    (void)langid;
+    char serial[2 * PICO_UNIQUE_BOARD_ID_SIZE_BYTES + 1];
+    const char *str;
+    uint8_t chr_count;
+
+    if (index == 0) {
+        desc_str[1] = 0x0409;  // English
+        chr_count = 1;
+    } else {
+        if (index >= sizeof(string_desc) / sizeof(string_desc[0])) return NULL;
+
+        if (index == 3) {
+            pico_get_unique_board_id_string(serial, sizeof(serial));
+            str = serial;
+        } else {
+            str = string_desc[index];
+        }
+
+        chr_count = 0;
+        while (str[chr_count] && chr_count < 31) {
+            desc_str[1 + chr_count] = str[chr_count];
+            chr_count++;
+        }
+    }
+
+    // First element: length (bytes, including header) and descriptor type
+    desc_str[0] = (uint16_t)((TUSB_DESC_STRING << 8) | (2 * chr_count + 2));
+    return desc_str;
+}
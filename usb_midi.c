@@ -0,0 +1,40 @@
+/**
+ * usb_midi.c
+ * 
+ * USB-MIDI Device Implementation
+ * Hands USB-MIDI event packets to the MIDI input handler
+ */
+
+#include "usb_midi.h"
+#include "midi_input.h"
+#include "tusb.h"
+#include <stdio.h>
+
+void usb_midi_init(void) {
+    tusb_init();
+}
+
+void usb_midi_task(void) {
+    tud_task();
+
+    // Packets arrive already framed (4 bytes each), so no UART-style
+    // byte assembly is needed before the parser
+    uint8_t packet[4];
+    while (tud_midi_available() && tud_midi_packet_read(packet)) {
+        midi_input_usb_packet(packet);
+    }
+}
+
+bool usb_midi_mounted(void) {
+    return tud_mounted();
+}
+
+// --- TinyUSB device callbacks ---
+
+void tud_mount_cb(void) {
+    printf("USB: Host connected\n");
+}
+
+void tud_umount_cb(void) {
+    printf("USB: Host disconnected\n");
+}
@@ -0,0 +1,37 @@
+/**
+ * usb_midi.h
+ * 
+ * USB-MIDI Device
+ * Composite USB device (CDC serial console + MIDI) using TinyUSB
+ *
+ * The CDC interface keeps printf over USB working; the MIDI interface
+ * feeds the same event path as the DIN port. USB-MIDI runs at full USB
+ * speed instead of the DIN port's ~1000 messages per second.
+ */
+
+#ifndef USB_MIDI_H
+#define USB_MIDI_H
+
+#include <stdbool.h>
+
+/**
+ * Initialize the USB device stack
+ * Call once at boot, before anything prints (printf goes out on its CDC
+ * interface, see console.h)
+ */
+void usb_midi_init(void);
+
+/**
+ * Service the USB device stack and drain received MIDI packets
+ * Call regularly from the main loop (also keeps the CDC console alive)
+ */
+void usb_midi_task(void);
+
+/**
+ * Check whether a USB host has configured the device
+ * 
+ * @return true if mounted
+ */
+bool usb_midi_mounted(void);
+
+#endif // USB_MIDI_H
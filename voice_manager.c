@@ -7,104 +7,356 @@
 #include "voice_manager.h"
 #include "opl2.h"
 #include "instruments.h"
+#include "midi_state.h"
+#include "perf.h"
 
 // --- VOICE STATE ---
-OPLVoice voices[9];       // The 9 Physical OPL Channels
+OPLVoice voices[OPL2_VOICES];  // The Physical OPL Channels of every chip
+VoiceModulation voice_mod; // Their control-rate modulation
 uint32_t note_counter = 0; // Global clock for age tracking
 
 // --- IMPLEMENTATION ---
 
 void init_voices(void) {
-    for(int i=0; i<9; i++) {
+    for(int i=0; i<OPL2_VOICES; i++) {
         voices[i].active = false;
         voices[i].midi_channel = 255;
         voices[i].midi_note = 0;
+        voices[i].velocity = 0;
         voices[i].age = 0;
+        voices[i].sustained = false;
+        voices[i].sostenuto = false;
+        voices[i].partner = -1;
+        voices[i].layer = false;
+        voices[i].preloaded = false;
+        voice_mod.gain[i] = 127;
+        voice_mod.tremolo[i] = 0;
+        voice_mod.env_phase[i] = 0;
+        voice_mod.env_att_q8[i] = 0;
     }
+    voice_mod.master = 127;
 }
 
-int allocate_voice(uint8_t m_ch, uint8_t m_note) {
-    // 1. Check for Retrigger (Same note, same channel)
-    for(int i=0; i<9; i++) {
-        if (voices[i].active && voices[i].midi_channel == m_ch && voices[i].midi_note == m_note) {
-            voices[i].age = ++note_counter;
-            return i;
-        }
+// Take a voice for a note (the caller keys it on)
+static void claim_voice(int i, uint8_t m_ch, uint8_t m_note) {
+    voices[i].active = true;
+    voices[i].midi_channel = m_ch;
+    voices[i].midi_note = m_note;
+    voices[i].age = ++note_counter;
+    voices[i].sustained = false;
+    voices[i].sostenuto = false;
+    voices[i].partner = -1;
+    voices[i].layer = false;
+}
+
+// Key off one voice and forget its note
+static void stop_voice(int i) {
+    opl2_note_off(i);
+    voices[i].active = false;
+    voices[i].sustained = false;
+    voices[i].sostenuto = false;
+    voices[i].partner = -1;
+    voices[i].layer = false;
+}
+
+// Drop the layer voice of a double-voice note, keeping the note itself
+static void drop_layer(int i) {
+    int primary = voices[i].partner;
+    if (primary >= 0) voices[primary].partner = -1;
+    stop_voice(i);
+}
+
+// Idle voice for a patch: one already holding it saves the patch writes,
+// else the one idle longest, leaving fresh prefetches and release tails be.
+// Between chips, the one with fewer notes keyed goes first
+static int find_free_voice(uint16_t program, uint8_t layer) {
+    uint8_t keyed[OPL2_CHIPS] = {0};
+    for(int i=0; i<OPL2_VOICES; i++) {
+        if (voices[i].active) keyed[opl2_chip(i)]++;
     }
 
-    // 2. DRUM HANDLING (MIDI Ch 9 -> Physical Voice 8)
-    if (m_ch == 9) {
-        voices[8].active = true;
-        voices[8].midi_channel = 9;
-        voices[8].midi_note = m_note;
-        return 8;
-    }
-
-    // 3. MELODIC HANDLING (Find free voice 0-7)
-    for(int i=0; i<8; i++) {
-        if (!voices[i].active) {
-            voices[i].active = true;
-            voices[i].midi_channel = m_ch;
-            voices[i].midi_note = m_note;
-            voices[i].age = ++note_counter;
-            return i;
+    int idx = -1;
+    int match = -1;
+    uint64_t min_rank = UINT64_MAX;
+    for(int i=0; i<MELODIC_VOICES; i++) {
+        if (voices[i].active) continue;
+        if (program != PATCH_NONE && get_channel_program(i) == program &&
+            get_channel_layer(i) == layer) {
+            if (match == -1 || keyed[opl2_chip(i)] < keyed[opl2_chip(match)]) match = i;
+            continue;
+        }
+        // Preloaded voices are kept for their own notes while others are idle
+        uint64_t rank = ((uint64_t)voices[i].preloaded << 40) |
+                        ((uint64_t)keyed[opl2_chip(i)] << 32) | voices[i].age;
+        if (idx == -1 || rank < min_rank) {
+            min_rank = rank;
+            idx = i;
         }
     }
+    return match >= 0 ? match : idx;
+}
 
-    // 4. STEAL OLDEST (Voices 0-7 only)
-    int oldest_idx = 0;
+// Oldest layer voice whose channel lets it go
+static int find_droppable_layer(void) {
+    int idx = -1;
     uint32_t min_age = 0xFFFFFFFF;
-    for(int i=0; i<8; i++) {
+    for(int i=0; i<MELODIC_VOICES; i++) {
+        if (!voices[i].active || !voices[i].layer) continue;
+        if (midi_get_layer_policy(voices[i].midi_channel) != LAYER_DROP) continue;
         if (voices[i].age < min_age) {
+            min_age = voices[i].age;
+            idx = i;
+        }
+    }
+    return idx;
+}
+
+// Oldest note to steal (its primary voice)
+// Voices only ringing on a pedal go first - their keys are already up,
+// so cutting one is far less audible than cutting a held note.
+static int find_steal_victim(int exclude) {
+    int oldest_idx = -1;
+    uint32_t min_age = 0xFFFFFFFF;
+    for(int i=0; i<MELODIC_VOICES; i++) {
+        if (i == exclude || voices[i].layer) continue;
+        if (voices[i].sustained && voices[i].age < min_age) {
             min_age = voices[i].age;
             oldest_idx = i;
         }
     }
-    
-    voices[oldest_idx].midi_channel = m_ch;
-    voices[oldest_idx].midi_note = m_note;
-    voices[oldest_idx].age = ++note_counter;
+    if (oldest_idx == -1) {
+        for(int i=0; i<MELODIC_VOICES; i++) {
+            if (i == exclude || voices[i].layer) continue;
+            if (voices[i].age < min_age) {
+                min_age = voices[i].age;
+                oldest_idx = i;
+            }
+        }
+    }
     return oldest_idx;
 }
 
+// Get a melodic voice: free, else a spare layer voice, else steal a note.
+// A stolen note goes with its layer voice, which becomes free.
+static int take_voice(int exclude, uint16_t program, uint8_t layer) {
+    int i = find_free_voice(program, layer);
+    if (i >= 0) return i;
+
+    i = find_droppable_layer();
+    if (i >= 0) {
+        drop_layer(i);
+        return i;
+    }
+
+    i = find_steal_victim(exclude);
+    if (i < 0) return -1;
+    if (voices[i].partner >= 0) stop_voice(voices[i].partner);
+    voices[i].partner = -1;
+    return i;
+}
+
+int allocate_voice(uint8_t m_ch, uint8_t m_note) {
+    int second;
+    return allocate_voices(m_ch, m_note, PATCH_NONE, false, &second);
+}
+
+static int pick_voices(uint8_t m_ch, uint8_t m_note, uint16_t program, bool want_pair, int *second) {
+    *second = -1;
+
+    // 1. Check for Retrigger (Same note, same channel)
+    for(int i=0; i<OPL2_VOICES; i++) {
+        if (voices[i].active && !voices[i].layer &&
+            voices[i].midi_channel == m_ch && voices[i].midi_note == m_note) {
+            int partner = voices[i].partner;
+            claim_voice(i, m_ch, m_note);
+            if (partner >= 0) {
+                if (want_pair) {
+                    claim_voice(partner, m_ch, m_note);
+                    voices[partner].layer = true;
+                    voices[partner].partner = i;
+                    voices[i].partner = partner;
+                    *second = partner;
+                } else {
+                    stop_voice(partner);
+                }
+            }
+            return i;
+        }
+    }
+
+    // 2. DRUM HANDLING (MIDI Ch 9 -> the drum voice)
+    if (m_ch == 9) {
+        voices[DRUM_VOICE].active = true;
+        voices[DRUM_VOICE].midi_channel = 9;
+        voices[DRUM_VOICE].midi_note = m_note;
+        voices[DRUM_VOICE].sustained = false;
+        voices[DRUM_VOICE].sostenuto = false;
+        return DRUM_VOICE;
+    }
+
+    // 3. MELODIC HANDLING (the other voices)
+    int primary = take_voice(-1, program, 0);
+    claim_voice(primary, m_ch, m_note);
+
+    // 4. LAYER VOICE - pairs are claimed together, so a note never sounds
+    // half-loaded. Under LAYER_DROP it only uses a voice nobody needs.
+    if (want_pair) {
+        int layer = find_free_voice(program, 1);
+        if (layer < 0 && midi_get_layer_policy(m_ch) == LAYER_KEEP) {
+            layer = take_voice(primary, program, 1);
+        }
+        if (layer >= 0) {
+            claim_voice(layer, m_ch, m_note);
+            voices[layer].layer = true;
+            voices[layer].partner = primary;
+            voices[primary].partner = layer;
+            *second = layer;
+        }
+    }
+    return primary;
+}
+
+int allocate_voices(uint8_t m_ch, uint8_t m_note, uint16_t program, bool want_pair, int *second) {
+    PERF_BEGIN(ALLOCATE_VOICE);
+    int voice = pick_voices(m_ch, m_note, program, want_pair, second);
+    PERF_END(ALLOCATE_VOICE);
+    return voice;
+}
+
+int assign_voice(int voice, uint8_t m_ch, uint8_t m_note) {
+    if (voice < 0 || voice >= MELODIC_VOICES) return allocate_voice(m_ch, m_note);
+
+    // The plan may steal this voice: a layer voice leaves its note single,
+    // a primary takes its layer voice with it
+    if (voices[voice].active) {
+        if (voices[voice].layer) {
+            drop_layer(voice);
+        } else if (voices[voice].partner >= 0) {
+            stop_voice(voices[voice].partner);
+        }
+    }
+    claim_voice(voice, m_ch, m_note);
+    return voice;
+}
+
+// Balanced between chips like find_free_voice(): the chip with fewer
+// notes keyed or coming (preloads) goes first, then the longest idle voice
+int prefetch_voice(uint16_t program, uint8_t layer) {
+    uint8_t busy[OPL2_CHIPS] = {0};
+    for(int i=0; i<OPL2_VOICES; i++) {
+        if (voices[i].active || voices[i].preloaded) busy[opl2_chip(i)]++;
+    }
+
+    int idx = -1;
+    uint64_t min_rank = UINT64_MAX;
+    for(int i=0; i<MELODIC_VOICES; i++) {
+        if (voices[i].active) continue;
+        // Already waiting on an idle voice
+        if (get_channel_program(i) == program && get_channel_layer(i) == layer) return -1;
+        if (voices[i].preloaded) continue;
+        uint64_t rank = ((uint64_t)busy[opl2_chip(i)] << 32) | voices[i].age;
+        if (idx == -1 || rank < min_rank) {
+            min_rank = rank;
+            idx = i;
+        }
+    }
+    if (idx >= 0) {
+        voices[idx].preloaded = true;
+        voices[idx].age = ++note_counter;
+    }
+    return idx;
+}
+
 int find_active_voice(uint8_t m_ch, uint8_t m_note) {
-    if (m_ch == 9) return 8; // Drums always Ch 8
+    // Drums always on the drum voice - but only the drum that's sounding, so the
+    // note-off of a hit that was dropped or replaced doesn't cut the current one
+    if (m_ch == 9) {
+        return (voices[DRUM_VOICE].active && voices[DRUM_VOICE].midi_note == m_note) ? DRUM_VOICE : -1;
+    }
 
-    for(int i=0; i<8; i++) {
-        if (voices[i].active && voices[i].midi_channel == m_ch && voices[i].midi_note == m_note) {
+    for(int i=0; i<MELODIC_VOICES; i++) {
+        if (voices[i].active && !voices[i].layer &&
+            voices[i].midi_channel == m_ch && voices[i].midi_note == m_note) {
             return i;
         }
     }
     return -1; // Not found (maybe already stolen/stopped)
 }
 
-void apply_velocity(uint8_t channel, uint8_t velocity) {
-    if (channel > 8) return;
-    
+void release_voice(int voice) {
+    if (voice < 0 || voice >= OPL2_VOICES) return;
+    int partner = voices[voice].partner;
+
+    // Drums ignore the pedals (GM percussion is one-shot anyway)
+    uint8_t m_ch = voices[voice].midi_channel;
+    if (m_ch != 9) {
+        bool held = midi_get_sustain(m_ch) ||
+                    (voices[voice].sostenuto && midi_get_sostenuto(m_ch));
+        if (held) {
+            // Defer - the pedal-up will key both voices of the note off
+            voices[voice].sustained = true;
+            if (partner >= 0) voices[partner].sustained = true;
+            return;
+        }
+    }
+
+    stop_voice(voice);
+    if (partner >= 0) stop_voice(partner);
+}
+
+void release_sustained_voices(uint8_t m_ch) {
+    bool sustain_down = midi_get_sustain(m_ch);
+    bool sostenuto_down = midi_get_sostenuto(m_ch);
+
+    // Layer voices carry the same flags as their note, so both go together
+    for(int i=0; i<MELODIC_VOICES; i++) {
+        if (!voices[i].active || !voices[i].sustained || voices[i].midi_channel != m_ch) continue;
+        if (sustain_down || (voices[i].sostenuto && sostenuto_down)) continue;
+
+        stop_voice(i);
+    }
+}
+
+void latch_sostenuto_voices(uint8_t m_ch) {
+    for(int i=0; i<MELODIC_VOICES; i++) {
+        if (voices[i].active && !voices[i].sustained && voices[i].midi_channel == m_ch) {
+            voices[i].sostenuto = true;
+        }
+    }
+}
+
+uint8_t voice_level(uint8_t channel) {
     // Get the original patch carrier KSL/TL
     uint8_t base_ksl = shadow_carrier_ksl[channel];
     uint8_t base_tl  = base_ksl & 0x3F;      // Original TL from patch
     uint8_t ksl_bits = base_ksl & 0xC0;      // KSL bits
+
+    // Channel volume, expression and the master level scale the velocity
+    uint32_t scale = (uint32_t)voice_mod.gain[channel] * voice_mod.master;
+    uint8_t velocity = (uint8_t)((voices[channel].velocity * scale + 127 * 127 / 2) / (127 * 127));
     
     // Convert MIDI velocity (0-127) to OPL attenuation (0-63)
     // Higher velocity = less attenuation (louder)
     // Lower velocity = more attenuation (quieter)
     uint8_t velocity_attenuation = (127 - velocity) >> 1;
     
-    // Combine: base TL + velocity attenuation
+    // Combine: base TL + velocity attenuation (+ tremolo)
     // This gives us dynamic range based on MIDI velocity
-    uint8_t final_tl = base_tl + velocity_attenuation;
+    uint8_t final_tl = base_tl + velocity_attenuation + voice_mod.tremolo[channel];
     
     // Clamp to valid OPL range
     if (final_tl > 63) final_tl = 63;
+    return ksl_bits | final_tl;
+}
+
+void apply_velocity(uint8_t channel, uint8_t velocity) {
+    if (channel >= OPL2_VOICES) return;
+    PERF_BEGIN(APPLY_VELOCITY);
+    voices[channel].velocity = velocity;
     
     // Write to carrier TL register
-    uint8_t offsets[9] = {0, 1, 2, 8, 9, 10, 16, 17, 18};
-    opl2_write(0x43 + offsets[channel], ksl_bits | final_tl);
+    voice_mod.level[channel] = voice_level(channel);
+    opl2_write_operator(channel, 0x43, voice_mod.level[channel]);
+    PERF_END(APPLY_VELOCITY);
 }
 
-void get_voice_states(bool voice_active[9]) {
-    for (int i = 0; i < 9; i++) {
-        voice_active[i] = voices[i].active;
-    }
-}
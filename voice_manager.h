@@ -2,7 +2,12 @@
  * voice_manager.h
  * 
  * OPL2 Voice Allocation and Management
- * Handles 9-voice polyphonic playback with LRU voice stealing
+ * Handles 9-voice (18 with two chips) polyphonic playback with LRU voice stealing
+ *
+ * The last voice is the drum voice; the rest are melodic. With two chips,
+ * a free voice is taken from the chip with fewer notes keyed, so notes
+ * (and the two voices of a double-voice note) alternate between the chips
+ * and their register writes can interleave (see opl2.h).
  */
 
 #ifndef VOICE_MANAGER_H
@@ -10,18 +15,50 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "opl2.h"
+
+#define DRUM_VOICE      (OPL2_VOICES - 1)   // MIDI channel 10 plays here
+#define MELODIC_VOICES  (OPL2_VOICES - 1)   // Voices 0 to MELODIC_VOICES - 1
 
 // --- VOICE STRUCTURE ---
 typedef struct {
     bool active;
     uint8_t midi_channel; // Which MIDI channel owns this voice?
     uint8_t midi_note;    // Which note is playing?
+    uint8_t velocity;     // Last applied velocity (re-applied on patch refresh)
     uint32_t age;         // For "Note Stealing" (Simple LRU)
+    bool sustained;       // Key released, but held by a pedal (deferred Note Off)
+    bool sostenuto;       // Key was down when the sostenuto pedal was pressed
+    int8_t partner;       // Other voice of a double-voice note, or -1
+    bool layer;           // This is the second voice of a double-voice note
+    bool preloaded;       // Idle, with a patch prefetched for an upcoming note
 } OPLVoice;
 
 // --- EXTERNAL VOICE ARRAY ---
 // External access needed for direct manipulation in audio engine
-extern OPLVoice voices[9];
+extern OPLVoice voices[OPL2_VOICES];
+
+// --- MODULATION STATE ---
+// Control-rate state per voice (see modulation.h), kept as parallel arrays
+// so the tick walks each field across all voices
+typedef struct {
+    uint8_t note[OPL2_VOICES];          // Played note and detune the pitch is built on
+    int16_t fine[OPL2_VOICES];
+    int32_t glide_q8[OPL2_VOICES];      // Portamento: 1/32 semitones (Q8) still to cover, 0 = arrived
+    int32_t glide_step_q8[OPL2_VOICES];
+    int16_t bend[OPL2_VOICES];          // Smoothed pitch bend (1/32 semitone)
+    uint16_t vibrato_phase[OPL2_VOICES];
+    uint16_t tremolo_phase[OPL2_VOICES];
+    uint8_t gain[OPL2_VOICES];          // Smoothed channel volume x expression (0-127)
+    uint8_t tremolo[OPL2_VOICES];       // Current tremolo attenuation (0.75 dB steps)
+    uint16_t freq[OPL2_VOICES];         // B0:A0 last written
+    uint8_t level[OPL2_VOICES];         // Carrier KSL/TL last written
+    uint8_t master;                     // Master level over all voices (0-127, pause/stop fades)
+    uint8_t env_phase[OPL2_VOICES];     // Estimated carrier envelope (VU meters): ENV_* phase
+    uint32_t env_att_q8[OPL2_VOICES];   // and its attenuation in 1/16 dB (Q8)
+} VoiceModulation;
+
+extern VoiceModulation voice_mod;
 
 // --- FUNCTION DECLARATIONS ---
 
@@ -33,36 +70,104 @@ void init_voices(void);
 /**
  * Find a physical OPL voice to play this MIDI note
  * Handles retrigger, drum allocation, and voice stealing
+ * Stealing prefers pedal-held voices whose keys are already released
  * 
  * @param m_ch MIDI channel (0-15)
  * @param m_note MIDI note number (0-127)
- * @return Physical OPL voice index (0-8)
+ * @return Physical OPL voice index (0 to OPL2_VOICES - 1)
  */
 int allocate_voice(uint8_t m_ch, uint8_t m_note);
 
+/**
+ * Find physical voices for a note that may use a double-voice patch
+ * Both voices are claimed together; stealing takes a note with its layer
+ * voice. When voices run out, layer voices on LAYER_DROP channels are given
+ * up before any note is stolen, and a new LAYER_DROP note only gets its
+ * second voice if one is free. Idle voices already holding the program
+ * are taken first, so a prefetched patch needs no register writes.
+ * 
+ * @param m_ch MIDI channel (0-15)
+ * @param m_note MIDI note number (0-127)
+ * @param program Program the note will load (PATCH_NONE if unknown)
+ * @param want_pair true if the patch has a second voice
+ * @param second Set to the layer voice, or -1 if the note plays single
+ * @return Primary physical OPL voice index
+ */
+int allocate_voices(uint8_t m_ch, uint8_t m_note, uint16_t program, bool want_pair, int *second);
+
+/**
+ * Play a note on a voice chosen ahead of time (midi2c.py --prealloc)
+ * Skips the allocation search; whatever the voice was playing is cut,
+ * as the converter's plan intended
+ * 
+ * @param voice Melodic voice (below MELODIC_VOICES); anything else falls back to allocate_voice()
+ * @param m_ch MIDI channel (0-15)
+ * @param m_note MIDI note number (0-127)
+ * @return Physical OPL voice index
+ */
+int assign_voice(int voice, uint8_t m_ch, uint8_t m_note);
+
+/**
+ * Pick an idle melodic voice to preload a patch into ahead of its note
+ * Marks the voice preloaded; the caller writes the patch
+ * 
+ * @param program Program to preload
+ * @param layer Voice of the program (0, or 1 for a double-voice layer)
+ * @return Voice index, or -1 if an idle voice already holds it or none is free
+ */
+int prefetch_voice(uint16_t program, uint8_t layer);
+
 /**
  * Find which physical voice is playing this note
  * 
  * @param m_ch MIDI channel (0-15)
  * @param m_note MIDI note number (0-127)
- * @return Physical OPL voice index (0-8), or -1 if not found
+ * @return Physical OPL voice index, or -1 if not found
  */
 int find_active_voice(uint8_t m_ch, uint8_t m_note);
 
+/**
+ * Handle a MIDI Note Off for a physical voice
+ * Keys the voice (and its layer voice) off, or marks it sustained if a
+ * pedal is holding it
+ * 
+ * @param voice Physical OPL voice index
+ */
+void release_voice(int voice);
+
+/**
+ * Key off every voice on a MIDI channel that is only held by a pedal
+ * Called on pedal-up; the B0 writes go out in one burst from a single event
+ * 
+ * @param m_ch MIDI channel (0-15)
+ */
+void release_sustained_voices(uint8_t m_ch);
+
+/**
+ * Latch the currently held (not yet released) notes of a MIDI channel
+ * Called when the sostenuto pedal goes down
+ * 
+ * @param m_ch MIDI channel (0-15)
+ */
+void latch_sostenuto_voices(uint8_t m_ch);
+
 /**
  * Apply MIDI velocity to a voice by adjusting carrier TL
- * Converts MIDI velocity (0-127) to OPL attenuation (0-63)
+ * Converts MIDI velocity (0-127) to OPL attenuation (0-63), scaled by the
+ * voice's channel gain and tremolo
+ * The velocity is remembered so a patch refresh can re-apply it
  * 
- * @param channel Physical OPL channel (0-8)
+ * @param channel Physical OPL voice
  * @param velocity MIDI velocity (0-127)
  */
 void apply_velocity(uint8_t channel, uint8_t velocity);
 
 /**
- * Get voice activity states for UI display
+ * Carrier KSL/TL a voice should have now (velocity, gain, master and tremolo)
  * 
- * @param voice_active Output array of 9 bools indicating active voices
+ * @param channel Physical OPL voice
+ * @return Value for register 0x43 + operator offset
  */
-void get_voice_states(bool voice_active[9]);
+uint8_t voice_level(uint8_t channel);
 
 #endif // VOICE_MANAGER_H